@@ -0,0 +1,273 @@
+#!/usr/bin/env python
+
+"""
+convert_to_binary_discretization.py:  Converts a meshfree discretization from the Peridigm text file format, or an
+Exodus II/genesis mesh, to the Peridigm binary discretization format (Discretization Type "Binary File").
+"""
+
+# ************************************************************************
+#
+#
+#                             Peridigm
+#                 Copyright (2011) Sandia Corporation
+#
+# Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+# the U.S. Government retains certain rights in this software.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met
+#
+# 1. Redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the Corporation nor the names of the
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+# EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Questions?
+# David J. Littlewood   djlittl@sandia.gov
+# John A. Mitchell      jamitch@sandia.gov
+# Michael L. Parks      mlparks@sandia.gov
+# Stewart A. Silling    sasilli@sandia.gov
+#
+# ************************************************************************
+
+from __future__ import print_function
+
+import sys
+import os
+import struct
+import argparse
+from array import array
+
+# File layout, see src/io/discretization/Peridigm_BinaryFileDiscretization.hpp
+MAGIC = b"PDBINDSC"
+VERSION = 2
+HORIZON_FLAG = 1
+NAME_LENGTH = 64
+
+def read_line(file):
+    """Scans the input file and ignores comment lines and blank lines."""
+
+    buff = file.readline()
+    while len(buff) > 0:
+        stripped = buff.strip()
+        if len(stripped) > 0 and stripped[0] not in "#/*":
+            return stripped
+        buff = file.readline()
+    return None
+
+def read_text_discretization(textFileName):
+    """Reads (x, y, z, block_id, volume) from a Peridigm text file discretization."""
+
+    coords = array('d')
+    volumes = array('d')
+    blockIds = array('i')
+    textFile = open(textFileName)
+    buff = read_line(textFile)
+    while buff != None:
+        vals = buff.split()
+        if len(vals) != 5:
+            print("**** Error parsing text file, invalid line:", buff)
+            sys.exit(1)
+        coords.extend([float(vals[0]), float(vals[1]), float(vals[2])])
+        blockIds.append(int(float(vals[3])))
+        volumes.append(float(vals[4]))
+        buff = read_line(textFile)
+    textFile.close()
+    return coords, volumes, blockIds
+
+def read_node_set_file(fileName):
+    """Reads a node set text file (1-based node numbers) and returns 0-based node ids."""
+
+    nodeIds = []
+    nodeSetFile = open(fileName)
+    buff = read_line(nodeSetFile)
+    while buff != None:
+        for val in buff.split():
+            nodeIds.append(int(val) - 1)
+        buff = read_line(nodeSetFile)
+    nodeSetFile.close()
+    return nodeIds
+
+def tet_volume(p0, p1, p2, p3):
+    a = [p1[i] - p0[i] for i in range(3)]
+    b = [p2[i] - p0[i] for i in range(3)]
+    c = [p3[i] - p0[i] for i in range(3)]
+    det = a[0]*(b[1]*c[2] - b[2]*c[1]) - a[1]*(b[0]*c[2] - b[2]*c[0]) + a[2]*(b[0]*c[1] - b[1]*c[0])
+    return abs(det)/6.0
+
+def tet_centroid_and_volume(p):
+    centroid = [(p[0][i] + p[1][i] + p[2][i] + p[3][i])/4.0 for i in range(3)]
+    return centroid, tet_volume(p[0], p[1], p[2], p[3])
+
+# Faces of the hexahedron as rings of nodes, the same faces as in hexCentroidAndVolume() in Peridigm_GeometryUtils.cpp
+HEX_FACES = [(1, 5, 4, 0), (2, 6, 5, 1), (3, 7, 6, 2), (0, 3, 7, 4), (0, 1, 2, 3), (5, 4, 7, 6)]
+
+def hex_centroid_and_volume(p):
+    # Split the hexahedron into 24 tetrahedra, each formed by one edge of a face, the barycenter of that face,
+    # and the barycenter of the hexahedron, matching hexCentroidAndVolume() in Peridigm_GeometryUtils.cpp
+    faceCenters = [[0.25*(p[f[0]][i] + p[f[1]][i] + p[f[2]][i] + p[f[3]][i]) for i in range(3)] for f in HEX_FACES]
+    center = [0.5*(faceCenters[4][i] + faceCenters[5][i]) for i in range(3)]
+    volume = 0.0
+    centroid = [0.0, 0.0, 0.0]
+    for face, faceCenter in zip(HEX_FACES, faceCenters):
+        for j in range(4):
+            c, v = tet_centroid_and_volume([p[face[j]], p[face[(j+1)%4]], faceCenter, center])
+            volume += v
+            for i in range(3):
+                centroid[i] += v*c[i]
+    if volume > 0.0:
+        centroid = [centroid[i]/volume for i in range(3)]
+    return centroid, volume
+
+def read_exodus_discretization(exodusFileName, pathToExodusPy):
+    """Converts the elements in an Exodus II/genesis file to spheres, in the same order as ExodusDiscretization."""
+
+    sys.path.append(pathToExodusPy)
+    import exodus
+
+    exodusFile = exodus.exodus(exodusFileName, 'r')
+    X, Y, Z = exodusFile.get_coords()
+
+    coords = array('d')
+    volumes = array('d')
+    blockIds = array('i')
+    blockNames = {}
+    elementsThatNodeBelongsTo = [[] for i in range(len(X))]
+    elemId = 0
+    exodusBlockNames = exodusFile.get_elem_blk_names()
+    for iBlock, blockId in enumerate(exodusFile.get_elem_blk_ids()):
+        # Blocks without a name are named "block_<id>" by the reader, as in ExodusDiscretization
+        if iBlock < len(exodusBlockNames) and len(exodusBlockNames[iBlock]) > 0:
+            blockNames[blockId] = exodusBlockNames[iBlock]
+        elemType = exodusFile.elem_type(blockId).upper()
+        conn, numElem, numNodesPerElem = exodusFile.get_elem_connectivity(blockId)
+        attributes = None
+        if elemType == "SPHERE":
+            attributes = exodusFile.get_elem_attr(blockId)
+            numAttributes = len(attributes)//numElem if numElem > 0 else 0
+        for iElem in range(numElem):
+            nodes = [conn[iElem*numNodesPerElem + i] - 1 for i in range(numNodesPerElem)]
+            points = [(X[n], Y[n], Z[n]) for n in nodes]
+            if elemType == "SPHERE":
+                centroid = list(points[0])
+                volume = attributes[iElem*numAttributes + 1]
+            elif elemType in ("TET", "TETRA", "TET4", "TET10"):
+                centroid, volume = tet_centroid_and_volume(points[:4])
+            elif elemType in ("HEX", "HEX8", "HEX20"):
+                centroid, volume = hex_centroid_and_volume(points[:8])
+            else:
+                print("**** Error, unknown element type", elemType)
+                sys.exit(1)
+            coords.extend(centroid)
+            volumes.append(volume)
+            blockIds.append(blockId)
+            for n in nodes:
+                elementsThatNodeBelongsTo[n].append(elemId)
+            elemId += 1
+
+    # Node sets are converted to the sphere mesh by including every element that contains a node in the set
+    nodeSets = []
+    nodeSetNames = exodusFile.get_node_set_names()
+    for i, nodeSetId in enumerate(exodusFile.get_node_set_ids()):
+        name = ""
+        if i < len(nodeSetNames):
+            name = nodeSetNames[i]
+        if len(name) == 0:
+            name = "nodelist_" + str(nodeSetId)
+        elements = set()
+        for node in exodusFile.get_node_set_nodes(nodeSetId):
+            elements.update(elementsThatNodeBelongsTo[node - 1])
+        nodeSets.append((name, sorted(elements)))
+
+    exodusFile.close()
+    return coords, volumes, blockIds, blockNames, nodeSets
+
+def write_binary_discretization(fileName, coords, volumes, blockIds, horizons, blockNames, nodeSets):
+    """Writes the header and contiguous arrays (little endian)."""
+
+    numPoints = len(volumes)
+    flags = 0
+    if horizons != None:
+        flags |= HORIZON_FLAG
+    outFile = open(fileName, 'wb')
+    outFile.write(struct.pack("<8sIIQQQ24x", MAGIC, VERSION, flags, numPoints, len(nodeSets), len(blockNames)))
+    for values, typecode in ((coords, 'd'), (volumes, 'd'), (horizons, 'd'), (blockIds, 'i')):
+        if values == None:
+            continue
+        data = array(typecode, values)
+        if sys.byteorder != "little":
+            data.byteswap()
+        outFile.write(data.tostring() if sys.version_info[0] < 3 else data.tobytes())
+    for blockId in sorted(blockNames.keys()):
+        encodedName = blockNames[blockId].encode("ascii")[:NAME_LENGTH]
+        outFile.write(struct.pack("<i%ds" % NAME_LENGTH, blockId, encodedName))
+    for name, nodeIds in nodeSets:
+        encodedName = name.encode("ascii")[:NAME_LENGTH]
+        outFile.write(struct.pack("<%dsQ" % NAME_LENGTH, encodedName, len(nodeIds)))
+        data = array('i', nodeIds)
+        if sys.byteorder != "little":
+            data.byteswap()
+        outFile.write(data.tostring() if sys.version_info[0] < 3 else data.tobytes())
+    outFile.close()
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="Convert a text file discretization or Exodus II/genesis mesh to the Peridigm binary discretization format.")
+    parser.add_argument("input", help="text file discretization (x, y, z, block_id, volume) or Exodus II/genesis file (.g or .e)")
+    parser.add_argument("nodesets", nargs="*", help="node set text files (1-based node numbers), text file input only")
+    parser.add_argument("-o", "--output", help="output file name (default: input file name with extension .pdb)")
+    parser.add_argument("--horizons", help="text file with one precomputed horizon per point, stored in the binary file")
+    parser.add_argument("--exodus-py", default="trilinos_install_path/lib", help="directory containing exodus.py, Exodus II input only")
+    args = parser.parse_args()
+
+    print("\n---- Convert to Binary Discretization\n")
+
+    isExodus = os.path.splitext(args.input)[1].lower() in (".g", ".e", ".gen", ".exo")
+    if isExodus:
+        coords, volumes, blockIds, blockNames, nodeSets = read_exodus_discretization(args.input, args.exodus_py)
+    else:
+        coords, volumes, blockIds = read_text_discretization(args.input)
+        blockNames = {}
+        nodeSets = []
+        for i, fileName in enumerate(args.nodesets):
+            nodeSets.append(("nodelist_" + str(i+1), read_node_set_file(fileName)))
+    print("Read", len(volumes), "points and", len(set(blockIds)), "blocks from", args.input)
+
+    horizons = None
+    if args.horizons != None:
+        horizonFile = open(args.horizons)
+        horizons = []
+        buff = read_line(horizonFile)
+        while buff != None:
+            horizons.extend([float(val) for val in buff.split()])
+            buff = read_line(horizonFile)
+        horizonFile.close()
+        if len(horizons) != len(volumes):
+            print("**** Error, number of horizons (" + str(len(horizons)) + ") does not match number of points (" + str(len(volumes)) + ")")
+            sys.exit(1)
+
+    outputFileName = args.output
+    if outputFileName == None:
+        outputFileName = os.path.splitext(args.input)[0] + ".pdb"
+    write_binary_discretization(outputFileName, coords, volumes, blockIds, horizons, blockNames, nodeSets)
+
+    print("\nData written to binary discretization file", outputFileName, "\n")
@@ -0,0 +1,411 @@
+#! /usr/bin/env python
+
+"""Weak scaling harness and performance history for Peridigm.
+
+Generates weak-scaled QuickGrid versions of the tensile_test and
+fragmenting_cylinder performance problems, runs each at a series of
+processor counts, and records the full tree of timers for every run in a
+history database keyed by git commit.  Each timer is compared against the
+most recent run of the same problem and processor count from a different
+commit, and timers that slowed down by more than the given threshold are
+reported as regressions.
+
+The history is kept in SQLite if the database file name ends in .sqlite or
+.db, and in JSON otherwise.
+
+Example:
+
+  scaling_harness.py --peridigm ../build/src/Peridigm --max-procs 8 \\
+                     --database performance_history.sqlite
+"""
+
+from __future__ import print_function
+
+import argparse
+import datetime
+import json
+import math
+import os
+import socket
+import sqlite3
+import subprocess
+import sys
+
+# Ratio of horizon to grid spacing used by both problems
+horizon_ratio = 3.015
+
+# Timer names are joined with this separator to form the key for each timer
+path_separator = " > "
+
+def tensile_test(num_procs, resolution):
+    """Elastic correspondence bar pulled quasi-statically to 0.5% strain.
+
+    The cross section is fixed and the bar grows along y with the number of
+    processors.  Units are CGS, as in test/performance/tensile_test.
+    """
+
+    nx = nz = max(2, int(round(8*resolution)))
+    ny = 4*nx*num_procs
+    spacing = 0.5/nx
+    length = ny*spacing
+
+    # Node numbering follows QuickGrid:  id = 1 + i + j*nx + k*nx*ny
+    def node(i, j, k):
+        return 1 + i + j*nx + k*nx*ny
+    bottom = [node(i, 0, k) for k in range(nz) for i in range(nx)]
+    top = [node(i, ny-1, k) for k in range(nz) for i in range(nx)]
+    bottom_center = [node(nx//2, 0, nz//2)]
+    top_center = [node(nx//2, ny-1, nz//2)]
+
+    node_sets = {"bottom.txt" : bottom,
+                 "top.txt" : top,
+                 "bottom_center.txt" : bottom_center,
+                 "top_center.txt" : top_center}
+
+    deck = """Peridigm:
+  Verbose: false
+  Discretization:
+    Type: "PdQuickGrid"
+    TensorProduct3DMeshGenerator:
+      Type: "PdQuickGrid"
+      X Origin: {x_origin}
+      Y Origin: {y_origin}
+      Z Origin: {z_origin}
+      X Length: {x_length}
+      Y Length: {y_length}
+      Z Length: {z_length}
+      Number Points X: {nx}
+      Number Points Y: {ny}
+      Number Points Z: {nz}
+  Materials:
+    My Material:
+      Material Model: "Elastic Correspondence"
+      Density: 8.0
+      Bulk Modulus: 1.500e12
+      Shear Modulus: 6.923e11
+      Hourglass Coefficient: 0.02
+  Blocks:
+    My Block:
+      Block Names: "block_1"
+      Material: "My Material"
+      Horizon: {horizon}
+  Boundary Conditions:
+    Bottom Node Set: "bottom.txt"
+    Top Node Set: "top.txt"
+    Bottom Center Node Set: "bottom_center.txt"
+    Top Center Node Set: "top_center.txt"
+    Prescribed Displacement Bottom:
+      Type: "Prescribed Displacement"
+      Node Set: "Bottom Node Set"
+      Coordinate: "y"
+      Value: "y*0.005*t"
+    Prescribed Displacement Top:
+      Type: "Prescribed Displacement"
+      Node Set: "Top Node Set"
+      Coordinate: "y"
+      Value: "y*0.005*t"
+    Prescribed Displacement Bottom X:
+      Type: "Prescribed Displacement"
+      Node Set: "Bottom Center Node Set"
+      Coordinate: "x"
+      Value: "0.0"
+    Prescribed Displacement Bottom Z:
+      Type: "Prescribed Displacement"
+      Node Set: "Bottom Center Node Set"
+      Coordinate: "z"
+      Value: "0.0"
+    Prescribed Displacement Top X:
+      Type: "Prescribed Displacement"
+      Node Set: "Top Center Node Set"
+      Coordinate: "x"
+      Value: "0.0"
+    Prescribed Displacement Top Z:
+      Type: "Prescribed Displacement"
+      Node Set: "Top Center Node Set"
+      Coordinate: "z"
+      Value: "0.0"
+  Solver:
+    Verbose: false
+    Initial Time: 0.0
+    Final Time: 1.0
+    QuasiStatic:
+      Number of Load Steps: 4
+      Absolute Tolerance: 1.0
+      Maximum Solver Iterations: 10
+  Timing Data:
+    Output Filename: "timing.json"
+""".format(x_origin=-0.25, y_origin=-0.5*length, z_origin=-0.25,
+           x_length=0.5, y_length=length, z_length=0.5,
+           nx=nx, ny=ny, nz=nz, horizon=horizon_ratio*spacing)
+
+    return deck, node_sets, nx*ny*nz
+
+def fragmenting_cylinder(num_procs, resolution):
+    """Elastic cylinder with critical stretch damage, expanded by an initial velocity field.
+
+    The cross section is fixed and the cylinder grows along its axis with the
+    number of processors.  The initial velocity profile is stretched to
+    match, so each processor sees the same loading.
+    """
+
+    inner_radius = 0.020
+    outer_radius = 0.025
+    num_points_radius = max(2, int(round(3*resolution)))
+    spacing = (outer_radius - inner_radius)/num_points_radius
+    cylinder_length = 0.05*num_procs
+    half_length = 0.5*cylinder_length
+    num_points_circumference = int(math.pi*(inner_radius + outer_radius)/spacing + 0.5)
+    num_points_axis = int(cylinder_length/spacing) + 1
+
+    # Fixed time step well below the critical time step, and a fixed number of steps
+    wave_speed = math.sqrt(130.0e9/7800.0)
+    time_step = 0.1*spacing/wave_speed
+    num_steps = 200
+
+    deck = """Peridigm:
+  Discretization:
+    Type: "PdQuickGrid"
+    TensorProductCylinderMeshGenerator:
+      Type: "PdQuickGrid"
+      Inner Radius: {inner_radius}
+      Outer Radius: {outer_radius}
+      Cylinder Length: {cylinder_length}
+      Number Points Radius: {num_points_radius}
+      Ring Center x: 0.0
+      Ring Center y: 0.0
+      Z Origin: 0.0
+  Materials:
+    My Material:
+      Material Model: "Elastic"
+      Density: 7800.0
+      Bulk Modulus: 130.0e9
+      Shear Modulus: 78.0e9
+  Damage Models:
+    My Damage Model:
+      Damage Model: "Critical Stretch"
+      Critical Stretch: 0.02
+  Blocks:
+    My Block:
+      Block Names: "block_1"
+      Material: "My Material"
+      Damage Model: "My Damage Model"
+      Horizon: {horizon}
+  Boundary Conditions:
+    Initial Velocity X:
+      Type: "Initial Velocity"
+      Node Set: "Full Domain"
+      Coordinate: "x"
+      Value: "(200 - 50*((z/{half_length})-1)^2)*cos(atan2(y,x))"
+    Initial Velocity Y:
+      Type: "Initial Velocity"
+      Node Set: "Full Domain"
+      Coordinate: "y"
+      Value: "(200 - 50*((z/{half_length})-1)^2)*sin(atan2(y,x))"
+    Initial Velocity Z:
+      Type: "Initial Velocity"
+      Node Set: "Full Domain"
+      Coordinate: "z"
+      Value: "(100*((z/{half_length})-1))"
+  Solver:
+    Initial Time: 0.0
+    Final Time: {final_time}
+    Verlet:
+      Fixed dt: {time_step}
+  Timing Data:
+    Output Filename: "timing.json"
+""".format(inner_radius=inner_radius, outer_radius=outer_radius,
+           cylinder_length=cylinder_length, num_points_radius=num_points_radius,
+           horizon=horizon_ratio*spacing, half_length=half_length,
+           final_time=num_steps*time_step, time_step=time_step)
+
+    return deck, {}, num_points_radius*num_points_circumference*num_points_axis
+
+problems = {"tensile_test" : tensile_test,
+            "fragmenting_cylinder" : fragmenting_cylinder}
+
+def git_commit(repository):
+    """Returns the commit hash of the repository, flagged if the working tree has local changes."""
+    try:
+        commit = subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=repository).decode().strip()
+        status = subprocess.check_output(["git", "status", "--porcelain", "--untracked-files=no"], cwd=repository).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+    if status:
+        commit += "-dirty"
+    return commit
+
+def run_problem(args, name, num_procs):
+    """Writes the input deck for the given problem and processor count, runs it, and returns the timing data."""
+
+    run_dir = os.path.join(args.work_dir, "{0}_np{1}".format(name, num_procs))
+    if not os.path.exists(run_dir):
+        os.makedirs(run_dir)
+    deck, node_sets, num_points = problems[name](num_procs, args.resolution)
+    deck_name = name + ".yaml"
+    with open(os.path.join(run_dir, deck_name), 'w') as deck_file:
+        deck_file.write(deck)
+    for file_name, nodes in node_sets.items():
+        with open(os.path.join(run_dir, file_name), 'w') as node_set_file:
+            node_set_file.write(" ".join([str(n) for n in nodes]) + "\n")
+    timing_file_name = os.path.join(run_dir, "timing.json")
+    if os.path.exists(timing_file_name):
+        os.remove(timing_file_name)
+
+    command = args.mpiexec.split() + [str(num_procs), os.path.abspath(args.peridigm), deck_name]
+    print("  {0:24} {1:>6} procs {2:>12} points ... ".format(name, num_procs, num_points), end="")
+    sys.stdout.flush()
+    with open(os.path.join(run_dir, name + ".log"), 'w') as log_file:
+        return_code = subprocess.call(command, cwd=run_dir, stdout=log_file, stderr=subprocess.STDOUT)
+    if return_code != 0 or not os.path.exists(timing_file_name):
+        print("FAILED (see {0})".format(os.path.join(run_dir, name + ".log")))
+        return None
+
+    with open(timing_file_name) as timing_file:
+        timing_data = json.load(timing_file)
+    timers = {}
+    for timer in timing_data["timers"]:
+        timers[path_separator.join(timer["path"])] = timer
+    total = timers["Total"]["max"] if "Total" in timers else float('nan')
+    print("{0:.3f} s".format(total))
+    return {"problem" : name, "processors" : num_procs, "points" : num_points, "timers" : timers}
+
+class History(object):
+    """Performance history, stored in SQLite or JSON."""
+
+    def __init__(self, file_name):
+        self.file_name = file_name
+        self.use_sqlite = os.path.splitext(file_name)[1] in [".sqlite", ".db"]
+        if self.use_sqlite:
+            self.connection = sqlite3.connect(file_name)
+            self.connection.execute("CREATE TABLE IF NOT EXISTS runs (id INTEGER PRIMARY KEY, git_commit TEXT, date TEXT, host TEXT, "
+                                    "problem TEXT, processors INTEGER, points INTEGER, resolution REAL)")
+            self.connection.execute("CREATE TABLE IF NOT EXISTS timers (run_id INTEGER, path TEXT, min REAL, max REAL, ave REAL, calls INTEGER, "
+                                    "step_median REAL, step_p99 REAL)")
+            self.connection.commit()
+        else:
+            self.runs = []
+            if os.path.exists(file_name):
+                with open(file_name) as history_file:
+                    self.runs = json.load(history_file)["runs"]
+
+    def previous_run(self, commit, host, problem, processors, resolution):
+        """Returns the timers of the most recent run of the same case from a different commit, or None."""
+        if self.use_sqlite:
+            row = self.connection.execute("SELECT id, git_commit FROM runs WHERE git_commit != ? AND host = ? AND problem = ? "
+                                          "AND processors = ? AND resolution = ? ORDER BY id DESC LIMIT 1",
+                                          (commit, host, problem, processors, resolution)).fetchone()
+            if row is None:
+                return None
+            timers = {}
+            for path, tmax in self.connection.execute("SELECT path, max FROM timers WHERE run_id = ?", (row[0],)):
+                timers[path] = {"max" : tmax}
+            return row[1], timers
+        for run in reversed(self.runs):
+            if run["git_commit"] != commit and run["host"] == host and run["problem"] == problem \
+               and run["processors"] == processors and run["resolution"] == resolution:
+                return run["git_commit"], run["timers"]
+        return None
+
+    def add_run(self, commit, date, host, resolution, result):
+        if self.use_sqlite:
+            cursor = self.connection.execute("INSERT INTO runs (git_commit, date, host, problem, processors, points, resolution) "
+                                             "VALUES (?, ?, ?, ?, ?, ?, ?)",
+                                             (commit, date, host, result["problem"], result["processors"], result["points"], resolution))
+            for path, timer in result["timers"].items():
+                self.connection.execute("INSERT INTO timers VALUES (?, ?, ?, ?, ?, ?, ?, ?)",
+                                        (cursor.lastrowid, path, timer["min"], timer["max"], timer["ave"], timer["calls"],
+                                         timer.get("step_median"), timer.get("step_p99")))
+            self.connection.commit()
+        else:
+            self.runs.append({"git_commit" : commit, "date" : date, "host" : host, "problem" : result["problem"],
+                              "processors" : result["processors"], "points" : result["points"], "resolution" : resolution,
+                              "timers" : result["timers"]})
+            with open(self.file_name, 'w') as history_file:
+                json.dump({"runs" : self.runs}, history_file, indent=1)
+
+def find_regressions(result, previous_timers, threshold, min_time):
+    """Returns the timers of the given run that slowed down by more than threshold relative to the previous run."""
+    regressions = []
+    for path, timer in result["timers"].items():
+        if path not in previous_timers:
+            continue
+        old_time = previous_timers[path]["max"]
+        new_time = timer["max"]
+        if old_time > 0.0 and new_time > old_time*(1.0 + threshold) and new_time - old_time > min_time:
+            regressions.append([path, old_time, new_time])
+    regressions.sort(key=lambda r: r[2]/r[1], reverse=True)
+    return regressions
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="Runs weak-scaled Peridigm performance problems and tracks per-timer regressions.")
+    parser.add_argument("--peridigm", required=True, help="path to the Peridigm executable")
+    parser.add_argument("--mpiexec", default="mpiexec -np", help="command used to launch Peridigm, followed by the number of processors (default: %(default)s)")
+    parser.add_argument("--max-procs", type=int, default=4, help="run at 1, 2, 4, ... processors up to this value (default: %(default)s)")
+    parser.add_argument("--procs", help="comma-separated list of processor counts, overrides --max-procs")
+    parser.add_argument("--problems", default=",".join(sorted(problems.keys())), help="comma-separated list of problems (default: %(default)s)")
+    parser.add_argument("--resolution", type=float, default=1.0, help="scale factor on the number of points per processor (default: %(default)s)")
+    parser.add_argument("--work-dir", default="scaling_runs", help="directory for the generated inputs and run output (default: %(default)s)")
+    parser.add_argument("--database", default="performance_history.sqlite", help="history file, SQLite (.sqlite, .db) or JSON (default: %(default)s)")
+    parser.add_argument("--threshold", type=float, default=0.10, help="relative slowdown of a timer reported as a regression (default: %(default)s)")
+    parser.add_argument("--min-time", type=float, default=0.05, help="ignore slowdowns smaller than this many seconds (default: %(default)s)")
+    parser.add_argument("--commit", help="label for the results (default: git commit of this repository)")
+    args = parser.parse_args()
+
+    if args.procs:
+        proc_counts = [int(p) for p in args.procs.split(",")]
+    else:
+        proc_counts = []
+        num_procs = 1
+        while num_procs <= args.max_procs:
+            proc_counts.append(num_procs)
+            num_procs *= 2
+    problem_names = args.problems.split(",")
+    for name in problem_names:
+        if name not in problems:
+            print("\n**** Error, unknown problem " + name + "\n")
+            sys.exit(1)
+
+    repository = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    commit = args.commit if args.commit else git_commit(repository)
+    host = socket.gethostname()
+    date = datetime.datetime.now().strftime("%Y-%m-%d %H:%M")
+    history = History(args.database)
+
+    print("\nPeridigm weak scaling runs, commit " + commit + ", host " + host + "\n")
+    results = []
+    for name in problem_names:
+        for num_procs in proc_counts:
+            result = run_problem(args, name, num_procs)
+            if result is not None:
+                results.append(result)
+
+    # Weak scaling efficiency relative to the smallest processor count
+    print("\nWeak scaling efficiency (Total time at the smallest processor count / Total time):\n")
+    for name in problem_names:
+        runs = [r for r in results if r["problem"] == name and "Total" in r["timers"]]
+        if not runs:
+            continue
+        base_time = runs[0]["timers"]["Total"]["max"]
+        for run in runs:
+            run_time = run["timers"]["Total"]["max"]
+            print("  {0:24} {1:>6} procs {2:>10.3f} s {3:>8.2f}".format(name, run["processors"], run_time, base_time/run_time if run_time > 0.0 else 0.0))
+
+    # Compare each timer against the most recent run from another commit, then record this run
+    num_regressions = 0
+    print("\nTimers slower than the previous commit by more than {0:.0f}%:\n".format(100.0*args.threshold))
+    for result in results:
+        previous = history.previous_run(commit, host, result["problem"], result["processors"], args.resolution)
+        if previous is not None:
+            previous_commit, previous_timers = previous
+            for path, old_time, new_time in find_regressions(result, previous_timers, args.threshold, args.min_time):
+                print("  {0} np{1}  {2}:  {3:.3f} s -> {4:.3f} s ({5:+.1f}%, previous commit {6})".format(
+                      result["problem"], result["processors"], path, old_time, new_time, 100.0*(new_time/old_time - 1.0), previous_commit[:12]))
+                num_regressions += 1
+        history.add_run(commit, date, host, args.resolution, result)
+    if num_regressions == 0:
+        print("  none")
+    print("")
+
+    failed_runs = len(problem_names)*len(proc_counts) - len(results)
+    sys.exit(1 if num_regressions > 0 or failed_runs > 0 else 0)
@@ -56,6 +56,8 @@
 #include "Peridigm_Version.hpp"
 #include "Peridigm_Factory.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
 
 #include "Peridigm_API.hpp"
 
@@ -127,6 +129,7 @@ PD_LIB_DLL_EXPORT const int run_peridigm(int argc, char *argv[], const bool fina
     peridigm->executeSolvers();
 
     peridigm->printMemoryStats();
+    peridigm->printBlockCosts();
 
   }
 
@@ -150,6 +153,9 @@ PD_LIB_DLL_EXPORT const int run_peridigm(int argc, char *argv[], const bool fina
 
   PeridigmNS::Timer::self().stopTimer("Total");
   PeridigmNS::Timer::self().printTimingData(cout);
+  PeridigmNS::Timer::self().writeTrace();
+  PeridigmNS::PerformanceCounters::self().printCounterData(cout);
+  PeridigmNS::CommunicationMonitor::self().printCommunicationData(cout);
 
 #ifdef HAVE_MPI
   if(finalize)
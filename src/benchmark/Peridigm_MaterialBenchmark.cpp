@@ -0,0 +1,606 @@
+/*! \file Peridigm_MaterialBenchmark.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+// Micro-benchmark for the material and damage model kernels.
+//
+// Each case builds a tensor-product QuickGrid discretization at a given ratio of horizon
+// to grid spacing, loads a single block with a uniformly-strained configuration, and times
+// repeated calls to computeForce(), computeJacobian(), and computeDamage().  Throughput is
+// reported in bonds per second, and in gigabytes per second of the point, bond, and
+// neighborhood data streamed by each call.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <map>
+#include <cstdlib>
+#include <unordered_set>
+#include <algorithm>
+#include <chrono>
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include <Epetra_Map.h>
+#include <Epetra_FECrsMatrix.h>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_Assert.hpp>
+
+#include "Peridigm_Block.hpp"
+#include "Peridigm_Field.hpp"
+#include "Peridigm_HorizonManager.hpp"
+#include "Peridigm_DiscretizationFactory.hpp"
+#include "Peridigm_MaterialFactory.hpp"
+#include "Peridigm_DamageModelFactory.hpp"
+#include "Peridigm_UserDefinedTimeDependentCriticalStretchDamageModel.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+
+using namespace std;
+
+namespace {
+
+  //! Material parameters shared by all models.
+  const double density = 7800.0;
+  const double bulkModulus = 130.0e9;
+  const double shearModulus = 78.0e9;
+
+  //! Uniform strain applied to the grid; small enough that no bonds fail.
+  const double appliedStrain = 1.0e-3;
+
+  //! Time step passed to the kernels.
+  const double dt = 1.0e-8;
+
+  //! Parameters for each of the material models in the benchmark.
+  vector<Teuchos::ParameterList> materialParameters(){
+    vector<Teuchos::ParameterList> materials;
+    Teuchos::ParameterList params;
+    params.set("Density", density);
+    params.set("Bulk Modulus", bulkModulus);
+    params.set("Shear Modulus", shearModulus);
+
+    Teuchos::ParameterList elastic(params);
+    elastic.set("Material Model", "Elastic");
+    materials.push_back(elastic);
+
+    Teuchos::ParameterList elasticBondBased;
+    elasticBondBased.set("Material Model", "Elastic Bond Based");
+    elasticBondBased.set("Density", density);
+    elasticBondBased.set("Bulk Modulus", bulkModulus);
+    materials.push_back(elasticBondBased);
+
+    Teuchos::ParameterList elasticPlastic(params);
+    elasticPlastic.set("Material Model", "Elastic Plastic");
+    elasticPlastic.set("Yield Stress", 100.0e6);
+    materials.push_back(elasticPlastic);
+
+    Teuchos::ParameterList elasticPlasticHardening(params);
+    elasticPlasticHardening.set("Material Model", "Elastic Plastic Hardening");
+    elasticPlasticHardening.set("Yield Stress", 100.0e6);
+    elasticPlasticHardening.set("Hardening Modulus", 1.0e9);
+    materials.push_back(elasticPlasticHardening);
+
+    Teuchos::ParameterList viscoelastic(params);
+    viscoelastic.set("Material Model", "Viscoelastic");
+    viscoelastic.set("lambda_i", 0.5);
+    viscoelastic.set("tau b", 1.0e-6);
+    materials.push_back(viscoelastic);
+
+    Teuchos::ParameterList pals(params);
+    pals.set("Material Model", "Pals");
+    pals.set("Dilatation Influence Function", "One");
+    pals.set("Deviatoric Influence Function", "One");
+    materials.push_back(pals);
+
+    params.set("Hourglass Coefficient", 0.02);
+
+    Teuchos::ParameterList elasticCorrespondence(params);
+    elasticCorrespondence.set("Material Model", "Elastic Correspondence");
+    materials.push_back(elasticCorrespondence);
+
+    Teuchos::ParameterList elasticPlasticCorrespondence(params);
+    elasticPlasticCorrespondence.set("Material Model", "Elastic Plastic Correspondence");
+    elasticPlasticCorrespondence.set("Yield Stress", 100.0e6);
+    materials.push_back(elasticPlasticCorrespondence);
+
+    Teuchos::ParameterList isotropicHardeningCorrespondence(params);
+    isotropicHardeningCorrespondence.set("Material Model", "Isotropic Hardening Correspondence");
+    isotropicHardeningCorrespondence.set("Yield Stress", 100.0e6);
+    isotropicHardeningCorrespondence.set("Hardening Modulus", 1.0e9);
+    materials.push_back(isotropicHardeningCorrespondence);
+
+    Teuchos::ParameterList viscoplasticNeedlemanCorrespondence(params);
+    viscoplasticNeedlemanCorrespondence.set("Material Model", "Viscoplastic Needleman Correspondence");
+    viscoplasticNeedlemanCorrespondence.set("Yield Stress", 100.0e6);
+    viscoplasticNeedlemanCorrespondence.set("Strain Hardening Exponent", 0.1);
+    viscoplasticNeedlemanCorrespondence.set("Rate Hardening Exponent", 0.01);
+    viscoplasticNeedlemanCorrespondence.set("Reference Strain Rate", 0.001);
+    viscoplasticNeedlemanCorrespondence.set("Reference Strain 0", 0.00218);
+    viscoplasticNeedlemanCorrespondence.set("Reference Strain 1", 0.436);
+    materials.push_back(viscoplasticNeedlemanCorrespondence);
+
+    return materials;
+  }
+
+  //! Parameters for each of the damage models in the benchmark.
+  /*!
+    The Interface Aware model is omitted; it requires node sets from a boundary condition manager.
+  */
+  vector<Teuchos::ParameterList> damageParameters(){
+    vector<Teuchos::ParameterList> damageModels;
+
+    Teuchos::ParameterList criticalStretch;
+    criticalStretch.set("Damage Model", "Critical Stretch");
+    criticalStretch.set("Critical Stretch", 10.0*appliedStrain);
+    damageModels.push_back(criticalStretch);
+
+    Teuchos::ParameterList timeDependentCriticalStretch;
+    timeDependentCriticalStretch.set("Damage Model", "Time Dependent Critical Stretch");
+    stringstream function;
+    function << "value = " << 10.0*appliedStrain << ";";
+    timeDependentCriticalStretch.set("Time Dependent Critical Stretch", function.str());
+    damageModels.push_back(timeDependentCriticalStretch);
+
+    return damageModels;
+  }
+
+  //! Timing results for a single kernel.
+  struct Result {
+    string model;
+    string kernel;
+    double horizonRatio;
+    long long points;
+    long long bonds;
+    int repetitions;
+    double minTime;
+    double medianTime;
+    long long bytes;
+  };
+
+  //! Monotonic clock, in seconds.
+  double now(){
+    return 1.0e-9*std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  //! A single-block problem on a QuickGrid discretization.
+  class BenchmarkProblem {
+
+  public:
+
+    BenchmarkProblem(Teuchos::RCP<const Epetra_Comm> comm,
+                     int pointsPerSide,
+                     double horizonRatio,
+                     const Teuchos::ParameterList& materialParams,
+                     const Teuchos::ParameterList* damageParams)
+    {
+      // The grid has unit spacing
+      const double length = static_cast<double>(pointsPerSide);
+      const double horizon = horizonRatio;
+
+      Teuchos::ParameterList blockParams;
+      Teuchos::ParameterList& blockOneParams = blockParams.sublist("Benchmark Block");
+      blockOneParams.set("Block Names", "block_1");
+      blockOneParams.set("Material", materialParams.get<string>("Material Model"));
+      blockOneParams.set("Horizon", horizon);
+      if(damageParams != 0)
+        blockOneParams.set("Damage Model", damageParams->get<string>("Damage Model"));
+      PeridigmNS::HorizonManager::self().loadHorizonInformationFromBlockParameters(blockParams);
+
+      Teuchos::RCP<Teuchos::ParameterList> discParams = Teuchos::rcp(new Teuchos::ParameterList);
+      discParams->set("Type", "PdQuickGrid");
+      Teuchos::ParameterList& quickGridParams = discParams->sublist("TensorProduct3DMeshGenerator");
+      quickGridParams.set("Type", "PdQuickGrid");
+      quickGridParams.set("X Origin", 0.0);
+      quickGridParams.set("Y Origin", 0.0);
+      quickGridParams.set("Z Origin", 0.0);
+      quickGridParams.set("X Length", length);
+      quickGridParams.set("Y Length", length);
+      quickGridParams.set("Z Length", length);
+      quickGridParams.set("Number Points X", pointsPerSide);
+      quickGridParams.set("Number Points Y", pointsPerSide);
+      quickGridParams.set("Number Points Z", pointsPerSide);
+      PeridigmNS::DiscretizationFactory discFactory(discParams);
+      discretization = discFactory.create(comm);
+
+      Teuchos::ParameterList matParams(materialParams);
+      matParams.set("Horizon", horizon);
+      matParams.set("Finite Difference Probe Length", 1.0e-6);
+      PeridigmNS::MaterialFactory materialFactory;
+
+      block = Teuchos::rcp(new PeridigmNS::Block("block_1", 1, blockOneParams));
+      block->setMaterialModel(materialFactory.create(matParams));
+      if(damageParams != 0){
+        PeridigmNS::DamageModelFactory damageModelFactory;
+        Teuchos::RCP<PeridigmNS::DamageModel> damageModel = damageModelFactory.create(*damageParams);
+        Teuchos::RCP<PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel> timeDependentDamageModel =
+          Teuchos::rcp_dynamic_cast<PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel>(damageModel);
+        if(!timeDependentDamageModel.is_null()){
+          double currentValue(0.0), previousValue(0.0), timeCurrent(0.0), timePrevious(0.0);
+          timeDependentDamageModel->evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
+        }
+        block->setDamageModel(damageModel);
+      }
+
+      PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+      int blockIdFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Block_Id");
+      int horizonFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Horizon");
+      int volumeFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Volume");
+      int modelCoordinatesFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::CONSTANT, "Model_Coordinates");
+      int coordinatesFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Coordinates");
+      int displacementFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Displacement");
+      int velocityFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Velocity");
+
+      vector<int> auxiliaryFieldIds;
+      auxiliaryFieldIds.push_back(blockIdFieldId);
+      auxiliaryFieldIds.push_back(horizonFieldId);
+      auxiliaryFieldIds.push_back(volumeFieldId);
+      auxiliaryFieldIds.push_back(modelCoordinatesFieldId);
+      auxiliaryFieldIds.push_back(coordinatesFieldId);
+      auxiliaryFieldIds.push_back(displacementFieldId);
+      auxiliaryFieldIds.push_back(velocityFieldId);
+      block->setAuxiliaryFieldIds(auxiliaryFieldIds);
+
+      block->initialize(discretization->getGlobalOwnedMap(1),
+                        discretization->getGlobalOverlapMap(1),
+                        discretization->getGlobalOwnedMap(3),
+                        discretization->getGlobalOverlapMap(3),
+                        discretization->getGlobalBondMap(),
+                        discretization->getBlockID(),
+                        discretization->getNeighborhoodData());
+
+      // Uniaxial strain in x with a simple shear in xy, and a matching velocity field
+      Epetra_Vector& x = *discretization->getInitialX();
+      Epetra_Vector y(x), u(x), v(x);
+      for(int i=0 ; i<x.MyLength()/3 ; ++i){
+        u[3*i]   = appliedStrain*x[3*i] + 0.5*appliedStrain*x[3*i+1];
+        u[3*i+1] = 0.0;
+        u[3*i+2] = 0.0;
+        y[3*i]   = x[3*i] + u[3*i];
+        y[3*i+1] = x[3*i+1];
+        y[3*i+2] = x[3*i+2];
+        v[3*i]   = u[3*i]/dt;
+        v[3*i+1] = 0.0;
+        v[3*i+2] = 0.0;
+      }
+
+      block->importData(*discretization->getBlockID(),    blockIdFieldId,          PeridigmField::STEP_NONE, Insert);
+      block->importData(*discretization->getHorizon(),    horizonFieldId,          PeridigmField::STEP_NONE, Insert);
+      block->importData(*discretization->getCellVolume(), volumeFieldId,           PeridigmField::STEP_NONE, Insert);
+      block->importData(x,                                modelCoordinatesFieldId, PeridigmField::STEP_NONE, Insert);
+      block->importData(x,                                coordinatesFieldId,      PeridigmField::STEP_N,    Insert);
+      block->importData(y,                                coordinatesFieldId,      PeridigmField::STEP_NP1,  Insert);
+      block->importData(u,                                displacementFieldId,     PeridigmField::STEP_NP1,  Insert);
+      block->importData(v,                                velocityFieldId,         PeridigmField::STEP_NP1,  Insert);
+
+      block->initializeMaterialModel(dt);
+      block->initializeDamageModel(dt);
+    }
+
+    //! Number of points on this processor.
+    long long numPoints() const { return block->getNeighborhoodData()->NumOwnedPoints(); }
+
+    //! Number of bonds on this processor.
+    long long numBonds() const { return block->getNeighborhoodData()->NumBonds(); }
+
+    //! Bytes of point, bond, and neighborhood data on this processor.
+    long long dataBytes() const {
+      return block->getDataManager()->pointDataBytes() + block->getDataManager()->bondDataBytes() + block->getNeighborhoodData()->memoryBytes();
+    }
+
+    void computeForce() {
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block->getNeighborhoodData();
+      block->getMaterialModel()->computeForce(dt,
+                                              neighborhoodData->NumOwnedPoints(),
+                                              neighborhoodData->OwnedIDs(),
+                                              neighborhoodData->NeighborhoodList(),
+                                              *block->getDataManager());
+    }
+
+    void computeDamage() {
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block->getNeighborhoodData();
+      block->getDamageModel()->computeDamage(dt,
+                                             neighborhoodData->NumOwnedPoints(),
+                                             neighborhoodData->OwnedIDs(),
+                                             neighborhoodData->NeighborhoodList(),
+                                             *block->getDataManager());
+    }
+
+    void computeJacobian() {
+      if(jacobian.is_null())
+        allocateJacobian();
+      tangent->PutScalar(0.0);
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block->getNeighborhoodData();
+      block->getMaterialModel()->computeJacobian(dt,
+                                                 neighborhoodData->NumOwnedPoints(),
+                                                 neighborhoodData->OwnedIDs(),
+                                                 neighborhoodData->NeighborhoodList(),
+                                                 *block->getDataManager(),
+                                                 *jacobian,
+                                                 PeridigmNS::Material::FULL_MATRIX);
+    }
+
+  private:
+
+    //! Allocates the tangent matrix, following Peridigm::allocateJacobian().
+    void allocateJacobian() {
+      Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap = discretization->getGlobalOwnedMap(1);
+      Teuchos::RCP<const Epetra_BlockMap> oneDimensionalOverlapMap = discretization->getGlobalOverlapMap(1);
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> globalNeighborhoodData = discretization->getNeighborhoodData();
+
+      vector<int> myGlobalElements(3*oneDimensionalMap->NumMyElements());
+      for(int iElem=0 ; iElem<oneDimensionalMap->NumMyElements() ; ++iElem){
+        for(int dof=0 ; dof<3 ; ++dof)
+          myGlobalElements[3*iElem + dof] = 3*oneDimensionalMap->GID(iElem) + dof;
+      }
+      tangentMap = Teuchos::rcp(new Epetra_Map(3*oneDimensionalMap->NumGlobalElements(), static_cast<int>(myGlobalElements.size()), &myGlobalElements[0], 0, oneDimensionalMap->Comm()));
+      tangent = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, *tangentMap, 0, false));
+
+      map<int, std::unordered_set<int> > rowEntries;
+      const int* neighborhoodList = globalNeighborhoodData->NeighborhoodList();
+      int neighborhoodListIndex = 0;
+      vector<int> globalIndices;
+      for(int LID=0 ; LID<globalNeighborhoodData->NumOwnedPoints() ; ++LID){
+        int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+        globalIndices.resize(3*(numNeighbors+1));
+        for(int dof=0 ; dof<3 ; ++dof)
+          globalIndices[dof] = 3*oneDimensionalOverlapMap->GID(LID) + dof;
+        for(int j=0 ; j<numNeighbors ; ++j){
+          int neighborGlobalID = oneDimensionalOverlapMap->GID(neighborhoodList[neighborhoodListIndex++]);
+          for(int dof=0 ; dof<3 ; ++dof)
+            globalIndices[3*j + 3 + dof] = 3*neighborGlobalID + dof;
+        }
+        for(unsigned int i=0 ; i<globalIndices.size() ; ++i)
+          rowEntries[globalIndices[i]].insert(globalIndices.begin(), globalIndices.end());
+      }
+
+      vector<int> indices;
+      vector<double> zeros;
+      for(map<int, std::unordered_set<int> >::iterator rowEntry=rowEntries.begin() ; rowEntry!=rowEntries.end() ; ++rowEntry){
+        indices.assign(rowEntry->second.begin(), rowEntry->second.end());
+        sort(indices.begin(), indices.end());
+        zeros.resize(indices.size(), 0.0);
+        int err = tangent->InsertGlobalValues(rowEntry->first, static_cast<int>(indices.size()), &zeros[0], &indices[0]);
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** BenchmarkProblem::allocateJacobian(), InsertGlobalValues() returned negative error code.\n");
+      }
+      int err = tangent->GlobalAssemble();
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** BenchmarkProblem::allocateJacobian(), GlobalAssemble() returned nonzero error code.\n");
+      jacobian = Teuchos::rcp(new PeridigmNS::SerialMatrix(tangent));
+    }
+
+    Teuchos::RCP<PeridigmNS::Discretization> discretization;
+    Teuchos::RCP<PeridigmNS::Block> block;
+    Teuchos::RCP<Epetra_Map> tangentMap;
+    Teuchos::RCP<Epetra_FECrsMatrix> tangent;
+    Teuchos::RCP<PeridigmNS::SerialMatrix> jacobian;
+  };
+
+  //! Times repeated calls to the given kernel; the first call is a warm-up and is not timed.
+  template<class Kernel>
+  Result timeKernel(const Epetra_Comm& comm, BenchmarkProblem& problem, Kernel kernel, int repetitions,
+                    const string& model, const string& kernelName, double horizonRatio){
+    kernel(problem);
+    vector<double> times(repetitions);
+    for(int rep=0 ; rep<repetitions ; ++rep){
+      comm.Barrier();
+      double start = now();
+      kernel(problem);
+      double localTime = now() - start;
+      // The slowest processor determines the time for each repetition
+      comm.MaxAll(&localTime, &times[rep], 1);
+    }
+    sort(times.begin(), times.end());
+
+    Result result;
+    result.model = model;
+    result.kernel = kernelName;
+    result.horizonRatio = horizonRatio;
+    result.repetitions = repetitions;
+    result.minTime = times.front();
+    result.medianTime = times[repetitions/2];
+    long long localCounts[3] = { problem.numPoints(), problem.numBonds(), problem.dataBytes() };
+    long long globalCounts[3];
+    comm.SumAll(localCounts, globalCounts, 3);
+    result.points = globalCounts[0];
+    result.bonds = globalCounts[1];
+    result.bytes = globalCounts[2];
+    return result;
+  }
+
+  void computeForce(BenchmarkProblem& problem) { problem.computeForce(); }
+  void computeJacobian(BenchmarkProblem& problem) { problem.computeJacobian(); }
+  void computeDamage(BenchmarkProblem& problem) { problem.computeDamage(); }
+
+  //! Parses a comma-separated list of values.
+  vector<double> parseList(const string& list){
+    vector<double> values;
+    stringstream ss(list);
+    string item;
+    while(getline(ss, item, ',')){
+      if(!item.empty())
+        values.push_back(atof(item.c_str()));
+    }
+    return values;
+  }
+
+  void printResult(ostream& out, const Result& result){
+    out.width(40); out << left << result.model;
+    out.width(18); out << left << result.kernel;
+    out.width(8); out << right << result.horizonRatio;
+    out.width(12); out << right << result.points;
+    out.width(14); out << right << result.bonds;
+    out.width(14); out << right << result.minTime;
+    out.width(14); out << right << result.medianTime;
+    out.width(14); out << right << result.bonds/result.medianTime;
+    out.width(12); out << right << 1.0e-9*result.bytes/result.medianTime;
+    out << endl;
+  }
+
+  void writeJson(const string& fileName, int numProcs, const vector<Result>& results){
+    ofstream out(fileName.c_str());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!out.is_open(), "\n**** Error, unable to open benchmark output file " + fileName + "\n");
+    out.precision(9);
+    out << "{\n  \"benchmark\": \"PeridigmMaterialBenchmark\",\n  \"processors\": " << numProcs << ",\n  \"results\": [";
+    for(unsigned int i=0 ; i<results.size() ; ++i){
+      const Result& r = results[i];
+      out << (i == 0 ? "\n" : ",\n");
+      out << "    {\"model\": \"" << r.model << "\", \"kernel\": \"" << r.kernel << "\""
+          << ", \"horizon_ratio\": " << r.horizonRatio
+          << ", \"points\": " << r.points
+          << ", \"bonds\": " << r.bonds
+          << ", \"repetitions\": " << r.repetitions
+          << ", \"min_seconds\": " << r.minTime
+          << ", \"median_seconds\": " << r.medianTime
+          << ", \"bonds_per_second\": " << r.bonds/r.medianTime
+          << ", \"gigabytes_per_second\": " << 1.0e-9*r.bytes/r.medianTime << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+}
+
+int main(int argc, char *argv[]) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv, NULL);
+
+#ifdef HAVE_MPI
+  Teuchos::RCP<const Epetra_Comm> comm = Teuchos::rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+  Teuchos::RCP<const Epetra_Comm> comm = Teuchos::rcp(new Epetra_SerialComm);
+#endif
+
+  int pointsPerSide = 24;
+  int jacobianPointsPerSide = 6;
+  int repetitions = 10;
+  int jacobianRepetitions = 3;
+  string horizonRatios = "2.015,3.015";
+  string modelFilter;
+  string jsonFileName;
+  bool benchmarkJacobian = true;
+
+  Teuchos::CommandLineProcessor clp;
+  clp.setDocString("Times the force, Jacobian, and damage kernels of the material and damage models on QuickGrid discretizations with unit spacing.");
+  clp.setOption("points", &pointsPerSide, "Number of points along each side of the grid.");
+  clp.setOption("jacobian-points", &jacobianPointsPerSide, "Number of points along each side of the grid used for Jacobian evaluations.");
+  clp.setOption("repetitions", &repetitions, "Number of timed calls to the force and damage kernels.");
+  clp.setOption("jacobian-repetitions", &jacobianRepetitions, "Number of timed calls to the Jacobian kernel.");
+  clp.setOption("horizon-ratios", &horizonRatios, "Comma-separated list of ratios of horizon to grid spacing.");
+  clp.setOption("model", &modelFilter, "Benchmark only the material or damage model with this name.");
+  clp.setOption("json", &jsonFileName, "File to which the results are written in JSON format.");
+  clp.setOption("jacobian", "no-jacobian", &benchmarkJacobian, "Benchmark the Jacobian kernel.");
+  Teuchos::CommandLineProcessor::EParseCommandLineReturn parseReturn = clp.parse(argc, argv);
+  if(parseReturn == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED)
+    return 0;
+  if(parseReturn != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL)
+    return 1;
+
+  vector<double> ratios = parseList(horizonRatios);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(ratios.empty(), "\n**** Error, no horizon ratios given.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(repetitions < 1 || jacobianRepetitions < 1, "\n**** Error, the number of repetitions must be positive.\n");
+
+  bool printResults = (comm->MyPID() == 0);
+  if(printResults){
+    cout << "Peridigm material benchmark, " << comm->NumProc() << " processor(s)\n" << endl;
+    cout.width(40); cout << left << "Model";
+    cout.width(18); cout << left << "Kernel";
+    cout.width(8); cout << right << "Ratio";
+    cout.width(12); cout << right << "Points";
+    cout.width(14); cout << right << "Bonds";
+    cout.width(14); cout << right << "Min (s)";
+    cout.width(14); cout << right << "Median (s)";
+    cout.width(14); cout << right << "Bonds/s";
+    cout.width(12); cout << right << "GB/s";
+    cout << endl;
+    cout.precision(4);
+  }
+
+  vector<Result> results;
+  vector<Teuchos::ParameterList> materials = materialParameters();
+  vector<Teuchos::ParameterList> damageModels = damageParameters();
+  Teuchos::ParameterList& elastic = materials.front();
+
+  for(unsigned int iRatio=0 ; iRatio<ratios.size() ; ++iRatio){
+    double ratio = ratios[iRatio];
+
+    for(unsigned int iMat=0 ; iMat<materials.size() ; ++iMat){
+      string name = materials[iMat].get<string>("Material Model");
+      if(!modelFilter.empty() && modelFilter != name)
+        continue;
+      {
+        BenchmarkProblem problem(comm, pointsPerSide, ratio, materials[iMat], 0);
+        results.push_back(timeKernel(*comm, problem, computeForce, repetitions, name, "computeForce", ratio));
+        if(printResults) printResult(cout, results.back());
+      }
+      if(benchmarkJacobian){
+        BenchmarkProblem problem(comm, jacobianPointsPerSide, ratio, materials[iMat], 0);
+        results.push_back(timeKernel(*comm, problem, computeJacobian, jacobianRepetitions, name, "computeJacobian", ratio));
+        if(printResults) printResult(cout, results.back());
+      }
+    }
+
+    // Damage models are evaluated on blocks of the elastic material
+    for(unsigned int iDamage=0 ; iDamage<damageModels.size() ; ++iDamage){
+      string name = damageModels[iDamage].get<string>("Damage Model");
+      if(!modelFilter.empty() && modelFilter != name)
+        continue;
+      BenchmarkProblem problem(comm, pointsPerSide, ratio, elastic, &damageModels[iDamage]);
+      results.push_back(timeKernel(*comm, problem, computeDamage, repetitions, name, "computeDamage", ratio));
+      if(printResults) printResult(cout, results.back());
+    }
+  }
+
+  if(printResults && !jsonFileName.empty())
+    writeJson(jsonFileName, comm->NumProc(), results);
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+/*! \file Peridigm_Compute_Return_Mapping_Statistics.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+#include <vector>
+
+#include "Peridigm_Compute_Return_Mapping_Statistics.hpp"
+#include "Peridigm_Field.hpp"
+
+PeridigmNS::Compute_Return_Mapping_Statistics::Compute_Return_Mapping_Statistics(Teuchos::RCP<const Teuchos::ParameterList> params,
+                                                                                 Teuchos::RCP<const Epetra_Comm> epetraComm_,
+                                                                                 Teuchos::RCP<const Teuchos::ParameterList> computeClassGlobalData_)
+  : Compute(params, epetraComm_, computeClassGlobalData_), m_returnMappingIterationsFieldId(-1), m_returnMappingPointsFieldId(-1),
+    m_totalReturnMappingIterationsFieldId(-1), m_maxReturnMappingIterationsFieldId(-1),
+    m_returnMappingFailureFieldId(-1), m_returnMappingFailuresFieldId(-1)
+{
+  FieldManager& fieldManager = FieldManager::self();
+  m_returnMappingIterationsFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Iterations");
+  m_returnMappingPointsFieldId = fieldManager.getFieldId(PeridigmField::GLOBAL, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Points");
+  m_totalReturnMappingIterationsFieldId = fieldManager.getFieldId(PeridigmField::GLOBAL, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Total_Return_Mapping_Iterations");
+  m_maxReturnMappingIterationsFieldId = fieldManager.getFieldId(PeridigmField::GLOBAL, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Max_Return_Mapping_Iterations");
+  m_returnMappingFailureFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Failure");
+  m_returnMappingFailuresFieldId = fieldManager.getFieldId(PeridigmField::GLOBAL, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Failures");
+  m_fieldIds.push_back(m_returnMappingIterationsFieldId);
+  m_fieldIds.push_back(m_returnMappingPointsFieldId);
+  m_fieldIds.push_back(m_totalReturnMappingIterationsFieldId);
+  m_fieldIds.push_back(m_maxReturnMappingIterationsFieldId);
+  m_fieldIds.push_back(m_returnMappingFailureFieldId);
+  m_fieldIds.push_back(m_returnMappingFailuresFieldId);
+}
+
+PeridigmNS::Compute_Return_Mapping_Statistics::~Compute_Return_Mapping_Statistics(){}
+
+int PeridigmNS::Compute_Return_Mapping_Statistics::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+
+  // Blocks whose material does not solve a return mapping leave the iteration and failure fields at zero
+  double localData[3] = {0.0, 0.0, 0.0};
+  double localMax = 0.0;
+
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    const int numOwnedPoints = blockIt->getNeighborhoodData()->NumOwnedPoints();
+    double *iterations, *failure;
+    blockIt->getData(m_returnMappingIterationsFieldId, PeridigmField::STEP_NONE)->ExtractView(&iterations);
+    blockIt->getData(m_returnMappingFailureFieldId, PeridigmField::STEP_NONE)->ExtractView(&failure);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      if(iterations[i] > 0.0){
+        localData[0] += 1.0;
+        localData[1] += iterations[i];
+        if(iterations[i] > localMax)
+          localMax = iterations[i];
+      }
+      localData[2] += failure[i];
+    }
+  }
+
+  double globalData[3], globalMax;
+  epetraComm->SumAll(&localData[0], &globalData[0], 3);
+  epetraComm->MaxAll(&localMax, &globalMax, 1);
+
+  (*(blocks->begin()->getData(m_returnMappingPointsFieldId, PeridigmField::STEP_NONE)))[0] = globalData[0];
+  (*(blocks->begin()->getData(m_totalReturnMappingIterationsFieldId, PeridigmField::STEP_NONE)))[0] = globalData[1];
+  (*(blocks->begin()->getData(m_maxReturnMappingIterationsFieldId, PeridigmField::STEP_NONE)))[0] = globalMax;
+  (*(blocks->begin()->getData(m_returnMappingFailuresFieldId, PeridigmField::STEP_NONE)))[0] = globalData[2];
+
+  return 0;
+}
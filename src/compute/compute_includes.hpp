@@ -13,6 +13,7 @@
 #include "Peridigm_Compute_Force.hpp"
 #include "Peridigm_Compute_Radius.hpp"
 #include "Peridigm_Compute_Number_Of_Neighbors.hpp"
+#include "Peridigm_Compute_Block_Cost.hpp"
 #include "Peridigm_Compute_Neighborhood_Volume.hpp"
 #include "Peridigm_Compute_Nearest_Point_Data.hpp"
 #include "Peridigm_Compute_Block_Data.hpp"
@@ -21,5 +22,6 @@
 #include "Peridigm_Compute_Stored_Elastic_Energy_Density.hpp"
 #include "Peridigm_Compute_Stored_Elastic_Energy.hpp"
 #include "Peridigm_Compute_Nonlinear_Solver_Iterations.hpp"
+#include "Peridigm_Compute_Return_Mapping_Statistics.hpp"
 #include "Peridigm_Compute_OBC_Functional.hpp"
 #include "Peridigm_Compute.hpp"
@@ -51,7 +51,9 @@
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Epetra_Vector.h>
+#include <Teuchos_Assert.hpp>
 #include "Peridigm_DataManager.hpp"
+#include "Peridigm_HalfNeighborList.hpp"
 
 namespace PeridigmNS {
 
@@ -80,6 +82,14 @@ namespace PeridigmNS {
                  const int* contactNeighborhoodList,
                  PeridigmNS::DataManager& dataManager) const = 0;
 
+	//! Evaluate the forces on the cells from a half neighbor list, in which each pair of owned cells appears once.
+	virtual void
+	computeForce(const double dt,
+                 const PeridigmNS::HalfNeighborList& halfNeighborList,
+                 PeridigmNS::DataManager& dataManager) const {
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n**** Error, contact model " + Name() + " does not support half neighbor lists.\n");
+    }
+
     virtual void 
     evaluateParserFriction(double & currentValue, double & previousValue, const double & timeCurrent=0.0, const double & timePrevious=0.0) = 0;          
            
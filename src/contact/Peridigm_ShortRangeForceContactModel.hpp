@@ -75,10 +75,25 @@ namespace PeridigmNS {
                  const int* contactNeighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the forces on the cells, visiting each pair of owned cells once.
+    virtual void
+    computeForce(const double dt,
+                 const PeridigmNS::HalfNeighborList& halfNeighborList,
+                 PeridigmNS::DataManager& dataManager) const;
+
     virtual void 
     evaluateParserFriction(double & currentValue, double & previousValue, const double & timeCurrent=0.0, const double & timePrevious=0.0);               
 
   protected:
+
+    //! Adds the forces between a cell and a neighbor within the contact radius, given the spring constant factor c.
+    void computePairForce(const int nodeID,
+                          const int neighborID,
+                          const double c,
+                          const double* y,
+                          const double* velocity,
+                          const double* cellVolume,
+                          double* contactForce) const;
 	
 	//! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
 	inline double distance(double a1, double a2, double a3,
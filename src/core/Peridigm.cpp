@@ -59,6 +59,9 @@
 #include <unordered_set>
 #include <iterator>
 #include <cmath>
+#include <algorithm>
+#include <mutex>
+#include <limits>
 
 #include "Peridigm_Field.hpp"
 #include "Peridigm_HorizonManager.hpp"
@@ -70,6 +73,9 @@
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_CriticalTimeStep.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
+#include "Peridigm_Telemetry.hpp"
 #include "Peridigm_MaterialFactory.hpp"
 #include "Peridigm_DamageModelFactory.hpp"
 #include "Peridigm_InterfaceAwareDamageModel.hpp"
@@ -132,7 +138,8 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     fluidFlowDensityFieldId(-1),
     numMechanicsDoFs(0),
     numDiffusionDoFs(0),
-    numMultiphysDoFs(0)
+    numMultiphysDoFs(0),
+    startupTime(0.0)
 {
 #ifdef HAVE_MPI
   peridigmComm = Teuchos::rcp(new Epetra_MpiComm(comm));
@@ -146,10 +153,63 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
 		  exit(0);
 	  }
   peridigmParams = params;
+
+  // Record a timeline of the timed regions, if requested
+  if(peridigmParams->isSublist("Performance Trace")){
+    Teuchos::ParameterList& traceParams = peridigmParams->sublist("Performance Trace");
+    string traceFileName = traceParams.get<string>("Output Filename", "trace");
+    int traceFirstStep = traceParams.get<int>("Initial Step", 0);
+    int traceLastStep = traceParams.get<int>("Final Step", std::numeric_limits<int>::max());
+    int traceBufferSize = traceParams.get<int>("Buffer Size", 1000000);
+    // Synchronize so that the per-processor traces share a common time origin
+    peridigmComm->Barrier();
+    PeridigmNS::Timer::self().enableTrace(traceFileName, traceFirstStep, traceLastStep, traceBufferSize, peridigmComm->MyPID());
+  }
+
+  // Timing data written in JSON format at the end of the run
+  if(peridigmParams->isSublist("Timing Data")){
+    Teuchos::ParameterList& timingDataParams = peridigmParams->sublist("Timing Data");
+    PeridigmNS::Timer::self().setTimingDataFile(timingDataParams.get<string>("Output Filename", "timing.json"));
+  }
+
+  // Stream of progress and throughput records; a run whose telemetry output cannot be opened proceeds without it
+  if(peridigmParams->isSublist("Telemetry")){
+    Teuchos::ParameterList& telemetryParams = peridigmParams->sublist("Telemetry");
+    string telemetryFileName = telemetryParams.get<string>("Output Filename", "telemetry.json");
+    string telemetrySocket = telemetryParams.get<string>("Socket", "");
+    int telemetryFrequency = telemetryParams.get<int>("Frequency", 100);
+    string telemetryMessage;
+    bool telemetryEnabled = PeridigmNS::Telemetry::self().enable(telemetryFileName, telemetrySocket, telemetryFrequency, peridigmComm->MyPID(), telemetryMessage);
+    if(peridigmComm->MyPID() == 0 && !telemetryEnabled)
+      cout << "\nWarning:  telemetry disabled, " << telemetryMessage << ".\n" << endl;
+  }
+
+  // Hardware performance counters; a run without counter support proceeds without them
+  if(peridigmParams->isSublist("Performance Counters")){
+    string counterMessage;
+    bool countersEnabled = PeridigmNS::PerformanceCounters::self().enable(counterMessage);
+    if(peridigmComm->MyPID() == 0 && !counterMessage.empty()){
+      if(countersEnabled)
+        cout << "\nWarning:  hardware performance counters, " << counterMessage << ".\n" << endl;
+      else
+        cout << "\nWarning:  hardware performance counters are disabled, " << counterMessage << ".\n" << endl;
+    }
+  }
+
+  // Communication volume statistics, optionally written for each step to a file on each processor
+  if(peridigmParams->isSublist("Communication Statistics")){
+    string communicationFileName = peridigmParams->sublist("Communication Statistics").get<string>("Output Filename", "");
+    PeridigmNS::CommunicationMonitor::self().enable(communicationFileName, peridigmComm->MyPID());
+  }
+
   // set the comm for memory use statistics
   Memstat * memstat = Memstat::Instance();
   memstat->setComm(peridigmComm);
 
+  // Each phase of the initialization is timed beneath the Initialization timer and reported by printStartupProfile()
+  startupBegin = std::chrono::steady_clock::now();
+  PeridigmNS::Timer::self().startTimer("Initialization");
+
   // Tracker for recording the total number of iterations taken by the nonlinear solver
   nonlinearSolverIterations = Teuchos::rcp(new int);
   *nonlinearSolverIterations = 0;
@@ -179,7 +239,11 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
  }
 
   // Initialize the influence function
+  beginStartupPhase("Horizon Manager");
   string influenceFunctionString = peridigmParams->sublist("Discretization").get<string>("Influence Function", "One");
+  int influenceFunctionTableSize = peridigmParams->sublist("Discretization").get<int>("Influence Function Table Size", 0);
+  string influenceFunctionInterpolation = peridigmParams->sublist("Discretization").get<string>("Influence Function Interpolation", "Cubic");
+  PeridigmNS::InfluenceFunction::self().setTableParameters( influenceFunctionTableSize, influenceFunctionInterpolation );
   PeridigmNS::InfluenceFunction::self().setInfluenceFunction( influenceFunctionString );
 
   // Read mesh from disk or generate using geometric primatives.
@@ -203,6 +267,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   Teuchos::ParameterList& blockParams = peridigmParams->sublist("Blocks", true);
   PeridigmNS::HorizonManager& horizonManager = PeridigmNS::HorizonManager::self();
   horizonManager.loadHorizonInformationFromBlockParameters(blockParams);
+  endStartupPhase();
 
   // Create a list containing parameters for each solver
   for (Teuchos::ParameterList::ConstIterator it = peridigmParams->begin(); it != peridigmParams->end(); ++it) {
@@ -251,10 +316,14 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   // If not, create one based on the Discretization ParameterList in the input deck.
   Teuchos::RCP<Discretization> peridigmDiscretization = inputPeridigmDiscretization;
   if(peridigmDiscretization.is_null()){
+    beginStartupPhase("Create Discretization");
     DiscretizationFactory discFactory(discParams);
     peridigmDiscretization = discFactory.create(peridigmComm);
+    endStartupPhase();
   }
+  beginStartupPhase("Initialize Discretization");
   initializeDiscretization(peridigmDiscretization);
+  endStartupPhase();
 
   // Instantiate and initialize the boundary and initial condition manager
   Teuchos::RCP<Teuchos::ParameterList> bcParams =
@@ -273,10 +342,27 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
       bcParams->set<bool>("Create Node Set For Rank Deficient Nodes", true);
   }
 
+  beginStartupPhase("Boundary Conditions");
   boundaryAndInitialConditionManager =
     Teuchos::RCP<BoundaryAndInitialConditionManager>(new BoundaryAndInitialConditionManager(*bcParams, this));
 
   boundaryAndInitialConditionManager->initialize(peridigmDiscretization);
+  endStartupPhase();
+
+  // Timer ids for the solver loops
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  gatherScatterTimerId         = timer.getTimerId("Gather/Scatter");
+  internalForceTimerId         = timer.getTimerId("Internal Force");
+  applyKinematicBCTimerId      = timer.getTimerId("Apply Kinematic B.C.");
+  applyBodyForcesTimerId       = timer.getTimerId("Apply Body Forces");
+  outputTimerId                = timer.getTimerId("Output");
+  dataLoaderTimerId            = timer.getTimerId("Data Loader");
+  evaluateJacobianTimerId      = timer.getTimerId("Evaluate Jacobian");
+  solveLinearSystemTimerId     = timer.getTimerId("Solve Linear System");
+  computeResidualTimerId       = timer.getTimerId("Compute Residual");
+  lineSearchTimerId            = timer.getTimerId("Line Search");
+  rebalanceTimerId             = timer.getTimerId("Rebalance");
+  invert3x3BlockTangentTimerId = timer.getTimerId("Invert 3x3 Block Tangent");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   elementIdFieldId                   = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Element_Id");
@@ -309,6 +395,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   // Instantiate the contact manager
   Teuchos::ParameterList contactParams;
   if(peridigmParams->isSublist("Contact")){
+    beginStartupPhase("Contact Setup");
     analysisHasContact = true;
     contactParams = peridigmParams->sublist("Contact");
     checkContactSearchRadius(contactParams,peridigmDiscretization);
@@ -348,6 +435,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
             New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
         }
     }
+    endStartupPhase();
   }
 
   // Instantiate the data loader, if requested
@@ -358,6 +446,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   }
 
   // Instantiate the blocks
+  beginStartupPhase("Create Blocks and Models");
   initializeBlocks(peridigmDiscretization);
 
   // Determine a default finite-difference probe length
@@ -439,8 +528,12 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     }
   }
 
+  endStartupPhase();
+  beginStartupPhase("Create Compute Classes");
+
   // Instantiate compute manager
   instantiateComputeManager(peridigmDiscretization);
+  endStartupPhase();
 
   // Load the auxiliary field ids into the blocks (they will be
   // combined with material model and damage model ids when allocating
@@ -496,6 +589,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     blockIt->setAuxiliaryFieldIds(auxiliaryFieldIds);
 
   // Initialize the blocks (creates maps, neighborhoods, DataManager)
+  beginStartupPhase("Initialize Block Data");
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
     blockIt->initialize(peridigmDiscretization->getGlobalOwnedMap(1),
                         peridigmDiscretization->getGlobalOverlapMap(1),
@@ -526,6 +620,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
 			blockIt->importData(*scratchOneD, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
 		}
   }
+  endStartupPhase();
 
 
   // Compute element-horizon intersections
@@ -561,7 +656,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     if(discParams->isParameter("Element-Horizon Intersection Use Lookup Table"))
       useLookupTable = discParams->get<bool>("Element-Horizon Intersection Use Lookup Table");
 
-    PeridigmNS::Timer::self().startTimer("Element-Horizon Intersections");
+    beginStartupPhase("Element-Horizon Intersections");
     if(peridigmComm->MyPID() == 0){
       cout << "Computing element-horizon intersections, scheme = " << partialVolumeSchemeString << endl;
       cout.flush();
@@ -577,7 +672,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
       cout << "\n  Intersection calculations complete.\n" << endl;
       cout.flush();
     }
-    PeridigmNS::Timer::self().stopTimer("Element-Horizon Intersections");
+    endStartupPhase();
   }
 #endif
 
@@ -675,19 +770,23 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   }
 
   // apply initial conditions
-  PeridigmNS::Timer::self().startTimer("Apply Initial Conditions");
+  beginStartupPhase("Apply Initial Conditions");
   boundaryAndInitialConditionManager->applyInitialConditions();
-  PeridigmNS::Timer::self().stopTimer("Apply Initial Conditions");
+  endStartupPhase();
 
   // Initialize material models and damage models
   // Initialization functions require valid initial values, e.g. velocities and displacements.
+  beginStartupPhase("Initialize Material Models");
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++) {
     blockIt->initializeMaterialModel();
     blockIt->initializeDamageModel();
   }
+  endStartupPhase();
 
   // Initialize the compute classes
+  beginStartupPhase("Initialize Compute Classes");
   computeManager->initialize(blocks);
+  endStartupPhase();
 
   // Initialize the workset
   initializeWorkset();
@@ -696,12 +795,17 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   modelEvaluator = Teuchos::rcp(new PeridigmNS::ModelEvaluator());
 
   // Initialize output manager
+  beginStartupPhase("Initialize Output Manager");
   initializeOutputManager();
+  endStartupPhase();
 
   // Call rebalance function if analysis has contact
   // this is required to set up proper contact neighbor list
-  if(analysisHasContact)
+  if(analysisHasContact){
+    beginStartupPhase("Contact Rebalance");
     contactManager->rebalance(0);
+    endStartupPhase();
+  }
 
   // Create service manager
   serviceManager = Teuchos::rcp(new PeridigmNS::ServiceManager());
@@ -716,9 +820,9 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
       cout << "Allocating global tangent matrix...";
       cout.flush();
     }
-    PeridigmNS::Timer::self().startTimer("Allocate Global Tangent");
+    beginStartupPhase("Allocate Global Tangent");
     allocateJacobian(numMechanicsDoFs + numDiffusionDoFs + numMultiphysDoFs);
-    PeridigmNS::Timer::self().stopTimer("Allocate Global Tangent");
+    endStartupPhase();
     if(peridigmComm->MyPID() == 0){
       cout << "\n  number of rows = " << tangent->NumGlobalRows() << endl;
       if(numMultiphysDoFs > 0)
@@ -735,7 +839,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
       cout << "Allocating global block diagonal tangent matrix...";
       cout.flush();
     }
-    PeridigmNS::Timer::self().startTimer("Allocate Global Block Diagonal Tangent");
+    beginStartupPhase("Allocate Global Block Diagonal Tangent");
     allocateBlockDiagonalJacobian();
     // If both the full tangent and the block diagonal tangent are flagged for allocation,
     // only the full tangent is allocated and the block diagonal just points to the full tangent.
@@ -743,7 +847,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     // be set to the block diagonal tangent so that the block diagonal tangent gets filled.
     tangentMap = blockDiagonalTangentMap;
     tangent = blockDiagonalTangent;
-    PeridigmNS::Timer::self().stopTimer("Allocate Global Block Diagonal Tangent");
+    endStartupPhase();
     if(peridigmComm->MyPID() == 0 && !allocateTangent){
       cout << "\n  number of rows = " << blockDiagonalTangent->NumGlobalRows() << endl;
       cout << "  number of nonzeros = " << blockDiagonalTangent->NumGlobalNonzeros() << "\n" << endl;
@@ -753,8 +857,82 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   }
   //Initialize restart if requested in the input file
   if(peridigmParams->isParameter("Restart")){
+    beginStartupPhase("Initialize Restart");
 	 InitializeRestart();
+    endStartupPhase();
   }
+
+  PeridigmNS::Timer::self().stopTimer("Initialization");
+  startupTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startupBegin).count();
+
+  // Report memory use and the cost of each phase at the end of initialization
+  memstat->addStat("Initialized");
+  printMemoryStats();
+  printStartupProfile();
+}
+
+void PeridigmNS::Peridigm::beginStartupPhase(const std::string& name){
+  startupPhases.push_back(StartupPhase(name));
+  StartupPhase& phase = startupPhases.back();
+  // The starting memory use is held in the change fields until the phase ends
+  phase.rssChange = -Memstat::residentSetSize();
+  phase.peakRssChange = -Memstat::peakResidentSetSize();
+  PeridigmNS::Timer::self().startTimer(name);
+  phase.start = std::chrono::steady_clock::now();
+}
+
+void PeridigmNS::Peridigm::endStartupPhase(){
+  StartupPhase& phase = startupPhases.back();
+  phase.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - phase.start).count();
+  PeridigmNS::Timer::self().stopTimer(phase.name);
+  phase.rssChange += Memstat::residentSetSize();
+  phase.peakRssChange += Memstat::peakResidentSetSize();
+}
+
+void PeridigmNS::Peridigm::registerMemoryUse(){
+
+  long long neighborhoodBytes = 0;
+  long long pointDataBytes = 0;
+  long long bondDataBytes = 0;
+  if(!globalNeighborhoodData.is_null())
+    neighborhoodBytes += globalNeighborhoodData->memoryBytes();
+  if(!blocks.is_null()){
+    for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+      if(!blockIt->getNeighborhoodData().is_null())
+        neighborhoodBytes += blockIt->getNeighborhoodData()->memoryBytes();
+      if(!blockIt->getDataManager().is_null()){
+        pointDataBytes += blockIt->getDataManager()->pointDataBytes();
+        bondDataBytes += blockIt->getDataManager()->bondDataBytes();
+      }
+    }
+  }
+
+  long long mothershipBytes = 0;
+  Teuchos::RCP<Epetra_MultiVector> motherships[3] = {oneDimensionalMothership, threeDimensionalMothership, nDimensionalMothership};
+  for(int i=0 ; i<3 ; ++i){
+    if(!motherships[i].is_null())
+      mothershipBytes += (long long)(motherships[i]->MyLength())*motherships[i]->NumVectors()*sizeof(double);
+  }
+
+  // Estimate of the storage for the values and column indices of the tangent; when only the
+  // block diagonal tangent is allocated, tangent points to the same matrix
+  long long tangentBytes = 0;
+  if(!tangent.is_null())
+    tangentBytes += (long long)(tangent->NumMyNonzeros())*(sizeof(double) + sizeof(int)) + (long long)(tangent->NumMyRows())*sizeof(int);
+  if(!blockDiagonalTangent.is_null() && blockDiagonalTangent.get() != tangent.get())
+    tangentBytes += (long long)(blockDiagonalTangent->NumMyNonzeros())*(sizeof(double) + sizeof(int)) + (long long)(blockDiagonalTangent->NumMyRows())*sizeof(int);
+
+  long long contactBytes = 0;
+  if(analysisHasContact && !contactManager.is_null())
+    contactBytes = contactManager->memoryBytes();
+
+  PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
+  memstat->setSubsystemBytes("Neighborhood Data", neighborhoodBytes);
+  memstat->setSubsystemBytes("Point Data", pointDataBytes);
+  memstat->setSubsystemBytes("Bond Data", bondDataBytes);
+  memstat->setSubsystemBytes("Mothership Vectors", mothershipBytes);
+  memstat->setSubsystemBytes("Tangent Matrix", tangentBytes);
+  memstat->setSubsystemBytes("Contact Data", contactBytes);
 }
 
 void PeridigmNS::Peridigm::checkContactSearchRadius(const Teuchos::ParameterList& contactParams, Teuchos::RCP<Discretization> peridigmDisc){
@@ -1333,7 +1511,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   //     (*y)[i] += (*u)[i];
 
   // Copy data from mothership vectors to overlap vectors in data manager
-  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
     blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
     blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1343,25 +1521,41 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   }
   if(analysisHasContact)
     contactManager->importData(volume, y, v);
-  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
   // Load the data manager with data from disk, if requested
   if(analysisHasDataLoader){
-    PeridigmNS::Timer::self().startTimer("Data Loader");
+    PeridigmNS::Timer::self().startTimer(dataLoaderTimerId);
     dataLoader->loadDataFromFile(1);
     dataLoader->copyDataToDataManagers(blocks);
-    PeridigmNS::Timer::self().stopTimer("Data Loader");
+    PeridigmNS::Timer::self().stopTimer(dataLoaderTimerId);
+  }
+
+  // The loaded data only needs to be copied into the data managers again prior to output if synchDataManagers() overwrites it
+  bool dataLoaderFieldIsSynchronized = false;
+  if(analysisHasDataLoader){
+    vector<int> synchronizedFieldIds;
+    synchronizedFieldIds.push_back(temperatureFieldId);
+    synchronizedFieldIds.push_back(deltaTemperatureFieldId);
+    if(analysisHasMultiphysics){
+      synchronizedFieldIds.push_back(fluidFlowDensityFieldId);
+      synchronizedFieldIds.push_back(fluidPressureUFieldId);
+      synchronizedFieldIds.push_back(fluidPressureYFieldId);
+      synchronizedFieldIds.push_back(fluidPressureVFieldId);
+    }
+    int dataLoaderFieldId = dataLoader->getFieldIds()[0];
+    dataLoaderFieldIsSynchronized = find(synchronizedFieldIds.begin(), synchronizedFieldIds.end(), dataLoaderFieldId) != synchronizedFieldIds.end();
   }
 
   // \todo The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
   // Evaluate internal force and contact force in initial configuration for use in first timestep
-  PeridigmNS::Timer::self().startTimer("Internal Force");
+  PeridigmNS::Timer::self().startTimer(internalForceTimerId);
   modelEvaluator->evalModel(workset);
-  PeridigmNS::Timer::self().stopTimer("Internal Force");
+  PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
   // Copy force from the data manager to the mothership vector
-  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
   force->PutScalar(0.0);
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
     scratch->PutScalar(0.0);
@@ -1372,15 +1566,15 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     contactManager->exportData(contactForce);
     force->Update(1.0, *contactForce, 1.0);
   }
-  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
   // Apply BC at time zero
-  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
   boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
-  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
+  PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
   // fill the acceleration vector
   (*a) = (*force);
@@ -1389,18 +1583,26 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     (*a)[i] /= (*density)[i/3];
   }
   // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
+  PeridigmNS::Timer::self().startTimer(outputTimerId);
   synchDataManagers();
-  if(analysisHasDataLoader){
+  if(analysisHasDataLoader && dataLoaderFieldIsSynchronized){
     dataLoader->copyDataToDataManagers(blocks);
   }
-  outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  {
+    // Exodus calls must not overlap with the data loader's background reads
+    std::unique_lock<std::mutex> exodusLock(DataLoader::exodusMutex(), std::defer_lock);
+    if(analysisHasDataLoader && dataLoader->prefetchEnabled())
+      exodusLock.lock();
+    outputManager->write(blocks, timeCurrent);
+  }
+  PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
   int displayTrigger = nsteps/100;
   if(displayTrigger == 0)
     displayTrigger = 1;
 
+  PeridigmNS::Telemetry::self().beginRun(0);
+
   Teuchos::ParameterList damageModelParams;
   if(peridigmParams->isSublist("Damage Models"))
     damageModelParams = peridigmParams->sublist("Damage Models");
@@ -1411,6 +1613,8 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
   for(int step=1; step<=nsteps; step++){
 
+    PeridigmNS::Timer::self().beginStep(step);
+
     timePrevious = timeCurrent;
     timeCurrent = timeInitial + (step*dt);
 
@@ -1432,11 +1636,11 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       displayProgress("Explicit time integration", (step-1)*100.0/nsteps);
 
     // rebalance, if requested
-    PeridigmNS::Timer::self().startTimer("Rebalance");
+    PeridigmNS::Timer::self().startTimer(rebalanceTimerId);
     // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
     if(analysisHasContact)
       contactManager->rebalance(step);
-    PeridigmNS::Timer::self().stopTimer("Rebalance");
+    PeridigmNS::Timer::self().stopTimer(rebalanceTimerId);
 
     // Do one step of velocity-Verlet
 
@@ -1447,14 +1651,14 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     // Set the velocities for dof with kinematic boundary conditions.
     // This will propagate through the Verlet integrator and result in the proper
     // displacement boundary conditions on y and consistent values for v and u.
-    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
     boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
 
     // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
     // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
     // \todo Replace with blas call
@@ -1468,7 +1672,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     // \todo The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
     // Copy data from mothership vectors to overlap vectors in data manager
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
       blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
       blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1484,30 +1688,30 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       }
       contactManager->importData(volume, y, v);
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
     // Load the data manager with data from disk, if requested
     if(analysisHasDataLoader){
-      PeridigmNS::Timer::self().startTimer("Data Loader");
+      PeridigmNS::Timer::self().startTimer(dataLoaderTimerId);
       dataLoader->loadDataFromFile(step);
       dataLoader->copyDataToDataManagers(blocks);
-      PeridigmNS::Timer::self().stopTimer("Data Loader");
+      PeridigmNS::Timer::self().stopTimer(dataLoaderTimerId);
     }
 
     // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
+    PeridigmNS::Timer::self().startTimer(internalForceTimerId);
     modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+    PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
     // Copy force from the data manager to the mothership vector
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
     force->PutScalar(0.0);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
       scratch->PutScalar(0.0);
       blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
       force->Update(1.0, *scratch, 1.0);
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
     // Check for NaNs in force evaluation
     // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
@@ -1539,18 +1743,30 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
     blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
 
-    PeridigmNS::Timer::self().startTimer("Output");
+    PeridigmNS::Timer::self().startTimer(outputTimerId);
     synchDataManagers();
-    if(analysisHasDataLoader){
+    if(analysisHasDataLoader && dataLoaderFieldIsSynchronized){
       dataLoader->copyDataToDataManagers(blocks);
     }
-    outputManager->write(blocks, timeCurrent);
-    PeridigmNS::Timer::self().stopTimer("Output");
+    {
+      std::unique_lock<std::mutex> exodusLock(DataLoader::exodusMutex(), std::defer_lock);
+      if(analysisHasDataLoader && dataLoader->prefetchEnabled())
+        exodusLock.lock();
+      outputManager->write(blocks, timeCurrent);
+    }
+    PeridigmNS::Timer::self().stopTimer(outputTimerId);
+
+    recordTelemetry(step, nsteps, timeCurrent, dt);
 
     // swap state N and state NP1
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
       blockIt->updateState();
   }
+
+  // Stop reading ahead, the Exodus calls made by other solvers and by the output manager destructor are not guarded
+  if(analysisHasDataLoader)
+    dataLoader->finishPrefetching();
+
   displayProgress("Explicit time integration", 100.0);
   *out << "\n\n";
 }
@@ -1575,7 +1791,7 @@ bool PeridigmNS::Peridigm::computePreconditioner(const Epetra_Vector& x, Epetra_
   evaluateNOX(NOX::Epetra::Interface::Required::Jac, &x, NULL);
 
   // Invert the 3x3 block tangent
-  PeridigmNS::Timer::self().startTimer("Invert 3x3 Block Tangent");
+  PeridigmNS::Timer::self().startTimer(invert3x3BlockTangentTimerId);
   TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent->NumMyRows()%3 != 0, "****Error in Peridigm::computePreconditioner(), invalid number of rows.\n");
   int numEntries, err;
   double *valuesRow1, *valuesRow2, *valuesRow3;
@@ -1604,7 +1820,7 @@ bool PeridigmNS::Peridigm::computePreconditioner(const Epetra_Vector& x, Epetra_
       valuesRow3[i] = inverse[6+i];
     }
   }
-  PeridigmNS::Timer::self().stopTimer("Invert 3x3 Block Tangent");
+  PeridigmNS::Timer::self().stopTimer(invert3x3BlockTangentTimerId);
 
   return true;
 }
@@ -1671,7 +1887,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
 
   // Copy data from mothership vectors to overlap vectors in data manager
   if(analysisHasMultiphysics){
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
         blockIt->importData(*fluidPressureU, fluidPressureUFieldId, PeridigmField::STEP_NP1, Insert);
         blockIt->importData(*fluidPressureY, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1682,10 +1898,10 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
         blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
         blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
   }
   else{
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
         blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
         blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1693,17 +1909,17 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
         blockIt->importData(*temperature, temperatureFieldId, PeridigmField::STEP_NP1, Insert);
         blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
   }
 
   if(fillF){
     // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
+    PeridigmNS::Timer::self().startTimer(internalForceTimerId);
     modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+    PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
     if(analysisHasMultiphysics){
-    	PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    	PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
       combinedForce->PutScalar(0.0);
     	for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
       		scratch->PutScalar(0.0);
@@ -1729,7 +1945,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
     }
     else {
 	    // Copy force from the data manager to the mothership vector
-	    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+	    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
 	    force->PutScalar(0.0);
 	    
 	    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -1743,7 +1959,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
 	    scratchOneD->PutScalar(0.0);
     }
 
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
     // Create residual vector
     Teuchos::RCP<Epetra_Vector> residual = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
@@ -1782,11 +1998,11 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
   // Compute the tangent if requested
   if( fillMatrix && m_noxJacobianUpdateCounter%m_noxTriggerJacobianUpdate == 0 ){
     tangent->PutScalar(0.0);
-    PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+    PeridigmNS::Timer::self().startTimer(evaluateJacobianTimerId);
     modelEvaluator->evalJacobian(workset);
     int err = tangent->GlobalAssemble();
     TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::evaluateNOX(), GlobalAssemble() returned nonzero error code.\n");
-    PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+    PeridigmNS::Timer::self().stopTimer(evaluateJacobianTimerId);
     boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
   }
   if( fillMatrix )
@@ -2031,18 +2247,18 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
   double timePrevious = timeCurrent;
 
   // Apply BC at time zero
-  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
   boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
-  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
+  PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
   // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
+  PeridigmNS::Timer::self().startTimer(outputTimerId);
   synchDataManagers();
   outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
   // Functionality for updating the Jacobian at a user-specified interval
   // This does not appear to be available for nonlinear CG in NOX, but it's important for peridynamics, so
@@ -2056,6 +2272,8 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
 
   for(int step=1 ; step<(int)timeSteps.size() ; step++){
 
+    PeridigmNS::Timer::self().beginStep(step);
+
     loadStepCPUTime.ResetStartTime();
 
     timePrevious = timeCurrent;
@@ -2103,9 +2321,9 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
     // this map that the boundary and intial condition manager expects.  So, make sure that the boundary and initial
     // condition manager gets the right type of vector.
 
-    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
     boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
 
     // For NOX, add the increment in displacement BC directly into the displacement vector
    //TEUCHOS_TEST_FOR_EXCEPT_MSG(initialGuess->MyLength() != combinedV->MyLength(), "**** PeridigmNS::Peridigm::executeNOXQuasiStatic() initialGuess vector different length than combinedV.\n");
@@ -2137,9 +2355,9 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
         *noxPressureVAtDOFWithKinematicBC = *fluidPressureV;
 
     // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
     *soln = *initialGuess;
 
@@ -2408,10 +2626,10 @@ void PeridigmNS::Peridigm::executeNOXQuasiStatic(Teuchos::RCP<Teuchos::Parameter
     }
 
     // Write output for completed load step
-    PeridigmNS::Timer::self().startTimer("Output");
+    PeridigmNS::Timer::self().startTimer(outputTimerId);
     synchDataManagers();
     outputManager->write(blocks, timeCurrent);
-    PeridigmNS::Timer::self().stopTimer("Output");
+    PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
     // swap state N and state NP1
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -2580,24 +2798,26 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   double timePrevious = timeCurrent;
 
   // Apply BC at time zero for the sake of I/O
-  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
   boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
-  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
+  PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
   // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
+  PeridigmNS::Timer::self().startTimer(outputTimerId);
   synchDataManagers();
   outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
   Epetra_Time loadStepCPUTime(*peridigmComm);
   double cumulativeLoadStepCPUTime = 0.0;
 
   for(int step=1 ; step<(int)timeSteps.size() ; step++){
 
+    PeridigmNS::Timer::self().beginStep(step);
+
     if(!adaptiveLoadStepping || !solverFailedToConverge){
       loadStepCPUTime.ResetStartTime();
       timePrevious = timeCurrent;
@@ -2615,14 +2835,14 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
 		}
 
     // Update nodal positions for nodes with kinematic B.C.
-    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
     boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+    PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
 
     // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
     // Set the current position and velocity
 		for(int i=0 ; i<y->MyLength() ; ++i){
@@ -2733,12 +2953,12 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         // Compute the tangent
         if( !dampedNewton || (solverIteration-numPureNewtonSteps-1)%dampedNewtonNumStepsBetweenTangentUpdates==0 ){
           tangent->PutScalar(0.0);
-          PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+          PeridigmNS::Timer::self().startTimer(evaluateJacobianTimerId);
           modelEvaluator->evalJacobian(workset);
           int err = tangent->GlobalAssemble();
 
           TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeQuasiStatic(), GlobalAssemble() returned nonzero error code.\n");
-          PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+          PeridigmNS::Timer::self().stopTimer(evaluateJacobianTimerId);
           boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
           boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
           tangent->Scale(-1.0);
@@ -2771,9 +2991,9 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         // The solver should have returned zeros, but there may be small errors.
         boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(lhs, numMultiphysDoFs);
 
-        PeridigmNS::Timer::self().startTimer("Line Search");
+        PeridigmNS::Timer::self().startTimer(lineSearchTimerId);
         alpha = disableHeuristics ? 1.0 : quasiStaticsLineSearch(residual, lhs, timeIncrement);
-        PeridigmNS::Timer::self().stopTimer("Line Search");
+        PeridigmNS::Timer::self().stopTimer(lineSearchTimerId);
 
         // Apply increment to nodal positions
 				if(analysisHasMultiphysics){
@@ -2930,10 +3150,10 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
       }
 
       // Write output for completed load step
-      PeridigmNS::Timer::self().startTimer("Output");
+      PeridigmNS::Timer::self().startTimer(outputTimerId);
       synchDataManagers();
       outputManager->write(blocks, timeCurrent);
-      PeridigmNS::Timer::self().stopTimer("Output");
+      PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
       // swap state N and state NP1
       for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -3062,18 +3282,18 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
   bool solverFailedToConverge = false;
 
   // Apply BC at time zero
-  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
   boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
-  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
+  PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
   // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
+  PeridigmNS::Timer::self().startTimer(outputTimerId);
   synchDataManagers();
   outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
   std::cout << "POINT B" << std::endl;
 
@@ -3082,6 +3302,8 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
 
   for(int step=1 ; step<(int)timeSteps.size() ; step++){
 
+    PeridigmNS::Timer::self().beginStep(step);
+
     if(!solverFailedToConverge){
       loadStepCPUTime.ResetStartTime();
       timePrevious = timeCurrent;
@@ -3173,11 +3395,11 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
 
       // Compute the tangent
       tangent->PutScalar(0.0);
-      PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+      PeridigmNS::Timer::self().startTimer(evaluateJacobianTimerId);
       modelEvaluator->evalJacobian(workset);
       int err = tangent->GlobalAssemble();
       TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeImplicitDiffusion(), GlobalAssemble() returned nonzero error code.\n");
-      PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+      PeridigmNS::Timer::self().stopTimer(evaluateJacobianTimerId);
       boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
       boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
       tangent->Scale(-1.0);
@@ -3257,10 +3479,10 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
     //   }
 
       // Write output for completed load step
-      PeridigmNS::Timer::self().startTimer("Output");
+      PeridigmNS::Timer::self().startTimer(outputTimerId);
       synchDataManagers();
       outputManager->write(blocks, timeCurrent);
-      PeridigmNS::Timer::self().stopTimer("Output");
+      PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
       // swap state N and state NP1
       for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -3340,7 +3562,7 @@ Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epe
 								Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem,
 								Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> >& belosSolver)
 {
-  PeridigmNS::Timer::self().startTimer("Solve Linear System");
+  PeridigmNS::Timer::self().startTimer(solveLinearSystemTimerId);
 
   Belos::ReturnType isConverged(Belos::Unconverged);
 
@@ -3357,7 +3579,7 @@ Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epe
     isConverged = Belos::Unconverged;
   }
 
-  PeridigmNS::Timer::self().stopTimer("Solve Linear System");
+  PeridigmNS::Timer::self().stopTimer(solveLinearSystemTimerId);
 
   // Debugging code: Debug linear system to disk
   bool writeMatrixNow = false;
@@ -3715,21 +3937,23 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   //Teuchos::RCP<Epetra_Vector> deltaU = Teuchos::rcp(new Epetra_Vector(*threeDimensionalMap));
 
   // Apply BC at time zero
-  PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+  PeridigmNS::Timer::self().startTimer(applyKinematicBCTimerId);
   boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
-  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyKinematicBCTimerId);
+  PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent,timePrevious);
-  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+  PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
   // Write initial configuration to disk
-  PeridigmNS::Timer::self().startTimer("Output");
+  PeridigmNS::Timer::self().startTimer(outputTimerId);
   synchDataManagers();
   outputManager->write(blocks, timeCurrent);
-  PeridigmNS::Timer::self().stopTimer("Output");
+  PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
   for(int step=0; step<nsteps ; step++){
 
+    PeridigmNS::Timer::self().beginStep(step);
+
     if(peridigmComm->MyPID() == 0)
       cout << "Load step " << step << ", initial time = " << step*dt << ", final time = " << (step+1)*dt << endl;
 
@@ -3782,7 +4006,7 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     }
 
     // Copy data from mothership vectors to overlap vectors in data manager
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
       blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
       blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -3796,12 +4020,12 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
         blockIt->importData(*fluidPressureV, fluidPressureVFieldId, PeridigmField::STEP_NP1, Insert);
       }
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
     // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
+    PeridigmNS::Timer::self().startTimer(internalForceTimerId);
     modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+    PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
     // Copy force from the data manager to the mothership vector
     force->PutScalar(0.0);
@@ -3831,9 +4055,9 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     scratch->PutScalar(0.0);
 
     // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+    PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
     // Compute the residual
     // residual = beta*dt*dt*(M*a - force)
@@ -3897,11 +4121,11 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       bool isSet = linearProblem.setProblem(displacementIncrement, residual);
 
       TEUCHOS_TEST_FOR_EXCEPT_MSG(!isSet, "**** Peridigm::executeImplicit(), failed to set linear problem.\n");
-      PeridigmNS::Timer::self().startTimer("Solve Linear System");
+      PeridigmNS::Timer::self().startTimer(solveLinearSystemTimerId);
       Belos::ReturnType isConverged = belosSolver->solve();
       if(isConverged != Belos::Converged && peridigmComm->MyPID() == 0)
         cout << "Warning:  Belos linear solver failed to converge!  Proceeding with nonconverged solution..." << endl;
-      PeridigmNS::Timer::self().stopTimer("Solve Linear System");
+      PeridigmNS::Timer::self().stopTimer(solveLinearSystemTimerId);
 
      //TODO: Turn all mentions of combinedDeltaU and deltaU to displacementIncrement where appropriate.
       //Update increments from combined vector
@@ -3929,7 +4153,7 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       v->Update(1.0, *v2, dt*gamma, *a, 0.0);
 
       // Copy data from mothership vectors to overlap vectors in data manager
-      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+      PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
       for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
         blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
         blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -3943,12 +4167,12 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
           blockIt->importData(*fluidPressureY, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
         }
       }
-      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+      PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
       // Update forces based on new positions
-      PeridigmNS::Timer::self().startTimer("Internal Force");
+      PeridigmNS::Timer::self().startTimer(internalForceTimerId);
       modelEvaluator->evalModel(workset);
-      PeridigmNS::Timer::self().stopTimer("Internal Force");
+      PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
       // Copy force from the data manager to the mothership vector
       force->PutScalar(0.0);
@@ -3974,9 +4198,9 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       scratch->PutScalar(0.0);
 
       // evaluate the external (body) forces:
-      PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+      PeridigmNS::Timer::self().startTimer(applyBodyForcesTimerId);
       boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
-      PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+      PeridigmNS::Timer::self().stopTimer(applyBodyForcesTimerId);
 
       // Compute residual vector and its norm
       // residual = beta*dt*dt*(M*a - force)
@@ -4020,10 +4244,10 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     timeCurrent = timeInitial + (step+1)*dt;
 
     // Write output for completed time step
-    PeridigmNS::Timer::self().startTimer("Output");
+    PeridigmNS::Timer::self().startTimer(outputTimerId);
     synchDataManagers();
     outputManager->write(blocks, timeCurrent);
-    PeridigmNS::Timer::self().stopTimer("Output");
+    PeridigmNS::Timer::self().stopTimer(outputTimerId);
 
     // swap state N and state NP1
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
@@ -4189,14 +4413,14 @@ void PeridigmNS::Peridigm::allocateBlockDiagonalJacobian() {
 
 double PeridigmNS::Peridigm::computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vector> residual) {
 
-  PeridigmNS::Timer::self().startTimer("Compute Residual");
+  PeridigmNS::Timer::self().startTimer(computeResidualTimerId);
 
   // The residual is computed as the norm of the internal force vector with the
   // entries corresponding to kinematic BC zeroed out.
   // The specific residual measure is the L2 norm plus twenty times the infinity norm
 
   // Copy data from mothership vectors to overlap vectors in data manager
-  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
 	if(analysisHasMultiphysics){
 		for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
 			blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
@@ -4218,15 +4442,15 @@ double PeridigmNS::Peridigm::computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vect
       blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
 		}
 	}
-  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 
   // Update forces based on new positions
-  PeridigmNS::Timer::self().startTimer("Internal Force");
+  PeridigmNS::Timer::self().startTimer(internalForceTimerId);
   modelEvaluator->evalModel(workset);
-  PeridigmNS::Timer::self().stopTimer("Internal Force");
+  PeridigmNS::Timer::self().stopTimer(internalForceTimerId);
 
   // Copy force from the data manager to the mothership vector
-  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
   force->PutScalar(0.0);
 	if(analysisHasMultiphysics){
 		fluidFlow->PutScalar(0.0);
@@ -4254,7 +4478,7 @@ double PeridigmNS::Peridigm::computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vect
 			force->Update(1.0, *scratch, 1.0);
 		}
 	}
-  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
   scratch->PutScalar(0.0);
 	if(analysisHasMultiphysics)
 		scratchOneD->PutScalar(0.0);
@@ -4312,7 +4536,7 @@ if(analysisHasMultiphysics){
   double residualNormInf;
   residual->NormInf(&residualNormInf);
 
-  PeridigmNS::Timer::self().stopTimer("Compute Residual");
+  PeridigmNS::Timer::self().stopTimer(computeResidualTimerId);
 
   return residualNorm2 + 20.0*residualNormInf;
 }
@@ -4321,11 +4545,11 @@ void PeridigmNS::Peridigm::computeImplicitJacobian(double beta, double dt) {
 //TODO make multiphysics
   // Compute the tangent
   tangent->PutScalar(0.0);
-  PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+  PeridigmNS::Timer::self().startTimer(evaluateJacobianTimerId);
   modelEvaluator->evalJacobian(workset);
   int err = tangent->GlobalAssemble();
   TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computeImplicitJacobian(), GlobalAssemble() returned nonzero error code.\n");
-  PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+  PeridigmNS::Timer::self().stopTimer(evaluateJacobianTimerId);
 
   // tangent = M - beta*dt*dt*K
   tangent->Scale(-beta*dt*dt);
@@ -4343,7 +4567,7 @@ void PeridigmNS::Peridigm::synchDataManagers() {
   // Copy data from mothership vectors to overlap vectors in blocks
   // Volume, Block_Id, and Model_Coordinates are synched at initialization and never change
 
-  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().startTimer(gatherScatterTimerId);
 
 	if(analysisHasMultiphysics){
 		for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -4393,7 +4617,7 @@ void PeridigmNS::Peridigm::synchDataManagers() {
       blockIt->importData(*tempVector, hourglassForceDensityFieldId, PeridigmField::STEP_NP1, Insert);
   }
 
-  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+  PeridigmNS::Timer::self().stopTimer(gatherScatterTimerId);
 }
 
 Teuchos::RCP< map< string, vector<int> > > PeridigmNS::Peridigm::getExodusNodeSets(){
@@ -4443,6 +4667,216 @@ void PeridigmNS::Peridigm::displayProgress(string title, double percentComplete)
   *out << ss.str();
 }
 
+void PeridigmNS::Peridigm::printBlockCosts(){
+
+  // The contact force of a contact block is attributed to the block of the same name
+  map<string, const PeridigmNS::BlockBase::PhaseCost*> contactCosts;
+  if(analysisHasContact){
+    Teuchos::RCP< std::vector<PeridigmNS::ContactBlock> > contactBlocks = contactManager->getContactBlocks();
+    for(std::vector<PeridigmNS::ContactBlock>::iterator it = contactBlocks->begin() ; it != contactBlocks->end() ; it++)
+      contactCosts[it->getName()] = &it->getCost(PeridigmNS::BlockBase::CONTACT_COST);
+  }
+
+  // Points, bonds, and per-phase times and bonds processed for each block; blocks are in the same order on all processors
+  const int numPhases = PeridigmNS::BlockBase::NUM_COST_PHASES;
+  const int numValues = 2 + 2*numPhases;
+  int numBlocks = static_cast<int>( blocks->size() );
+  vector<double> localValues(numValues*numBlocks, 0.0), globalValues(numValues*numBlocks);
+  vector<double> localTotals(numBlocks, 0.0), maxTotals(numBlocks), sumTotals(numBlocks);
+  int blockIndex = 0;
+  for(std::vector<PeridigmNS::Block>::iterator it = blocks->begin() ; it != blocks->end() ; it++, blockIndex++){
+    double* values = &localValues[numValues*blockIndex];
+    values[0] = it->getNeighborhoodData()->NumOwnedPoints();
+    values[1] = static_cast<double>( it->getNeighborhoodData()->NumBonds() );
+    for(int phase=0 ; phase<numPhases ; ++phase){
+      const PeridigmNS::BlockBase::PhaseCost* cost = &it->getCost(static_cast<PeridigmNS::BlockBase::CostPhase>(phase));
+      if(phase == PeridigmNS::BlockBase::CONTACT_COST)
+        cost = contactCosts.count(it->getName()) ? contactCosts[it->getName()] : 0;
+      if(cost != 0){
+        values[2 + 2*phase] = cost->time;
+        values[3 + 2*phase] = static_cast<double>( cost->bonds );
+        localTotals[blockIndex] += cost->time;
+      }
+    }
+  }
+  if(numBlocks > 0){
+    peridigmComm->SumAll(&localValues[0], &globalValues[0], numValues*numBlocks);
+    peridigmComm->SumAll(&localTotals[0], &sumTotals[0], numBlocks);
+    peridigmComm->MaxAll(&localTotals[0], &maxTotals[0], numBlocks);
+  }
+
+  if(peridigmComm->MyPID() != 0)
+    return;
+
+  bool haveCosts = false;
+  unsigned int nameLength = 5, materialLength = 8, damageLength = 12;
+  blockIndex = 0;
+  for(std::vector<PeridigmNS::Block>::iterator it = blocks->begin() ; it != blocks->end() ; it++, blockIndex++){
+    nameLength = std::max(nameLength, static_cast<unsigned int>(it->getName().size()));
+    materialLength = std::max(materialLength, static_cast<unsigned int>(it->getMaterialName().size()));
+    damageLength = std::max(damageLength, static_cast<unsigned int>(it->getDamageModelName().size()));
+    if(sumTotals[blockIndex] > 0.0)
+      haveCosts = true;
+  }
+  if(!haveCosts)
+    return;
+
+  int nProc = peridigmComm->NumProc();
+  int width = 12;
+  cout << "Block Costs (seconds summed over processors, and nanoseconds per bond):" << endl;
+  cout << "  ";
+  cout.width(nameLength + 2); cout << left << "Block";
+  cout.width(materialLength + 2); cout << left << "Material";
+  cout.width(damageLength + 2); cout << left << "Damage Model";
+  cout.width(width); cout << right << "Points";
+  cout.width(width); cout << right << "Bonds";
+  cout.width(width); cout << right << "Damage";
+  cout.width(width); cout << right << "Force";
+  cout.width(width); cout << right << "Jacobian";
+  cout.width(width); cout << right << "Contact";
+  cout.width(width); cout << right << "Max/Ave";
+  cout.width(width); cout << right << "Damage/Bond";
+  cout.width(width); cout << right << "Force/Bond";
+  cout << endl;
+  std::streamsize precision = cout.precision(3);
+  blockIndex = 0;
+  for(std::vector<PeridigmNS::Block>::iterator it = blocks->begin() ; it != blocks->end() ; it++, blockIndex++){
+    const double* values = &globalValues[numValues*blockIndex];
+    double aveTotal = sumTotals[blockIndex]/nProc;
+    double damageBonds = values[3 + 2*PeridigmNS::BlockBase::DAMAGE_COST];
+    double forceBonds = values[3 + 2*PeridigmNS::BlockBase::FORCE_COST];
+    cout << "  ";
+    cout.width(nameLength + 2); cout << left << it->getName();
+    cout.width(materialLength + 2); cout << left << it->getMaterialName();
+    cout.width(damageLength + 2); cout << left << it->getDamageModelName();
+    cout.width(width); cout << right << static_cast<long long>(values[0]);
+    cout.width(width); cout << right << static_cast<long long>(values[1]);
+    for(int phase=0 ; phase<numPhases ; ++phase){
+      cout.width(width); cout << right << values[2 + 2*phase];
+    }
+    cout.width(width); cout << right << (aveTotal > 0.0 ? maxTotals[blockIndex]/aveTotal : 1.0);
+    cout.width(width); cout << right << (damageBonds > 0.0 ? 1.0e9*values[2 + 2*PeridigmNS::BlockBase::DAMAGE_COST]/damageBonds : 0.0);
+    cout.width(width); cout << right << (forceBonds > 0.0 ? 1.0e9*values[2 + 2*PeridigmNS::BlockBase::FORCE_COST]/forceBonds : 0.0);
+    cout << endl;
+  }
+  cout << endl;
+  cout.precision(precision);
+}
+
+void PeridigmNS::Peridigm::printStartupProfile(){
+
+  // The same phases are run, in the same order, on all processors; the time outside
+  // of the listed phases is reported as an additional phase, followed by the total
+  int numPhases = static_cast<int>( startupPhases.size() );
+  int numValues = numPhases + 2;
+  vector<double> localTimes(numValues), minTimes(numValues), maxTimes(numValues), sumTimes(numValues);
+  vector<double> localMemory(2*numValues, 0.0), maxMemory(2*numValues);
+  vector<string> names(numValues);
+  double unattributedTime = startupTime;
+  for(int i=0 ; i<numPhases ; ++i){
+    names[i] = startupPhases[i].name;
+    localTimes[i] = startupPhases[i].time;
+    localMemory[2*i] = static_cast<double>( startupPhases[i].rssChange );
+    localMemory[2*i+1] = static_cast<double>( startupPhases[i].peakRssChange );
+    unattributedTime -= startupPhases[i].time;
+  }
+  names[numPhases] = "Other";
+  localTimes[numPhases] = std::max(unattributedTime, 0.0);
+  names[numPhases+1] = "Total";
+  localTimes[numPhases+1] = startupTime;
+  peridigmComm->MinAll(&localTimes[0], &minTimes[0], numValues);
+  peridigmComm->MaxAll(&localTimes[0], &maxTimes[0], numValues);
+  peridigmComm->SumAll(&localTimes[0], &sumTimes[0], numValues);
+  peridigmComm->MaxAll(&localMemory[0], &maxMemory[0], 2*numValues);
+
+  if(peridigmComm->MyPID() != 0 || numPhases == 0)
+    return;
+
+  // Rank the phases by the time on the slowest processor
+  vector<int> order(numPhases + 1);
+  for(int i=0 ; i<=numPhases ; ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&maxTimes](int a, int b){ return maxTimes[a] > maxTimes[b]; });
+  order.push_back(numPhases + 1);
+
+  unsigned int nameLength = 5;
+  for(int i=0 ; i<numValues ; ++i)
+    nameLength = std::max(nameLength, static_cast<unsigned int>(names[i].size()));
+
+  int nProc = peridigmComm->NumProc();
+  double totalMax = maxTimes[numPhases+1];
+  double megabyte = 1024.0*1024.0;
+  int width = 12;
+  cout << "Startup Phases (seconds over processors, slowest first, and maximum memory growth in MB):" << endl;
+  cout << "  ";
+  cout.width(nameLength + 2); cout << left << "Phase";
+  cout.width(width); cout << right << "Min";
+  cout.width(width); cout << right << "Max";
+  cout.width(width); cout << right << "Ave";
+  cout.width(width); cout << right << "Max/Ave";
+  cout.width(width); cout << right << "% Startup";
+  cout.width(width); cout << right << "RSS";
+  cout.width(width); cout << right << "Peak RSS";
+  cout << endl;
+  std::streamsize precision = cout.precision(3);
+  for(unsigned int i=0 ; i<order.size() ; ++i){
+    int phase = order[i];
+    double aveTime = sumTimes[phase]/nProc;
+    cout << "  ";
+    cout.width(nameLength + 2); cout << left << names[phase];
+    cout.width(width); cout << right << minTimes[phase];
+    cout.width(width); cout << right << maxTimes[phase];
+    cout.width(width); cout << right << aveTime;
+    cout.width(width); cout << right << (aveTime > 0.0 ? maxTimes[phase]/aveTime : 1.0);
+    cout.width(width); cout << right << (totalMax > 0.0 ? 100.0*maxTimes[phase]/totalMax : 0.0);
+    if(phase < numPhases){
+      cout.width(width); cout << right << maxMemory[2*phase]/megabyte;
+      cout.width(width); cout << right << maxMemory[2*phase+1]/megabyte;
+    }
+    cout << endl;
+  }
+  cout << endl;
+  cout.precision(precision);
+}
+
+void PeridigmNS::Peridigm::recordTelemetry(int step, int numSteps, double timeCurrent, double dt){
+
+  PeridigmNS::Telemetry& telemetry = PeridigmNS::Telemetry::self();
+  if(!telemetry.isRecordStep(step))
+    return;
+
+  PeridigmNS::Telemetry::LocalData localData;
+
+  // Bonds, and bonds that have fully failed
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int bondDamageFieldId = fieldManager.hasField("Bond_Damage") ? fieldManager.getFieldId("Bond_Damage") : -1;
+  for(std::vector<PeridigmNS::Block>::iterator it = blocks->begin() ; it != blocks->end() ; it++){
+    localData.numBonds += it->getNeighborhoodData()->NumBonds();
+    if(bondDamageFieldId != -1 && it->getDataManager()->hasData(bondDamageFieldId, PeridigmField::STEP_NP1)){
+      double* bondDamage;
+      Teuchos::RCP<Epetra_Vector> bondDamageVector = it->getDataManager()->getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+      bondDamageVector->ExtractView(&bondDamage);
+      for(int i=0 ; i<bondDamageVector->MyLength() ; ++i){
+        if(bondDamage[i] >= 1.0)
+          localData.numBrokenBonds += 1;
+      }
+    }
+  }
+
+  // Kinetic energy of the owned points
+  for(int i=0 ; i<volume->MyLength() ; ++i){
+    double speedSquared = (*v)[3*i]*(*v)[3*i] + (*v)[3*i+1]*(*v)[3*i+1] + (*v)[3*i+2]*(*v)[3*i+2];
+    localData.kineticEnergy += 0.5*(*density)[i]*(*volume)[i]*speedSquared;
+  }
+
+  if(analysisHasContact)
+    localData.numContactPairs = contactManager->numContactPairs();
+
+  localData.computeTime = PeridigmNS::Timer::self().elapsedTime("Internal Force");
+
+  telemetry.record(step, numSteps, timeCurrent, dt, localData);
+}
+
 void PeridigmNS::Peridigm::writeRestart(Teuchos::RCP<Teuchos::ParameterList> solverParams){
 //  system("date +"%m-%d-%Y-%H-%M-%S"");
   char createDirectory[100];
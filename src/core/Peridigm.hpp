@@ -51,6 +51,7 @@
 
 #include <vector>
 #include <set>
+#include <chrono>
 
 #include <BelosLinearProblem.hpp>
 #include <BelosBlockCGSolMgr.hpp>
@@ -378,7 +379,19 @@ namespace PeridigmNS {
     void displayProgress(std::string title, double percentComplete);
 
     //! Display information about memory usage
-    void printMemoryStats(){Memstat * memstat = Memstat::Instance(); memstat->printStats();};
+    void printMemoryStats(){registerMemoryUse(); Memstat * memstat = Memstat::Instance(); memstat->printStats();};
+
+    //! Register the memory held by the neighbor lists, block data, mothership vectors, tangent, and contact data with Memstat
+    void registerMemoryUse();
+
+    //! Write a telemetry record of progress and throughput for the given step, if one is due
+    void recordTelemetry(int step, int numSteps, double timeCurrent, double dt);
+
+    //! Print the wall time and bonds processed by each block in each phase of the model evaluation
+    void printBlockCosts();
+
+    //! Print the initialization phases, slowest first, with the spread of wall times and memory growth over processors
+    void printStartupProfile();
 
   private:
 
@@ -387,6 +400,12 @@ namespace PeridigmNS {
     friend class OutputManager_ExodusII;
     //@}
 
+    //! Starts timing and sampling the memory use of an initialization phase
+    void beginStartupPhase(const std::string& name);
+
+    //! Ends the initialization phase started by the most recent call to beginStartupPhase()
+    void endStartupPhase();
+
     //! Parameterlist of entire input deck
     Teuchos::RCP<Teuchos::ParameterList> peridigmParams;
 
@@ -626,6 +645,20 @@ namespace PeridigmNS {
     int externalForceDensityFieldId;
     int partialVolumeFieldId;
 
+    // timer ids for the solver loops
+    int gatherScatterTimerId;
+    int internalForceTimerId;
+    int applyKinematicBCTimerId;
+    int applyBodyForcesTimerId;
+    int outputTimerId;
+    int dataLoaderTimerId;
+    int evaluateJacobianTimerId;
+    int solveLinearSystemTimerId;
+    int computeResidualTimerId;
+    int lineSearchTimerId;
+    int rebalanceTimerId;
+    int invert3x3BlockTangentTimerId;
+
     // multiphyics information
     int fluidPressureYFieldId;
     int fluidPressureUFieldId;
@@ -636,6 +669,25 @@ namespace PeridigmNS {
     int numMultiphysDoFs;
     string textMultiphysDoFs;
 
+    //! Wall time and change in resident set size of an initialization phase on this processor
+    struct StartupPhase {
+      StartupPhase(const std::string& name_) : name(name_), time(0.0), rssChange(0), peakRssChange(0) {}
+      std::string name;
+      std::chrono::steady_clock::time_point start;
+      double time;
+      long long rssChange;
+      long long peakRssChange;
+    };
+
+    //! Initialization phases, in the order in which they were run
+    std::vector<StartupPhase> startupPhases;
+
+    //! Start of initialization
+    std::chrono::steady_clock::time_point startupBegin;
+
+    //! Wall time of the entire initialization on this processor
+    double startupTime;
+
     // Map for restart files
     map<string, string> restartFiles;
 
@@ -47,13 +47,15 @@
 
 #include "Peridigm_BlockBase.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
 #include <vector>
 #include <set>
 
 using namespace std;
 
 PeridigmNS::BlockBase::BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_)
-  : blockName(blockName_), blockID(blockID_), blockParams(blockParams_)
+  : blockName(blockName_), blockID(blockID_), communicationCategory("Block"), blockParams(blockParams_), costs(NUM_COST_PHASES)
 {}
 
 void PeridigmNS::BlockBase::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
@@ -74,17 +76,27 @@ void PeridigmNS::BlockBase::initialize(Teuchos::RCP<const Epetra_BlockMap> globa
 
   neighborhoodData = createNeighborhoodDataFromGlobalNeighborhoodData(globalOverlapScalarPointMap,
                                                                       globalNeighborhoodData);
+
+  PeridigmNS::CommunicationMonitor::self().setBlockPoints(communicationCategory + " " + blockName,
+                                              ownedScalarPointMap->NumMyElements(),
+                                              overlapScalarPointMap->NumMyElements() - ownedScalarPointMap->NumMyElements());
 }
 
 void PeridigmNS::BlockBase::importData(const Epetra_Vector& source, int fieldId, PeridigmField::Step step, Epetra_CombineMode combineMode)
 {
+  static const int haloImportRegionId = PeridigmNS::PerformanceCounters::self().getRegionId("Halo Import");
+
   if(dataManager->hasData(fieldId, step)){
 
+    PeridigmNS::ScopedCounters haloCounters(haloImportRegionId, neighborhoodData->NumBonds());
+
     // scalar data
     if(source.Map().ElementSize() == 1){
       if(oneDimensionalImporter.is_null())
         oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), source.Map()));
       dataManager->getData(fieldId, step)->Import(source, *oneDimensionalImporter, combineMode);
+      if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+        PeridigmNS::CommunicationMonitor::self().recordImport(communicationCategory + " Import", PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLabel(), *oneDimensionalImporter);
     }
 
     // vector data
@@ -92,6 +104,8 @@ void PeridigmNS::BlockBase::importData(const Epetra_Vector& source, int fieldId,
       if(threeDimensionalImporter.is_null())
         threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), source.Map()));
       dataManager->getData(fieldId, step)->Import(source, *threeDimensionalImporter, combineMode);
+      if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+        PeridigmNS::CommunicationMonitor::self().recordImport(communicationCategory + " Import", PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLabel(), *threeDimensionalImporter);
     }
   }
 }
@@ -105,6 +119,8 @@ void PeridigmNS::BlockBase::exportData(Epetra_Vector& target, int fieldId, Perid
       if(oneDimensionalImporter.is_null())
         oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), target.Map()));
       target.Export(*(dataManager->getData(fieldId, step)), *oneDimensionalImporter, combineMode);  
+      if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+        PeridigmNS::CommunicationMonitor::self().recordExport(communicationCategory + " Export", PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLabel(), *oneDimensionalImporter);
     }
 
     // vector data
@@ -112,6 +128,8 @@ void PeridigmNS::BlockBase::exportData(Epetra_Vector& target, int fieldId, Perid
       if(threeDimensionalImporter.is_null())
         threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), target.Map()));
       target.Export(*(dataManager->getData(fieldId, step)), *threeDimensionalImporter, combineMode);  
+      if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+        PeridigmNS::CommunicationMonitor::self().recordExport(communicationCategory + " Export", PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLabel(), *threeDimensionalImporter);
     }
   }
 }
@@ -57,6 +57,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <chrono>
 
 #include "Peridigm_NeighborhoodData.hpp"
 #include "Peridigm_DataManager.hpp"
@@ -67,7 +68,7 @@ namespace PeridigmNS {
   public:
 
     //! Constructor
-    BlockBase() : blockName("Undefined"), blockID(-1) {}
+    BlockBase() : blockName("Undefined"), blockID(-1), communicationCategory("Block"), costs(NUM_COST_PHASES) {}
 
     //! Constructor
     BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_);
@@ -169,6 +170,34 @@ namespace PeridigmNS {
     //! Swaps STATE_N and STATE_NP1.
     void updateState(){ dataManager->updateState(); };
 
+    //! Phases of the model evaluation whose cost is attributed to the block.
+    enum CostPhase { DAMAGE_COST=0, FORCE_COST=1, JACOBIAN_COST=2, CONTACT_COST=3, NUM_COST_PHASES=4 };
+
+    //! Cost of one phase of the model evaluation for the block on this processor.
+    struct PhaseCost {
+      PhaseCost() : time(0.0), lastTime(0.0), calls(0), bonds(0) {}
+      //! Cumulative wall time, in seconds.
+      double time;
+      //! Wall time of the most recent evaluation, in seconds.
+      double lastTime;
+      //! Number of evaluations.
+      long long calls;
+      //! Cumulative number of bonds processed.
+      long long bonds;
+    };
+
+    //! Records an evaluation of the given phase that took the given wall time and processed the given number of bonds.
+    void addCost(CostPhase phase, double seconds, long long numBonds){
+      PhaseCost& cost = costs[phase];
+      cost.time += seconds;
+      cost.lastTime = seconds;
+      cost.calls += 1;
+      cost.bonds += numBonds;
+    }
+
+    //! Get the cost of the given phase on this processor.
+    const PhaseCost& getCost(CostPhase phase) const { return costs[phase]; }
+
     //! Write block data
     void writeBlocktoDisk(std::string blockName, char const * path){ dataManager->writeBlocktoDisk(blockName, path); }
 
@@ -205,6 +234,9 @@ namespace PeridigmNS {
     std::string blockName;
     int blockID;
 
+    //! Category under which the communication for this block is recorded.
+    std::string communicationCategory;
+
     //! @name Maps
     //@{
     //! One-dimensional map for owned points.
@@ -236,6 +268,36 @@ namespace PeridigmNS {
 
     //! The blocks parameterlist sublist
     Teuchos::ParameterList blockParams;
+
+    //! Cost of each phase of the model evaluation, indexed by CostPhase.
+    std::vector<PhaseCost> costs;
+  };
+
+  //! Records the wall time from construction to destruction as a cost of the given block and phase.
+  class ScopedBlockCost {
+
+  public:
+
+    ScopedBlockCost(BlockBase& block_, BlockBase::CostPhase phase_, long long numBonds_)
+      : block(block_), phase(phase_), numBonds(numBonds_), startTime(std::chrono::steady_clock::now()) {}
+
+    ~ScopedBlockCost(){
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+      block.addCost(phase, elapsed.count(), numBonds);
+    }
+
+  private:
+
+    //! Private to prohibit copying
+    ScopedBlockCost(const ScopedBlockCost&);
+
+    //! Private to prohibit copying
+    ScopedBlockCost& operator=(const ScopedBlockCost&);
+
+    BlockBase& block;
+    BlockBase::CostPhase phase;
+    long long numBonds;
+    std::chrono::steady_clock::time_point startTime;
   };
 }
 
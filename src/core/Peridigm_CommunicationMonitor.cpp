@@ -0,0 +1,319 @@
+/*! \file Peridigm_CommunicationMonitor.cpp */
+
+#include "Peridigm_CommunicationMonitor.hpp"
+#include "Peridigm_Timer.hpp"
+#include <Epetra_BlockMap.h>
+#include <iostream>
+#include <sstream>
+#include <set>
+#include <algorithm>
+#include <limits>
+
+#ifdef HAVE_MPI
+#include <Epetra_MpiDistributor.h>
+#endif
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Assert.hpp>
+
+using namespace std;
+
+namespace {
+
+  //! Returns the number of points (scalar entries) in the given local elements of a map, whose elements may vary in size.
+  long long numPoints(const Epetra_BlockMap& map, int numElements, const int* localIds){
+    if(map.ConstantElementSize())
+      return static_cast<long long>(map.ElementSize()) * numElements;
+    long long points = 0;
+    for(int i=0 ; i<numElements ; ++i)
+      points += map.ElementSize(localIds[i]);
+    return points;
+  }
+
+  //! Returns the union over all processors of the given names, in the order in which they are first encountered.
+  vector<string> unionOverProcessors(const vector<string>& names, int nProc){
+    string packedNames;
+    for(unsigned int i=0 ; i<names.size() ; ++i)
+      packedNames += names[i] + '\n';
+    string allPackedNames = packedNames;
+#ifdef HAVE_MPI
+    int packedLength = static_cast<int>( packedNames.size() );
+    vector<int> packedLengths(nProc);
+    MPI_Allgather(&packedLength, 1, MPI_INT, &packedLengths[0], 1, MPI_INT, MPI_COMM_WORLD);
+    vector<int> displacements(nProc, 0);
+    for(int i=1 ; i<nProc ; ++i)
+      displacements[i] = displacements[i-1] + packedLengths[i-1];
+    vector<char> allPackedNamesBuffer(displacements[nProc-1] + packedLengths[nProc-1] + 1, '\0');
+    MPI_Allgatherv(const_cast<char*>(packedNames.c_str()), packedLength, MPI_CHAR,
+                   &allPackedNamesBuffer[0], &packedLengths[0], &displacements[0], MPI_CHAR, MPI_COMM_WORLD);
+    allPackedNames = string(&allPackedNamesBuffer[0], allPackedNamesBuffer.size() - 1);
+#endif
+    vector<string> allNames;
+    set<string> knownNames;
+    size_t begin = 0;
+    while(begin < allPackedNames.size()){
+      size_t end = allPackedNames.find('\n', begin);
+      string name = allPackedNames.substr(begin, end - begin);
+      begin = end + 1;
+      if(knownNames.insert(name).second)
+        allNames.push_back(name);
+    }
+    return allNames;
+  }
+}
+
+PeridigmNS::CommunicationMonitor& PeridigmNS::CommunicationMonitor::self() {
+  static CommunicationMonitor communicationMonitor;
+  return communicationMonitor;
+}
+
+PeridigmNS::CommunicationMonitor::CommunicationMonitor()
+  : enabled(false), step(0) {}
+
+PeridigmNS::CommunicationMonitor::~CommunicationMonitor() {
+  if(stepFile.is_open())
+    stepFile.close();
+}
+
+void PeridigmNS::CommunicationMonitor::enable(const string& csvFileNameBase, int rank) {
+  enabled = true;
+  step = PeridigmNS::Timer::self().currentStep();
+  if(!csvFileNameBase.empty()){
+    stringstream fileName;
+    fileName << csvFileNameBase << "." << rank << ".csv";
+    stepFile.open(fileName.str().c_str());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!stepFile.is_open(), "\n**** Error, unable to open communication statistics file " + fileName.str() + "\n");
+    stepFile << "step,category,field,calls,bytes_sent,bytes_received,messages_sent,messages_received,neighbors" << endl;
+  }
+}
+
+void PeridigmNS::CommunicationMonitor::record(const string& category, const string& field, const Epetra_Import& importer, int numVectors, bool reverse) {
+
+  // Steps are delimited by Timer::beginStep(), which is called by each of the solvers
+  if(PeridigmNS::Timer::self().currentStep() != step){
+    writeStep();
+    step = PeridigmNS::Timer::self().currentStep();
+  }
+
+  string name = category + '\t' + field;
+  map<string, int>::iterator it = entryIds.find(name);
+  int entryId;
+  if(it != entryIds.end()){
+    entryId = it->second;
+  }
+  else{
+    entryId = static_cast<int>( entryNames.size() );
+    entryIds[name] = entryId;
+    entryNames.push_back(name);
+    totals.push_back(Traffic());
+    stepTotals.push_back(Traffic());
+  }
+
+  // In an Import, the exports are sent and the remote entries received; an Export reverses the roles
+  long long bytesPerPoint = static_cast<long long>(numVectors) * sizeof(double);
+  long long bytesSent = bytesPerPoint * numPoints(importer.SourceMap(), importer.NumExportIDs(), importer.ExportLIDs());
+  long long bytesReceived = bytesPerPoint * numPoints(importer.TargetMap(), importer.NumRemoteIDs(), importer.RemoteLIDs());
+
+  set<int> sendProcs, receiveProcs;
+  const int* exportPIDs = importer.ExportPIDs();
+  for(int i=0 ; i<importer.NumExportIDs() ; ++i)
+    sendProcs.insert(exportPIDs[i]);
+#ifdef HAVE_MPI
+  // The distributor is created only for maps that are distributed across processors
+  if(importer.SourceMap().DistributedGlobal()){
+    const Epetra_MpiDistributor* distributor = dynamic_cast<const Epetra_MpiDistributor*>(&importer.Distributor());
+    if(distributor != 0){
+      const int* procsFrom = distributor->ProcsFrom();
+      for(int i=0 ; i<distributor->NumReceives() ; ++i)
+        receiveProcs.insert(procsFrom[i]);
+    }
+  }
+#endif
+  receiveProcs.erase(importer.SourceMap().Comm().MyPID());
+  sendProcs.erase(importer.SourceMap().Comm().MyPID());
+
+  if(reverse){
+    std::swap(bytesSent, bytesReceived);
+    std::swap(sendProcs, receiveProcs);
+  }
+
+  set<int> neighbors(sendProcs);
+  neighbors.insert(receiveProcs.begin(), receiveProcs.end());
+
+  Traffic* traffic[2] = { &totals[entryId], &stepTotals[entryId] };
+  for(int i=0 ; i<2 ; ++i){
+    traffic[i]->calls += 1;
+    traffic[i]->bytesSent += bytesSent;
+    traffic[i]->bytesReceived += bytesReceived;
+    traffic[i]->messagesSent += static_cast<long long>( sendProcs.size() );
+    traffic[i]->messagesReceived += static_cast<long long>( receiveProcs.size() );
+    traffic[i]->neighbors = std::max(traffic[i]->neighbors, static_cast<int>( neighbors.size() ));
+  }
+}
+
+void PeridigmNS::CommunicationMonitor::writeStep() {
+  for(unsigned int i=0 ; i<stepTotals.size() ; ++i){
+    Traffic& traffic = stepTotals[i];
+    if(traffic.calls == 0)
+      continue;
+    if(stepFile.is_open()){
+      size_t separator = entryNames[i].find('\t');
+      stepFile << step << ",\"" << entryNames[i].substr(0, separator) << "\",\"" << entryNames[i].substr(separator + 1) << "\","
+               << traffic.calls << "," << traffic.bytesSent << "," << traffic.bytesReceived << ","
+               << traffic.messagesSent << "," << traffic.messagesReceived << "," << traffic.neighbors << "\n";
+    }
+    traffic = Traffic();
+  }
+}
+
+void PeridigmNS::CommunicationMonitor::setBlockPoints(const string& blockName, int numOwnedPoints, int numGhostPoints) {
+  if(enabled)
+    blockPoints[blockName] = std::make_pair(numOwnedPoints, numGhostPoints);
+}
+
+void PeridigmNS::CommunicationMonitor::printCommunicationData(ostream &out) {
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+
+  int localEnabled = enabled ? 1 : 0;
+  int globalEnabled(0);
+  Teuchos::reduceAll<int, int>(*teuchosComm, Teuchos::REDUCE_MAX, 1, &localEnabled, &globalEnabled);
+  if(globalEnabled == 0)
+    return;
+
+  writeStep();
+  if(stepFile.is_open())
+    stepFile.close();
+
+  // Form the union of the entries over all processors, so that the reductions below line up
+  vector<string> names = unionOverProcessors(entryNames, nProc);
+  int count = static_cast<int>( names.size() );
+
+  vector<double> calls(count, 0.0), bytes(count, 0.0), messages(count, 0.0), neighbors(count, 0.0);
+  for(int i=0 ; i<count ; ++i){
+    map<string, int>::iterator it = entryIds.find(names[i]);
+    if(it != entryIds.end()){
+      const Traffic& traffic = totals[it->second];
+      calls[i] = static_cast<double>(traffic.calls);
+      bytes[i] = static_cast<double>(traffic.bytesSent + traffic.bytesReceived);
+      messages[i] = static_cast<double>(traffic.messagesSent + traffic.messagesReceived);
+      neighbors[i] = static_cast<double>(traffic.neighbors);
+    }
+  }
+  vector<double> maxCalls(count), totalBytes(count), maxBytes(count), totalMessages(count), maxMessages(count), maxNeighbors(count);
+  if(count > 0){
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, count, &calls[0], &maxCalls[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, count, &bytes[0], &totalBytes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, count, &bytes[0], &maxBytes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, count, &messages[0], &totalMessages[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, count, &messages[0], &maxMessages[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, count, &neighbors[0], &maxNeighbors[0]);
+  }
+
+  // Ghost-to-owned ratios, per processor and for the block as a whole
+  vector<string> localBlockNames;
+  for(map< string, pair<int,int> >::iterator it = blockPoints.begin() ; it != blockPoints.end() ; ++it)
+    localBlockNames.push_back(it->first);
+  vector<string> blockNames = unionOverProcessors(localBlockNames, nProc);
+  int numBlocks = static_cast<int>( blockNames.size() );
+  vector<double> owned(numBlocks, 0.0), ghosts(numBlocks, 0.0), ratios(numBlocks, 0.0), minRatios(numBlocks, 0.0);
+  vector<double> totalOwned(numBlocks), totalGhosts(numBlocks), maxRatios(numBlocks);
+  for(int i=0 ; i<numBlocks ; ++i){
+    map< string, pair<int,int> >::iterator it = blockPoints.find(blockNames[i]);
+    if(it != blockPoints.end()){
+      owned[i] = static_cast<double>(it->second.first);
+      ghosts[i] = static_cast<double>(it->second.second);
+    }
+    ratios[i] = owned[i] > 0.0 ? ghosts[i]/owned[i] : 0.0;
+  }
+  if(numBlocks > 0){
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, numBlocks, &owned[0], &totalOwned[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, numBlocks, &ghosts[0], &totalGhosts[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, numBlocks, &ratios[0], &maxRatios[0]);
+    // Processors that own no points of a block are excluded from the minimum
+    for(int i=0 ; i<numBlocks ; ++i)
+      ratios[i] = owned[i] > 0.0 ? ratios[i] : std::numeric_limits<double>::max();
+    Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MIN, numBlocks, &ratios[0], &minRatios[0]);
+  }
+
+  if(teuchosComm->getRank() != 0)
+    return;
+
+  unsigned int nameLength = 6;
+  for(int i=0 ; i<count ; ++i){
+    size_t separator = names[i].find('\t');
+    unsigned int length = 2 + names[i].size() - separator - 1;
+    if(separator > nameLength) nameLength = separator;
+    if(length > nameLength) nameLength = length;
+  }
+  for(int i=0 ; i<numBlocks ; ++i){
+    if(blockNames[i].size() > nameLength) nameLength = blockNames[i].size();
+  }
+
+  int indent = 15;
+  out.setf(ios::fixed);
+  out.precision(2);
+
+  if(count > 0){
+    out << "Communication (MB and messages sent plus received):" << endl;
+    out << "  ";
+    out.width(nameLength + 2); out << left << "";
+    out.width(indent); out << right << "Calls";
+    out.width(indent); out << right << "Total MB";
+    out.width(indent); out << right << "Max MB/Proc";
+    out.width(indent); out << right << "Messages";
+    out.width(indent); out << right << "Max Msgs/Proc";
+    out.width(indent); out << right << "Max Neighbors";
+    out << endl;
+    string category;
+    for(int i=0 ; i<count ; ++i){
+      size_t separator = names[i].find('\t');
+      if(names[i].substr(0, separator) != category){
+        category = names[i].substr(0, separator);
+        out << "  " << category << endl;
+      }
+      out << "  ";
+      out.width(nameLength + 2); out << left << "  " + names[i].substr(separator + 1);
+      out.width(indent); out << right << static_cast<long long>(maxCalls[i]);
+      out.width(indent); out << right << totalBytes[i]/1048576.0;
+      out.width(indent); out << right << maxBytes[i]/1048576.0;
+      out.width(indent); out << right << static_cast<long long>(totalMessages[i]);
+      out.width(indent); out << right << static_cast<long long>(maxMessages[i]);
+      out.width(indent); out << right << static_cast<long long>(maxNeighbors[i]);
+      out << endl;
+    }
+    out << endl;
+  }
+
+  if(numBlocks > 0){
+    out << "Ghosted Points:" << endl;
+    out << "  ";
+    out.width(nameLength + 2); out << left << "";
+    out.width(indent); out << right << "Owned";
+    out.width(indent); out << right << "Ghosts";
+    out.width(indent); out << right << "Ghost/Owned";
+    if(nProc > 1){
+      out.width(indent); out << right << "Min/Proc";
+      out.width(indent); out << right << "Max/Proc";
+    }
+    out << endl;
+    for(int i=0 ; i<numBlocks ; ++i){
+      out << "  ";
+      out.width(nameLength + 2); out << left << blockNames[i];
+      out.width(indent); out << right << static_cast<long long>(totalOwned[i]);
+      out.width(indent); out << right << static_cast<long long>(totalGhosts[i]);
+      out.width(indent); out << right << (totalOwned[i] > 0.0 ? totalGhosts[i]/totalOwned[i] : 0.0);
+      if(nProc > 1){
+        out.width(indent); out << right << (totalOwned[i] > 0.0 ? minRatios[i] : 0.0);
+        out.width(indent); out << right << maxRatios[i];
+      }
+      out << endl;
+    }
+    out << endl;
+  }
+  out.unsetf(ios::fixed);
+}
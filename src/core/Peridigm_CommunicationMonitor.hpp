@@ -0,0 +1,161 @@
+/*! \file Peridigm_CommunicationMonitor.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_COMMUNICATIONMONITOR_HPP
+#define PERIDIGM_COMMUNICATIONMONITOR_HPP
+
+#include <Epetra_Import.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <fstream>
+
+namespace PeridigmNS {
+
+//! Singleton class that records the communication volume of Epetra imports and exports.
+/*!
+  When enabled, each recorded Import (or Export, which reuses an Epetra_Import in reverse)
+  accumulates the bytes sent and received, the number of messages sent and received, and
+  the number of distinct neighboring processors, under a category (e.g., "Block Import")
+  and a field label.  The number of owned and ghosted points of each block is recorded as
+  well, so that ghost-to-owned ratios can be reported.  A summary over all processors is
+  printed at the end of the run; optionally, each processor also writes its per-step data
+  to the file fileNameBase.rank.csv.
+*/
+class CommunicationMonitor {
+
+public:
+
+  //! Destructor.
+  ~CommunicationMonitor();
+
+  //! Singleton.
+  static CommunicationMonitor& self();
+
+  //! Enables recording; if csvFileNameBase is not empty, per-step data is written to csvFileNameBase.rank.csv.
+  void enable(const std::string& csvFileNameBase, int rank);
+
+  //! Returns true if recording is enabled.
+  bool isEnabled() const { return enabled; }
+
+  //! Records an Import of numVectors vectors performed with the given importer.
+  void recordImport(const std::string& category, const std::string& field, const Epetra_Import& importer, int numVectors = 1) {
+    if(enabled)
+      record(category, field, importer, numVectors, false);
+  }
+
+  //! Records an Export of numVectors vectors performed with the given importer (i.e., in reverse mode).
+  void recordExport(const std::string& category, const std::string& field, const Epetra_Import& importer, int numVectors = 1) {
+    if(enabled)
+      record(category, field, importer, numVectors, true);
+  }
+
+  //! Records the number of owned and ghosted points of the given block on this processor.
+  void setBlockPoints(const std::string& blockName, int numOwnedPoints, int numGhostPoints);
+
+  //! Prints the communication summary, with totals and per-processor maxima, and the ghost-to-owned ratios of each block.
+  void printCommunicationData(std::ostream &out);
+
+private:
+
+  //! Private constructor
+  CommunicationMonitor();
+
+  //! @name Private and unimplemented to prevent use
+  //@{
+  CommunicationMonitor(const CommunicationMonitor&);
+  CommunicationMonitor& operator=(const CommunicationMonitor&);
+  //@}
+
+  //! Accumulated communication for a category and field.
+  struct Traffic {
+    Traffic() : calls(0), bytesSent(0), bytesReceived(0), messagesSent(0), messagesReceived(0), neighbors(0) {}
+    long long calls;
+    long long bytesSent;
+    long long bytesReceived;
+    long long messagesSent;
+    long long messagesReceived;
+    int neighbors;
+  };
+
+  //! Records the communication of an Import (reverse = false) or Export (reverse = true).
+  void record(const std::string& category, const std::string& field, const Epetra_Import& importer, int numVectors, bool reverse);
+
+  //! Writes the data for the step in progress to the per-step file, and resets it.
+  void writeStep();
+
+protected:
+
+  //! True if recording is enabled.
+  bool enabled;
+
+  //! Map that associates a tab-separated category and field with an entry id.
+  std::map<std::string, int> entryIds;
+
+  //! Tab-separated category and field names, indexed by entry id.
+  std::vector<std::string> entryNames;
+
+  //! Totals over the run, indexed by entry id.
+  std::vector<Traffic> totals;
+
+  //! Totals for the step in progress, indexed by entry id.
+  std::vector<Traffic> stepTotals;
+
+  //! Owned and ghosted points of each block.
+  std::map< std::string, std::pair<int,int> > blockPoints;
+
+  //! Time step of the data in stepTotals.
+  int step;
+
+  //! Per-step output file.
+  std::ofstream stepFile;
+};
+
+}
+
+#endif // PERIDIGM_COMMUNICATIONMONITOR_HPP
@@ -47,6 +47,7 @@
 
 #include "Peridigm_ContactBlock.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
 #include <vector>
 #include <set>
 
@@ -83,6 +84,9 @@ void PeridigmNS::ContactBlock::initialize(Teuchos::RCP<const Epetra_BlockMap> gl
   fieldIds.insert(fieldIds.end(), contactModelFieldIds.begin(), contactModelFieldIds.end());
 
   BlockBase::initializeDataManager(fieldIds);
+
+  if(useHalfNeighborList)
+    halfNeighborList.build(neighborhoodData->NumOwnedPoints(), neighborhoodData->NeighborhoodList());
 }
 
 void PeridigmNS::ContactBlock::rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
@@ -104,6 +108,13 @@ void PeridigmNS::ContactBlock::rebalance(Teuchos::RCP<const Epetra_BlockMap> reb
   neighborhoodData = createNeighborhoodDataFromGlobalNeighborhoodData(rebalancedGlobalOverlapScalarPointMap,
                                                                       rebalancedGlobalNeighborhoodData);
 
+  if(useHalfNeighborList)
+    halfNeighborList.build(neighborhoodData->NumOwnedPoints(), neighborhoodData->NeighborhoodList());
+
+  PeridigmNS::CommunicationMonitor::self().setBlockPoints(communicationCategory + " " + blockName,
+                                              ownedScalarPointMap->NumMyElements(),
+                                              overlapScalarPointMap->NumMyElements() - ownedScalarPointMap->NumMyElements());
+
   dataManager->rebalance(ownedScalarPointMap,
                          overlapScalarPointMap,
                          ownedVectorPointMap,
@@ -50,6 +50,7 @@
 
 #include "Peridigm_BlockBase.hpp"
 #include "Peridigm_ContactModel.hpp"
+#include "Peridigm_HalfNeighborList.hpp"
 
 namespace PeridigmNS {
 
@@ -57,11 +58,11 @@ class ContactBlock : public BlockBase {
   public:
 
     //! Constructor
-    ContactBlock() : BlockBase() {}
+    ContactBlock() : BlockBase(), useHalfNeighborList(false) { communicationCategory = "Contact Block"; }
 
     //! Constructor
     ContactBlock(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_)
-      : BlockBase(blockName_, blockID_, blockParams_) {}
+      : BlockBase(blockName_, blockID_, blockParams_), useHalfNeighborList(false) { communicationCategory = "Contact Block"; }
 
     //! Destructor
     ~ContactBlock(){}
@@ -88,6 +89,17 @@ class ContactBlock : public BlockBase {
       contactModel = contactModel_;
     }
 
+    //! Create a half neighbor list alongside the neighborhood list at initialization and rebalance
+    void setUseHalfNeighborList(bool useHalfNeighborList_){
+      useHalfNeighborList = useHalfNeighborList_;
+    }
+
+    //! Whether the block has a half neighbor list
+    bool hasHalfNeighborList() const { return useHalfNeighborList; }
+
+    //! Get the half neighbor list
+    const PeridigmNS::HalfNeighborList& getHalfNeighborList() const { return halfNeighborList; }
+
     //! Rebalance the block based on rebalanced global maps and neighborhood information.
     void rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
                    Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
@@ -101,6 +113,12 @@ class ContactBlock : public BlockBase {
 
     //! The contact model
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel;
+
+    //! Flag indicating whether to create a half neighbor list
+    bool useHalfNeighborList;
+
+    //! Half neighbor list, created from the block's neighborhood data
+    PeridigmNS::HalfNeighborList halfNeighborList;
   };
 }
 
@@ -49,6 +49,8 @@
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_ContactModelFactory.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
 #include "Peridigm_PdQuickGridDiscretization.hpp"
 #include "PdZoltan.h"
 #include "NeighborhoodList.h"
@@ -62,7 +64,7 @@ using namespace std;
 PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contactParams,
                                            Teuchos::RCP<Discretization> disc,
                                            Teuchos::RCP<Teuchos::ParameterList> peridigmParams)
-  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0),
+  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0), useHalfNeighborList(false),
     blockIdFieldId(-1), volumeFieldId(-1), coordinatesFieldId(-1), velocityFieldId(-1), contactForceDensityFieldId(-1)
 {
   if(contactParams.isParameter("Verbose"))
@@ -82,6 +84,8 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
   if(!contactParams.isParameter("Search Frequency"))
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Frequency\" not specified.");
   contactRebalanceFrequency = contactParams.get<int>("Search Frequency");
+  if(contactParams.isParameter("Half Neighbor List"))
+    useHalfNeighborList = contactParams.get<bool>("Half Neighbor List");
 
   createContactInteractionsList(contactParams, disc);
 
@@ -251,6 +255,7 @@ void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap>
       contactParams.set("Friction Coefficient", 0.0);
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactModelFactory.create(contactParams);
     contactBlockIt->setContactModel(contactModel);
+    contactBlockIt->setUseHalfNeighborList(useHalfNeighborList);
   }
 
   oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*oneDimensionalMap_));
@@ -367,6 +372,11 @@ void PeridigmNS::ContactManager::loadAllMothershipData(Teuchos::RCP<Epetra_Vecto
   contactVolume->Import(*volume, *oneDimensionalMothershipToContactMothershipImporter, Insert);
   contactY->Import(*y, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactV->Import(*v, *threeDimensionalMothershipToContactMothershipImporter, Insert);
+  PeridigmNS::CommunicationMonitor& communicationMonitor = PeridigmNS::CommunicationMonitor::self();
+  communicationMonitor.recordImport("Contact Import", "Block_Id", *oneDimensionalMothershipToContactMothershipImporter);
+  communicationMonitor.recordImport("Contact Import", "Volume", *oneDimensionalMothershipToContactMothershipImporter);
+  communicationMonitor.recordImport("Contact Import", "Coordinates", *threeDimensionalMothershipToContactMothershipImporter);
+  communicationMonitor.recordImport("Contact Import", "Velocity", *threeDimensionalMothershipToContactMothershipImporter);
   contactContactForce->PutScalar(0.0);
   contactScratch->PutScalar(0.0);
 }
@@ -463,6 +473,8 @@ void PeridigmNS::ContactManager::importData(Teuchos::RCP<Epetra_Vector> volume,
   // Import data to the contact manager's mothership vectors
   contactY->Import(*coordinates, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactV->Import(*velocity, *threeDimensionalMothershipToContactMothershipImporter, Insert);
+  PeridigmNS::CommunicationMonitor::self().recordImport("Contact Import", "Coordinates", *threeDimensionalMothershipToContactMothershipImporter);
+  PeridigmNS::CommunicationMonitor::self().recordImport("Contact Import", "Velocity", *threeDimensionalMothershipToContactMothershipImporter);
 
   // Distribute data to the contact blocks
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
@@ -481,6 +493,7 @@ void PeridigmNS::ContactManager::exportData(Teuchos::RCP<Epetra_Vector> contactF
   }
   // Copy data from the contact mothership vector to the mothership vector
   contactForce->Export(*contactContactForce, *threeDimensionalMothershipToContactMothershipImporter, Insert);
+  PeridigmNS::CommunicationMonitor::self().recordExport("Contact Export", "Contact_Force", *threeDimensionalMothershipToContactMothershipImporter);
 }
 
 void PeridigmNS::ContactManager::rebalance(int step)
@@ -559,12 +572,14 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // rebalance the mothership (global) contact vectors
   Teuchos::RCP<Epetra_MultiVector> rebalancedOneDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedOneDimensionalMap, oneDimensionalContactMothership->NumVectors()));
   rebalancedOneDimensionalMothership->Import(*oneDimensionalContactMothership, *oneDimensionalMapImporter, Insert);
+  PeridigmNS::CommunicationMonitor::self().recordImport("Contact Rebalance", "Scalar Mothership", *oneDimensionalMapImporter, oneDimensionalContactMothership->NumVectors());
   oneDimensionalContactMothership = rebalancedOneDimensionalMothership;
   contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
   contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
 
   Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalContactMothership->NumVectors()));
   rebalancedThreeDimensionalMothership->Import(*threeDimensionalContactMothership, *threeDimensionalMapImporter, Insert);
+  PeridigmNS::CommunicationMonitor::self().recordImport("Contact Rebalance", "Vector Mothership", *threeDimensionalMapImporter, threeDimensionalContactMothership->NumVectors());
   threeDimensionalContactMothership = rebalancedThreeDimensionalMothership;
   contactY = Teuchos::rcp((*threeDimensionalContactMothership)(0), false);             // current positions
   contactV = Teuchos::rcp((*threeDimensionalContactMothership)(1), false);             // velocities
@@ -700,6 +715,8 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
                                                Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs,
                                                Teuchos::RCP< set<int> > offProcessorContactIDs)
 {
+  PeridigmNS::ScopedTimer contactSearchTimer(PeridigmNS::Timer::self().getTimerId("Contact Search"));
+
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
   std::shared_ptr<const Epetra_Comm> comm_shared_ptr(&comm,NonDeleter<const Epetra_Comm>());
@@ -865,8 +882,34 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createReb
 	return rebalancedContactNeighborhoodData;
 }
 
+long long PeridigmNS::ContactManager::memoryBytes()
+{
+  long long bytes = 0;
+  if(!neighborhoodData.is_null())
+    bytes += neighborhoodData->memoryBytes();
+  if(!contactNeighborhoodData.is_null())
+    bytes += contactNeighborhoodData->memoryBytes();
+  if(!threeDimensionalContactMothership.is_null())
+    bytes += (long long)(threeDimensionalContactMothership->MyLength())*threeDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!oneDimensionalContactMothership.is_null())
+    bytes += (long long)(oneDimensionalContactMothership->MyLength())*oneDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!contactBlocks.is_null()){
+    for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
+      if(!contactBlockIt->getNeighborhoodData().is_null())
+        bytes += contactBlockIt->getNeighborhoodData()->memoryBytes();
+      if(contactBlockIt->hasHalfNeighborList())
+        bytes += contactBlockIt->getHalfNeighborList().memoryBytes();
+      if(!contactBlockIt->getDataManager().is_null())
+        bytes += contactBlockIt->getDataManager()->pointDataBytes() + contactBlockIt->getDataManager()->bondDataBytes();
+    }
+  }
+  return bytes;
+}
+
 void PeridigmNS::ContactManager::evaluateContactForce(double dt)
 {
+  static const int contactForceRegionId = PeridigmNS::PerformanceCounters::self().getRegionId("ContactModel::computeForce");
+
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
 
     Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = contactBlockIt->getNeighborhoodData();
@@ -876,11 +919,19 @@ void PeridigmNS::ContactManager::evaluateContactForce(double dt)
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactBlockIt->getContactModel();
 
-    if(!contactModel.is_null())
-      contactModel->computeForce(dt, 
-                                 numOwnedPoints,
-                                 ownedIDs,
-                                 neighborhoodList,
-                                 *dataManager);
+    if(!contactModel.is_null()){
+      PeridigmNS::ScopedBlockCost blockCost(*contactBlockIt, PeridigmNS::BlockBase::CONTACT_COST, nData->NumBonds());
+      PeridigmNS::ScopedCounters blockCounters(contactForceRegionId, nData->NumBonds());
+      if(contactBlockIt->hasHalfNeighborList())
+        contactModel->computeForce(dt,
+                                   contactBlockIt->getHalfNeighborList(),
+                                   *dataManager);
+      else
+        contactModel->computeForce(dt, 
+                                   numOwnedPoints,
+                                   ownedIDs,
+                                   neighborhoodList,
+                                   *dataManager);
+    }
   }
 }
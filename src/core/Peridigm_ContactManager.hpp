@@ -128,6 +128,14 @@ class ContactManager {
 
     void evaluateContactForce(double dt);
 
+    //! Number of bytes held by the contact neighbor lists, contact blocks, and contact motherships.
+    long long memoryBytes();
+
+    //! Number of contact candidate pairs found by the most recent contact search on this processor.
+    long long numContactPairs() const {
+      return contactNeighborhoodData.is_null() ? 0 : contactNeighborhoodData->NumBonds();
+    }
+
     //! Destructor.
     ~ContactManager() {}
 
@@ -216,6 +224,9 @@ class ContactManager {
     //! Contact search radius
     double contactSearchRadius;
 
+    //! Flag indicating whether contact forces are evaluated from half neighbor lists
+    bool useHalfNeighborList;
+
     //! Contact models
     std::map<std::string, Teuchos::RCP<const PeridigmNS::ContactModel> >
         contactModels;
@@ -55,10 +55,15 @@
 
 PeridigmNS::DataLoader::DataLoader(const Teuchos::ParameterList& contactParams,
                                    Teuchos::RCP<const Epetra_BlockMap> epetraMap)
-  : fileName("none"), fieldName("none"), exodusName("none"), exodusVariableIndex(-1), numRanks(-1), myRank(-1)
+  : fileName("none"), fieldName("none"), exodusName("none"), exodusVariableIndex(-1), numRanks(-1), myRank(-1),
+    exodusFileId(-1), numTimeSteps(0), loadedStep(-1), numPrefetchSteps(0), nextPrefetchStep(1), oldestNeededStep(1), prefetchGeneration(0), failedPrefetchStep(-1), stopPrefetching(false)
 {
   fileName = contactParams.get<std::string>("File Name");
   fieldName = contactParams.get<std::string>("Field Name");
+  // Optionally read steps ahead on a background thread while the current step is being computed
+  if(contactParams.isParameter("Prefetch Steps"))
+    numPrefetchSteps = contactParams.get<int>("Prefetch Steps");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numPrefetchSteps < 0, "**** Error in DataLoader::DataLoader(), \"Prefetch Steps\" must be non-negative.\n");
   numRanks = epetraMap->Comm().NumProc();
   myRank = epetraMap->Comm().MyPID();
   int vecLength = epetraMap->NumMyElements();
@@ -97,7 +102,7 @@ PeridigmNS::DataLoader::DataLoader(const Teuchos::ParameterList& contactParams,
   int compWordSize = sizeof(double);
   int ioWordSize = 0;
   float exodusVersion;
-  int exodusFileId = ex_open(exodusName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
+  exodusFileId = ex_open(exodusName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
   if(exodusFileId < 0){
     std::cout << "\n****Error on processor " << myRank << ": unable to open file " << exodusName.c_str() << "\n" << std::endl;
     reportExodusError(exodusFileId, "DataLoader()", "ex_open");
@@ -136,13 +141,55 @@ PeridigmNS::DataLoader::DataLoader(const Teuchos::ParameterList& contactParams,
     TEUCHOS_TEST_FOR_EXCEPT_MSG(exodusVariableIndex == -1, msg);
   }
 
-  // Close the genesis file
-  retval = ex_close(exodusFileId);
-  if (retval != 0) reportExodusError(retval, "DataLoader()", "ex_close");
+  numTimeSteps = ex_inquire_int(exodusFileId, EX_INQ_TIME);
+
+  // The file is kept open, it is closed in the destructor
 
   TEUCHOS_TEST_FOR_EXCEPT_MSG(numNodes != vecLength,
                               "**** Error in DataLoader::DataLoader(), unexpected array length.\n");
 
+  // The prefetch thread is started by the first call to loadDataFromFile(), so that its reads do not overlap
+  // with the Exodus calls made while the simulation is being set up
+  if(numPrefetchSteps > 0){
+    prefetchBuffer.resize(numPrefetchSteps, std::vector<double>(vecLength));
+    prefetchBufferStep.resize(numPrefetchSteps, -1);
+  }
+}
+
+PeridigmNS::DataLoader::~DataLoader()
+{
+  finishPrefetching();
+  if(exodusFileId >= 0)
+    ex_close(exodusFileId);
+}
+
+void PeridigmNS::DataLoader::startPrefetching()
+{
+  if(numPrefetchSteps > 0 && !prefetchThread.joinable()){
+    {
+      std::lock_guard<std::mutex> lock(prefetchMutex);
+      stopPrefetching = false;
+    }
+    prefetchThread = std::thread(&DataLoader::prefetch, this);
+  }
+}
+
+void PeridigmNS::DataLoader::finishPrefetching()
+{
+  if(prefetchThread.joinable()){
+    {
+      std::lock_guard<std::mutex> lock(prefetchMutex);
+      stopPrefetching = true;
+    }
+    prefetchCondition.notify_all();
+    prefetchThread.join();
+  }
+}
+
+std::mutex& PeridigmNS::DataLoader::exodusMutex()
+{
+  static std::mutex mutex;
+  return mutex;
 }
 
 std::vector<int> PeridigmNS::DataLoader::getFieldIds() const
@@ -152,28 +199,87 @@ std::vector<int> PeridigmNS::DataLoader::getFieldIds() const
   return fieldIds;
 }
 
-void PeridigmNS::DataLoader::loadDataFromFile(int step)
+void PeridigmNS::DataLoader::readStep(int step, std::vector<double>& data)
 {
-  int compWordSize = sizeof(double);
-  int ioWordSize = 0;
-  float exodusVersion;
-  int exodusFileId = ex_open(exodusName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
-  if(exodusFileId < 0){
-    std::cout << "\n****Error on processor " << myRank << ": unable to open file " << exodusName.c_str() << "\n" << std::endl;
-    reportExodusError(exodusFileId, "loadData()", "ex_open");
-  }
-
+  std::lock_guard<std::mutex> lock(exodusMutex());
   int objId = 0;
-  int retval = ex_get_var(exodusFileId, step, EX_NODAL, exodusVariableIndex, objId, scratchArray.size(), scratchArray.data());
+  int retval = ex_get_var(exodusFileId, step, EX_NODAL, exodusVariableIndex, objId, data.size(), data.data());
   if (retval != 0) reportExodusError(retval, "loadData()", "ex_get_var");
+}
 
+void PeridigmNS::DataLoader::prefetch()
+{
+  std::unique_lock<std::mutex> lock(prefetchMutex);
+  while(true){
+    // Wait until there is a step left to read and a free slot in the ring buffer
+    prefetchCondition.wait(lock, [this]{
+        return stopPrefetching ||
+          (nextPrefetchStep <= numTimeSteps && nextPrefetchStep < oldestNeededStep + numPrefetchSteps);
+      });
+    if(stopPrefetching)
+      return;
+    int step = nextPrefetchStep++;
+    int slot = step % numPrefetchSteps;
+    int generation = prefetchGeneration;
+    prefetchBufferStep[slot] = -1;
+    lock.unlock();
+    bool success = true;
+    try{
+      readStep(step, prefetchBuffer[slot]);
+    }
+    catch(...){
+      // The error is reported on the main thread, which falls back to a synchronous read
+      success = false;
+    }
+    lock.lock();
+    if(generation == prefetchGeneration){
+      if(success)
+        prefetchBufferStep[slot] = step;
+      else
+        failedPrefetchStep = step;
+    }
+    prefetchCondition.notify_all();
+  }
+}
+
+void PeridigmNS::DataLoader::loadDataFromFile(int step)
+{
+  // Nothing to do if the data for this step is already loaded
+  if(step == loadedStep)
+    return;
+
+  if(numPrefetchSteps > 0 && step <= numTimeSteps){
+    startPrefetching();
+    std::unique_lock<std::mutex> lock(prefetchMutex);
+    int slot = step % numPrefetchSteps;
+    // Restart the prefetch thread at the requested step if it is not in, or on its way into, the ring buffer
+    if(step < oldestNeededStep || step >= nextPrefetchStep + numPrefetchSteps){
+      prefetchGeneration++;
+      for(unsigned int i=0 ; i<prefetchBufferStep.size() ; ++i)
+        prefetchBufferStep[i] = -1;
+      nextPrefetchStep = step;
+    }
+    oldestNeededStep = step;
+    prefetchCondition.notify_all();
+    prefetchCondition.wait(lock, [this, step, slot]{ return prefetchBufferStep[slot] == step || failedPrefetchStep == step; });
+    if(prefetchBufferStep[slot] == step){
+      const std::vector<double>& data = prefetchBuffer[slot];
+      for (unsigned int i=0 ; i<data.size() ; i++)
+        (*scratchVector)[i] = data[i];
+      loadedStep = step;
+      // Release the slot so that the prefetch thread can move on to the next step
+      oldestNeededStep = step + 1;
+      prefetchCondition.notify_all();
+      return;
+    }
+  }
+
+  // Synchronous read
+  readStep(step, scratchArray);
   for (unsigned int i=0 ; i<scratchArray.size() ; i++) {
     (*scratchVector)[i] = scratchArray[i];
   }
-
-  // Close the genesis file
-  retval = ex_close(exodusFileId);
-  if (retval != 0) reportExodusError(retval, "loadData()", "ex_close");
+  loadedStep = step;
 }
 
 void PeridigmNS::DataLoader::copyDataToDataManagers(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks)
@@ -52,6 +52,9 @@
 #include "Peridigm_Block.hpp"
 #include <string>
 #include <iostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace PeridigmNS {
 
@@ -62,15 +65,26 @@ public:
   DataLoader(const Teuchos::ParameterList& contactParams,
              Teuchos::RCP<const Epetra_BlockMap> epetraMap);
 
-  ~DataLoader(){}
+  ~DataLoader();
 
   //! Returns a vector of field IDs corresponding to the variables associated with the material.
   std::vector<int> getFieldIds() const;
 
+  //! Loads data for the given step, from the prefetch buffer if it is available; the first call starts the prefetch thread.
   void loadDataFromFile(int step);
 
+  //! Stops the prefetch thread, it is restarted by the next call to loadDataFromFile().
+  void finishPrefetching();
+
+  //! Copies the most recently loaded data into the data managers.
   void copyDataToDataManagers(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
 
+  //! Returns true if steps are read ahead on a background thread.
+  bool prefetchEnabled() const { return numPrefetchSteps > 0; }
+
+  //! Mutex that must be held by any other thread making Exodus calls between loadDataFromFile() and finishPrefetching().
+  static std::mutex& exodusMutex();
+
   void reportExodusError(int errorCode,
                          const char *methodName,
                          const char *exodusMethodName);
@@ -87,6 +101,48 @@ protected:
   std::vector<double> scratchArray;
   Teuchos::RCP<Epetra_Vector> scratchVector;
 
+  //! Exodus file id, the file remains open for the duration of the simulation
+  int exodusFileId;
+
+  //! Number of time steps in the Exodus file
+  int numTimeSteps;
+
+  //! Step currently held in scratchVector
+  int loadedStep;
+
+  //! Number of steps read ahead of the current step, zero disables prefetching
+  int numPrefetchSteps;
+
+  //! Ring buffer of prefetched steps, the slot for step n is (n % numPrefetchSteps)
+  std::vector< std::vector<double> > prefetchBuffer;
+  std::vector<int> prefetchBufferStep;
+
+  //! Next step to be read by the prefetch thread
+  int nextPrefetchStep;
+
+  //! Oldest step that may still be requested; slots holding older steps may be overwritten
+  int oldestNeededStep;
+
+  //! Incremented whenever the prefetch thread is restarted at a different step, reads from the previous generation are discarded
+  int prefetchGeneration;
+
+  //! Step for which the most recent background read failed
+  int failedPrefetchStep;
+
+  bool stopPrefetching;
+  std::thread prefetchThread;
+  std::mutex prefetchMutex;
+  std::condition_variable prefetchCondition;
+
+  //! Starts the prefetch thread if prefetching is enabled and the thread is not running.
+  void startPrefetching();
+
+  //! Reads the given step from the Exodus file into the given array.
+  void readStep(int step, std::vector<double>& data);
+
+  //! Main loop of the prefetch thread.
+  void prefetch();
+
 private:
 
   //! Private to prohibit use.
@@ -50,9 +50,23 @@
 #include <Epetra_Comm.h>
 #include "Peridigm_DataManager.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
+#include <sstream>
 
 using namespace std;
 
+namespace {
+  //! Label under which the communication for the data of the given state (0 = NONE, 1 = N, 2 = NP1) is recorded.
+  string communicationLabel(int iState, const string& data, int length){
+    const char* stateNames[3] = { "STEP_NONE", "STEP_N", "STEP_NP1" };
+    stringstream label;
+    label << stateNames[iState] << " " << data;
+    if(length > 0)
+      label << length;
+    return label.str();
+  }
+}
+
 std::vector<int> PeridigmNS::DataManager::allGlobalFieldIds;
 Teuchos::RCP<const Epetra_BlockMap> PeridigmNS::DataManager::scalarGlobalMap;
 Teuchos::RCP<const Epetra_BlockMap> PeridigmNS::DataManager::vectorGlobalMap;
@@ -273,6 +287,30 @@ void PeridigmNS::DataManager::allocateData(vector<int> fieldIds)
   }
 }
 
+long long PeridigmNS::DataManager::pointDataBytes() const
+{
+  long long bytes = 0;
+  if(!stateN.is_null())
+    bytes += stateN->pointDataBytes();
+  if(!stateNP1.is_null())
+    bytes += stateNP1->pointDataBytes();
+  if(!stateNONE.is_null())
+    bytes += stateNONE->pointDataBytes();
+  return bytes;
+}
+
+long long PeridigmNS::DataManager::bondDataBytes() const
+{
+  long long bytes = 0;
+  if(!stateN.is_null())
+    bytes += stateN->bondDataBytes();
+  if(!stateNP1.is_null())
+    bytes += stateNP1->bondDataBytes();
+  if(!stateNONE.is_null())
+    bytes += stateNONE->bondDataBytes();
+  return bytes;
+}
+
 void PeridigmNS::DataManager::scatterToGhosts()
 {
   // goal:
@@ -363,6 +401,8 @@ void PeridigmNS::DataManager::scatterToGhosts()
         // scatter the data back from the owned (non-overlap) multivector into the overlap multivector
         Teuchos::RCP<Epetra_Import> importer = Teuchos::rcp(new Epetra_Import(overlapMap, *ownedMap));
         overlapPointMultiVector->Import(*ownedPointMultiVector, *importer, Insert);
+        if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+          PeridigmNS::CommunicationMonitor::self().recordImport("Scatter To Ghosts", communicationLabel(iState, "Point Data, Length ", elementSize), *importer, numVectors);
       }
     }
 
@@ -437,6 +477,8 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
         rebalancedState->allocatePointData(length, fieldIds, map);
         Epetra_Import importer(*map, state->getPointMultiVector(length)->Map());
         rebalancedState->getPointMultiVector(length)->Import(*state->getPointMultiVector(length), importer, Insert);
+        if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+          PeridigmNS::CommunicationMonitor::self().recordImport("Rebalance", communicationLabel(iState, "Point Data, Length ", PeridigmField::variableDimension(length)), importer, state->getPointMultiVector(length)->NumVectors());
       }
 
       // Allocate bond data and import from the old State to the rebalanced State
@@ -444,6 +486,8 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
         rebalancedState->allocateBondData(*bondFieldIds, rebalancedOwnedBondMap);      
         Epetra_Import importer(*rebalancedOwnedBondMap, *ownedBondMap);
         rebalancedState->getBondMultiVector()->Import(*state->getBondMultiVector(), importer, Insert);
+        if(PeridigmNS::CommunicationMonitor::self().isEnabled())
+          PeridigmNS::CommunicationMonitor::self().recordImport("Rebalance", communicationLabel(iState, "Bond Data", 0), importer, state->getBondMultiVector()->NumVectors());
       }
 
       // Set the State to the rebalanced State
@@ -510,6 +554,37 @@ void PeridigmNS::DataManager::copyLocallyOwnedDataFromDataManager(PeridigmNS::Da
   }
 }
 
+void PeridigmNS::DataManager::copyNeighborhoodDataFromDataManager(PeridigmNS::DataManager& source,
+                                                                   int numPoints,
+                                                                   const int* sourcePointIDs,
+                                                                   int firstSourceBond,
+                                                                   int numBonds)
+{
+  if(!stateNONE.is_null()){
+    TEUCHOS_TEST_FOR_EXCEPTION(source.getStateNONE().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+    stateNONE->copyNeighborhoodDataFromState(source.getStateNONE(), numPoints, sourcePointIDs, firstSourceBond, numBonds);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPTION(!source.getStateNONE().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+  }
+
+  if(!stateN.is_null()){
+    TEUCHOS_TEST_FOR_EXCEPTION(source.getStateN().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+    stateN->copyNeighborhoodDataFromState(source.getStateN(), numPoints, sourcePointIDs, firstSourceBond, numBonds);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPTION(!source.getStateN().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+  }
+
+  if(!stateNP1.is_null()){
+    TEUCHOS_TEST_FOR_EXCEPTION(source.getStateNP1().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+    stateNP1->copyNeighborhoodDataFromState(source.getStateNP1(), numPoints, sourcePointIDs, firstSourceBond, numBonds);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPTION(!source.getStateNP1().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyNeighborhoodDataFromDataManager() called with incompatible source and target.\n");
+  }
+}
+
 bool PeridigmNS::DataManager::hasData(int fieldId, PeridigmField::Step step)
 {
   bool hasData = false;
@@ -139,6 +139,12 @@ public:
   //! Returns RCP to the State NONE object
   Teuchos::RCP<State> getStateNONE(){ return stateNONE; }
 
+  //! Number of bytes allocated for point data, summed over all states.
+  long long pointDataBytes() const;
+
+  //! Number of bytes allocated for bond data, summed over all states.
+  long long bondDataBytes() const;
+
   /*! \brief Copies data from a different data manager based on global IDs.
    * 
    * Functions only if all the local IDs in the target map exist in and are
@@ -146,6 +152,19 @@ public:
    */
   void copyLocallyOwnedDataFromDataManager(PeridigmNS::DataManager& source);
 
+  /*! \brief Copies the data of a single neighborhood from a different data manager based on local IDs.
+   *
+   * Point sourcePointIDs[i] in the source overlap maps is copied to local ID i, and bonds
+   * firstSourceBond through firstSourceBond+numBonds-1 are copied to the bonds of the first point.
+   * Intended for a small data manager that is reused for many neighborhoods; the data managers
+   * must hold the same fields.
+   */
+  void copyNeighborhoodDataFromDataManager(PeridigmNS::DataManager& source,
+                                           int numPoints,
+                                           const int* sourcePointIDs,
+                                           int firstSourceBond,
+                                           int numBonds);
+
   //! Query the existence of a particular field Id at a particular step.
   bool hasData(int fieldId, PeridigmField::Step step);
 
@@ -0,0 +1,111 @@
+/*! \file Peridigm_HalfNeighborList.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <cstring>
+#include "Peridigm_HalfNeighborList.hpp"
+#include "Peridigm_NeighborhoodData.hpp"
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+PeridigmNS::HalfNeighborList::HalfNeighborList(const NeighborhoodData& neighborhoodData)
+  : numOwnedPoints(0), numPairedBonds(0)
+{
+  build(neighborhoodData.NumOwnedPoints(), neighborhoodData.NeighborhoodList());
+}
+
+void PeridigmNS::HalfNeighborList::build(int numOwnedPoints_, const int* neighborhoodList)
+{
+  numOwnedPoints = numOwnedPoints_;
+  numPairedBonds = 0;
+  bonds.clear();
+
+  // Offsets of each point into the neighborhood list and into the bond data
+  vector<int> listOffset(numOwnedPoints), bondOffset(numOwnedPoints + 1);
+  int neighborhoodListIndex(0), numBonds(0);
+  for(int p=0 ; p<numOwnedPoints ; ++p){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex];
+    listOffset[p] = neighborhoodListIndex + 1;
+    bondOffset[p] = numBonds;
+    neighborhoodListIndex += numNeighbors + 1;
+    numBonds += numNeighbors;
+  }
+  bondOffset[numOwnedPoints] = numBonds;
+
+  // Sorted (neighbor, bond index) pairs for each point, used to find reverse bonds
+  vector< pair<int,int> > sortedNeighbors(numBonds);
+  for(int p=0 ; p<numOwnedPoints ; ++p){
+    for(int b=bondOffset[p] ; b<bondOffset[p+1] ; ++b)
+      sortedNeighbors[b] = make_pair(neighborhoodList[listOffset[p] + b - bondOffset[p]], b);
+    sort(sortedNeighbors.begin() + bondOffset[p], sortedNeighbors.begin() + bondOffset[p+1]);
+  }
+
+  bonds.reserve(BOND_SIZE*(numBonds/2 + 1));
+  for(int p=0 ; p<numOwnedPoints ; ++p){
+    for(int b=bondOffset[p] ; b<bondOffset[p+1] ; ++b){
+      int q = neighborhoodList[listOffset[p] + b - bondOffset[p]];
+      int reverseBond = -1;
+      if(q < numOwnedPoints && q != p){
+        vector< pair<int,int> >::const_iterator first = sortedNeighbors.begin() + bondOffset[q];
+        vector< pair<int,int> >::const_iterator last = sortedNeighbors.begin() + bondOffset[q+1];
+        vector< pair<int,int> >::const_iterator it = lower_bound(first, last, make_pair(p, -1));
+        if(it != last && it->first == p)
+          reverseBond = it->second;
+      }
+      // A bond with a reverse bond is stored once, with the lower-numbered point
+      if(reverseBond != -1 && q < p)
+        continue;
+      bonds.push_back(p);
+      bonds.push_back(q);
+      bonds.push_back(b);
+      bonds.push_back(reverseBond);
+      if(reverseBond != -1)
+        numPairedBonds += 1;
+    }
+  }
+}
@@ -0,0 +1,113 @@
+/*! \file Peridigm_HalfNeighborList.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_HALFNEIGHBORLIST_HPP
+#define PERIDIGM_HALFNEIGHBORLIST_HPP
+
+#include <vector>
+
+namespace PeridigmNS {
+
+class NeighborhoodData;
+
+/*! \brief Half (Newton's third law) neighbor list for pairwise-symmetric models.
+ *
+ *  The neighborhood list of a block holds each bond between two owned points twice,
+ *  once from each end.  The half list holds it once, so that a pairwise-symmetric model
+ *  can evaluate the bond a single time and apply the equal and opposite forces together.
+ *  Each entry is a bond given by four integers:  the owned point, the neighbor, the index
+ *  of the bond in the bond data of the owned point, and the index of the reverse bond in
+ *  the bond data of the neighbor.  The reverse bond index is -1 when the neighbor is a
+ *  ghost, or when the neighbor does not have the point in its own neighborhood (for example,
+ *  with a variable horizon).  Such bonds are one-sided; the processor or block that owns the
+ *  neighbor evaluates the other half.
+ *
+ *  Owned points are assumed to be the first numOwnedPoints local IDs, as they are for
+ *  block and contact block neighborhoods.
+ */
+class HalfNeighborList {
+
+public:
+
+  //! Number of integers stored for each bond.
+  static const int BOND_SIZE = 4;
+
+  HalfNeighborList() : numOwnedPoints(0), numPairedBonds(0) {}
+
+  HalfNeighborList(int numOwnedPoints_, const int* neighborhoodList) : numOwnedPoints(0), numPairedBonds(0) {
+    build(numOwnedPoints_, neighborhoodList);
+  }
+
+  HalfNeighborList(const NeighborhoodData& neighborhoodData);
+
+  //! Create the half list from a neighborhood list in the standard [numNeighbors, neighbors...] format.
+  void build(int numOwnedPoints_, const int* neighborhoodList);
+
+  int NumOwnedPoints() const { return numOwnedPoints; }
+
+  //! Number of bonds in the half list.
+  int NumBonds() const { return static_cast<int>(bonds.size())/BOND_SIZE; }
+
+  //! Number of bonds whose reverse bond is also represented by the entry.
+  int NumPairedBonds() const { return numPairedBonds; }
+
+  //! Bond data, BOND_SIZE integers per bond.
+  const int* Bonds() const { return bonds.empty() ? 0 : &bonds[0]; }
+
+  long long memoryBytes() const {
+    return (long long)bonds.capacity()*sizeof(int) + sizeof(HalfNeighborList);
+  }
+
+protected:
+  int numOwnedPoints;
+  int numPairedBonds;
+  std::vector<int> bonds;
+};
+
+}
+
+#endif // PERIDIGM_HALFNEIGHBORLIST_HPP
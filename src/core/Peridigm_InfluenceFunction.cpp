@@ -56,7 +56,9 @@ PeridigmNS::InfluenceFunction& PeridigmNS::InfluenceFunction::self() {
   return influenceFunction;
 }
 
-PeridigmNS::InfluenceFunction::InfluenceFunction() : m_influenceFunction(NULL) {
+PeridigmNS::InfluenceFunction::InfluenceFunction()
+  : m_influenceFunction(NULL), m_tableIntervals(0), m_tableInterpolation(InfluenceFunctionTable::CUBIC),
+    m_lastHorizon(0.0), m_lastTable(NULL) {
 
   // Set the influence function to One by default
   setInfluenceFunction("One");
@@ -78,3 +80,56 @@ double PeridigmNS::InfluenceFunction::userDefinedInfluenceFunction(double zeta,
     value = rtcFunction.getValueOfVar("value");
   return value;
 }
+
+double PeridigmNS::InfluenceFunction::tabulatedUserDefinedInfluenceFunction(double zeta, double horizon){
+  const InfluenceFunctionTable* table = self().getTable(horizon);
+  if(table != NULL && table->contains(zeta))
+    return (*table)(zeta);
+  return userDefinedInfluenceFunction(zeta, horizon);
+}
+
+const PeridigmNS::InfluenceFunctionTable* PeridigmNS::InfluenceFunction::getTable(double horizon){
+
+  // Blocks with a constant horizon look up the same table for every bond
+  if(m_lastTable != NULL && horizon == m_lastHorizon)
+    return m_lastTable;
+
+  // Limit the number of tables created for variable horizons
+  static const size_t maxTables = 32;
+
+  const InfluenceFunctionTable* table = NULL;
+  map<double, InfluenceFunctionTable>::const_iterator it = m_tables.find(horizon);
+  if(it != m_tables.end())
+    table = &it->second;
+  else if(m_tables.size() < maxTables && horizon > 0.0)
+    table = &m_tables.insert(std::make_pair(horizon, InfluenceFunctionTable(&userDefinedInfluenceFunction, horizon, m_tableIntervals, m_tableInterpolation))).first->second;
+
+  // Tables with non-finite samples are kept, so that they are not recreated, but not used
+  if(table != NULL && !table->isValid())
+    table = NULL;
+
+  m_lastHorizon = horizon;
+  m_lastTable = table;
+  return table;
+}
+
+PeridigmNS::InfluenceFunctionTable::InfluenceFunctionTable(double (*function)(double, double), double horizon, int numIntervals, Interpolation interpolation)
+  : m_horizon(horizon), m_numIntervals(numIntervals), m_inverseSpacing(numIntervals/horizon), m_interpolation(interpolation),
+    m_isValid(true), m_values(numIntervals+1), m_slopes(numIntervals+1)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numIntervals < 2 || !(horizon > 0.0), "**** Error:  InfluenceFunctionTable requires a positive horizon and at least two intervals.\n");
+
+  double spacing = horizon/numIntervals;
+  for(int i=0 ; i<=numIntervals ; ++i){
+    m_values[i] = function(i == numIntervals ? horizon : i*spacing, horizon);
+    if(!std::isfinite(m_values[i]))
+      m_isValid = false;
+  }
+  if(!m_isValid)
+    return;
+
+  m_slopes[0] = m_values[1] - m_values[0];
+  for(int i=1 ; i<numIntervals ; ++i)
+    m_slopes[i] = 0.5*(m_values[i+1] - m_values[i-1]);
+  m_slopes[numIntervals] = m_values[numIntervals] - m_values[numIntervals-1];
+}
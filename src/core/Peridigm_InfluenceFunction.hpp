@@ -51,6 +51,9 @@
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_Assert.hpp>
 #include <string>
+#include <vector>
+#include <map>
+#include <cmath>
 
 #include <Trilinos_version.h>
 #if TRILINOS_MAJOR_MINOR_VERSION >= 111100
@@ -65,12 +68,14 @@ namespace PeridigmInfluenceFunction {
 
 // Built-in influence functions should be implemented here
 // and associated with a string in InfluenceFunction::setInfluenceFunction(), below.
+// Each has a corresponding function object, below, through which kernels may be
+// specialized so that the influence function is inlined.
 
-static double one(double zeta, double horizon){
+inline double one(double zeta, double horizon){
   return 1.0;
 }
 
-static double parabolicDecay(double zeta, double horizon){
+inline double parabolicDecay(double zeta, double horizon){
   if(zeta > horizon)
     return 0.0;
 
@@ -79,15 +84,76 @@ static double parabolicDecay(double zeta, double horizon){
   return value;
 }
 
-static double gaussian(double zeta, double horizon)
+inline double gaussian(double zeta, double horizon)
 {
   double h2=horizon*horizon*0.4*0.4;
   double xi2=zeta*zeta;
   return exp(-xi2/h2);
 }
 
+struct One {
+  double operator()(double zeta, double horizon) const { return one(zeta, horizon); }
+};
+
+struct ParabolicDecay {
+  double operator()(double zeta, double horizon) const { return parabolicDecay(zeta, horizon); }
+};
+
+struct Gaussian {
+  double operator()(double zeta, double horizon) const { return gaussian(zeta, horizon); }
+};
+
 }
 
+/*! \brief An influence function sampled at evenly spaced points over [0, horizon].
+ *
+ *  Values between the samples are found by linear interpolation, or by cubic Hermite
+ *  interpolation with slopes taken from central differences of the samples.
+ */
+class InfluenceFunctionTable {
+
+public:
+
+  enum Interpolation { LINEAR, CUBIC };
+
+  //! Samples function(zeta, horizon) at numIntervals+1 points.
+  InfluenceFunctionTable(double (*function)(double, double), double horizon, int numIntervals, Interpolation interpolation);
+
+  //! Returns false if any sample is not finite (for example a function singular at zeta = 0), in which case the table must not be used.
+  bool isValid() const { return m_isValid; }
+
+  //! Returns true if zeta lies within the table.
+  bool contains(double zeta) const { return zeta >= 0.0 && zeta <= m_horizon; }
+
+  //! Evaluates the table, zeta must lie within the table.
+  double operator()(double zeta) const {
+    double s = zeta*m_inverseSpacing;
+    int i = static_cast<int>(s);
+    if(i >= m_numIntervals)
+      i = m_numIntervals - 1;
+    double t = s - i;
+    if(m_interpolation == LINEAR)
+      return m_values[i] + t*(m_values[i+1] - m_values[i]);
+    double t2 = t*t;
+    double t3 = t2*t;
+    return (2.0*t3 - 3.0*t2 + 1.0)*m_values[i] + (t3 - 2.0*t2 + t)*m_slopes[i]
+      + (-2.0*t3 + 3.0*t2)*m_values[i+1] + (t3 - t2)*m_slopes[i+1];
+  }
+
+private:
+
+  double m_horizon;
+  int m_numIntervals;
+  double m_inverseSpacing;
+  Interpolation m_interpolation;
+  //! False if any sample is not finite
+  bool m_isValid;
+  //! Sampled values
+  std::vector<double> m_values;
+  //! Slopes at the samples, per interval
+  std::vector<double> m_slopes;
+};
+
 class InfluenceFunction {
 
 public:
@@ -142,10 +208,32 @@ public:
         msg += "**** " + rtcFunction.getErrors() + "\n";
         TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
       }    
-      m_influenceFunction = &userDefinedInfluenceFunction;
+      m_tables.clear();
+      m_lastTable = NULL;
+      if(m_tableIntervals > 0)
+        m_influenceFunction = &tabulatedUserDefinedInfluenceFunction;
+      else
+        m_influenceFunction = &userDefinedInfluenceFunction;
     }
   }
 
+  /*! \brief Sets the resolution and interpolation of the tables for user-defined influence functions.
+   *
+   *  Must be called prior to setInfluenceFunction().  A user-defined influence function is sampled
+   *  into a table for each horizon with which it is evaluated, so that the run-time compiler is called
+   *  only when the table is created.  Zero intervals (the default) disable the tables.
+   */
+  void setTableParameters(int numIntervals, std::string interpolation) {
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numIntervals < 0, "**** Error:  InfluenceFunction::setTableParameters(), the number of intervals must be non-negative.\n");
+    m_tableIntervals = numIntervals;
+    if(interpolation == "Linear")
+      m_tableInterpolation = InfluenceFunctionTable::LINEAR;
+    else if(interpolation == "Cubic")
+      m_tableInterpolation = InfluenceFunctionTable::CUBIC;
+    else
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  InfluenceFunction::setTableParameters(), invalid interpolation \"" + interpolation + "\", must be \"Linear\" or \"Cubic\".\n");
+  }
+
   //! Returns a function pointer to the influence function.
   functionPointer getInfluenceFunction() {
     TEUCHOS_TEST_FOR_EXCEPT_MSG(m_influenceFunction == NULL,
@@ -156,6 +244,33 @@ public:
   //! Function for evaluating user-defined influence functions
   static double userDefinedInfluenceFunction(double zeta, double horizon);
 
+  //! Function for evaluating user-defined influence functions from the table for the given horizon
+  static double tabulatedUserDefinedInfluenceFunction(double zeta, double horizon);
+
+  /*! \brief Returns the table of the user-defined influence function for the given horizon, creating it if needed.
+   *
+   *  Returns NULL if the maximum number of tables has been reached, for example with a variable horizon,
+   *  or if the influence function is not finite at a sample point, in which case the influence function
+   *  should be evaluated directly.
+   */
+  const InfluenceFunctionTable* getTable(double horizon);
+
+  //! Identifies the influence functions for which kernels may be specialized.
+  enum Type { ONE, PARABOLIC_DECAY, GAUSSIAN, TABULATED, OTHER };
+
+  //! Returns the type of the given influence function.
+  static Type getType(functionPointer p) {
+    if(p == &PeridigmInfluenceFunction::one)
+      return ONE;
+    if(p == &PeridigmInfluenceFunction::parabolicDecay)
+      return PARABOLIC_DECAY;
+    if(p == &PeridigmInfluenceFunction::gaussian)
+      return GAUSSIAN;
+    if(p == &tabulatedUserDefinedInfluenceFunction)
+      return TABULATED;
+    return OTHER;
+  }
+
 private:
 
   //! Constructor, private to prevent use (singleton class).
@@ -172,8 +287,36 @@ private:
 
   //! Function pointer to the influence function with the signature:  double function(double zeta, double horizon).
   functionPointer m_influenceFunction;
+
+  //! Number of intervals in the tables of user-defined influence functions
+  int m_tableIntervals;
+
+  //! Interpolation of the tables of user-defined influence functions
+  InfluenceFunctionTable::Interpolation m_tableInterpolation;
+
+  //! Tables of the user-defined influence function, by horizon
+  std::map<double, InfluenceFunctionTable> m_tables;
+
+  //! Horizon and table of the most recent call to getTable()
+  double m_lastHorizon;
+  const InfluenceFunctionTable* m_lastTable;
 };
 
+namespace PeridigmInfluenceFunction {
+
+//! Function object for a tabulated user-defined influence function, evaluated directly outside the table.
+struct Tabulated {
+  Tabulated(const InfluenceFunctionTable& table_) : table(table_) {}
+  double operator()(double zeta, double horizon) const {
+    if(table.contains(zeta))
+      return table(zeta);
+    return InfluenceFunction::userDefinedInfluenceFunction(zeta, horizon);
+  }
+  const InfluenceFunctionTable& table;
+};
+
+}
+
 }
 
 #endif // PERIDIGM_INFLUENCEFUNCTION_HPP
@@ -62,6 +62,8 @@
 #include "Peridigm_Version.hpp"
 #include "Peridigm_Factory.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
+#include "Peridigm_CommunicationMonitor.hpp"
 
 using namespace std;
 
@@ -116,6 +118,7 @@ int main(int argc, char *argv[]) {
     peridigm->executeSolvers();
 
     peridigm->printMemoryStats();
+    peridigm->printBlockCosts();
 
 /****************************
 	EpetraExt::ModelEvaluator::InArgs params_in = App->createInArgs();
@@ -150,6 +153,9 @@ int main(int argc, char *argv[]) {
 
   PeridigmNS::Timer::self().stopTimer("Total");
   PeridigmNS::Timer::self().printTimingData(cout);
+  PeridigmNS::Timer::self().writeTrace();
+  PeridigmNS::PerformanceCounters::self().printCounterData(cout);
+  PeridigmNS::CommunicationMonitor::self().printCommunicationData(cout);
 
 #ifdef HAVE_MPI
   MPI_Finalize() ;
@@ -46,10 +46,30 @@
 //@HEADER
 
 #include "Peridigm_ModelEvaluator.hpp"
+#include "Peridigm_Timer.hpp"
+#include "Peridigm_PerformanceCounters.hpp"
 
 using namespace std;
 
 PeridigmNS::ModelEvaluator::ModelEvaluator(){
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  damageTimerId = timer.getTimerId("Damage");
+  materialForceTimerId = timer.getTimerId("Material Force");
+  jacobianTimerId = timer.getTimerId("Material Jacobian");
+  contactForceTimerId = timer.getTimerId("Contact Force");
+  PeridigmNS::PerformanceCounters& performanceCounters = PeridigmNS::PerformanceCounters::self();
+  damageRegionId = performanceCounters.getRegionId("DamageModel::computeDamage");
+  materialForceRegionId = performanceCounters.getRegionId("Material::computeForce");
+}
+
+void
+PeridigmNS::ModelEvaluator::initializeTimers(std::vector<PeridigmNS::Block>& blocks) const
+{
+  if(blockTimerIds.size() == blocks.size())
+    return;
+  blockTimerIds.clear();
+  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks.begin() ; blockIt != blocks.end() ; blockIt++)
+    blockTimerIds.push_back( PeridigmNS::Timer::self().getTimerId(blockIt->getName()) );
 }
 
 PeridigmNS::ModelEvaluator::~ModelEvaluator(){
@@ -60,18 +80,25 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
 {
   const double dt = workset->timeStep;
   std::vector<PeridigmNS::Block>::iterator blockIt;
+  int blockIndex;
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  initializeTimers(*workset->blocks);
 
   // ---- Evaluate Damage ---
 
-  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+  timer.startTimer(damageTimerId);
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
 
     Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
     if(!damageModel.is_null()){
+      PeridigmNS::ScopedTimer blockTimer(blockTimerIds[blockIndex]);
       Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
       const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
       const int* ownedIDs = neighborhoodData->OwnedIDs();
       const int* neighborhoodList = neighborhoodData->NeighborhoodList();
       Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+      PeridigmNS::ScopedBlockCost blockCost(*blockIt, PeridigmNS::BlockBase::DAMAGE_COST, neighborhoodData->NumBonds());
+      PeridigmNS::ScopedCounters blockCounters(damageRegionId, neighborhoodData->NumBonds());
       damageModel->computeDamage(dt,
                                  numOwnedPoints,
                                  ownedIDs,
@@ -79,11 +106,14 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
                                  *dataManager);
     }
   }
+  timer.stopTimer(damageTimerId);
 
   // ---- Evaluate Internal Force ----
 
-  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+  timer.startTimer(materialForceTimerId);
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
 
+    PeridigmNS::ScopedTimer blockTimer(blockTimerIds[blockIndex]);
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
     const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
     const int* ownedIDs = neighborhoodData->OwnedIDs();
@@ -91,16 +121,22 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
 
+    PeridigmNS::ScopedBlockCost blockCost(*blockIt, PeridigmNS::BlockBase::FORCE_COST, neighborhoodData->NumBonds());
+    PeridigmNS::ScopedCounters blockCounters(materialForceRegionId, neighborhoodData->NumBonds());
     materialModel->computeForce(dt,
                                 numOwnedPoints,
                                 ownedIDs,
                                 neighborhoodList,
                                 *dataManager);
   }
+  timer.stopTimer(materialForceTimerId);
 
   // ---- Evaluate Contact ----
-  if(!workset->contactManager.is_null())
+  if(!workset->contactManager.is_null()){
+    timer.startTimer(contactForceTimerId);
     workset->contactManager->evaluateContactForce(dt);
+    timer.stopTimer(contactForceTimerId);
+  }
 }
 
 void
@@ -110,11 +146,16 @@ PeridigmNS::ModelEvaluator::evalJacobian(Teuchos::RCP<Workset> workset) const
   std::vector<PeridigmNS::Block>::iterator blockIt;
   PeridigmNS::Material::JacobianType jacobianType = *(workset->jacobianType);
   PeridigmNS::SerialMatrix& jacobian = *(workset->jacobian);
+  int blockIndex;
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  initializeTimers(*workset->blocks);
 
   // ---- Compute the Tangent Stiffness Matrix ----
 
-  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+  timer.startTimer(jacobianTimerId);
+  for(blockIt = workset->blocks->begin(), blockIndex = 0 ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
 
+    PeridigmNS::ScopedTimer blockTimer(blockTimerIds[blockIndex]);
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
     const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
     const int* ownedIDs = neighborhoodData->OwnedIDs();
@@ -122,6 +163,7 @@ PeridigmNS::ModelEvaluator::evalJacobian(Teuchos::RCP<Workset> workset) const
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
 
+    PeridigmNS::ScopedBlockCost blockCost(*blockIt, PeridigmNS::BlockBase::JACOBIAN_COST, neighborhoodData->NumBonds());
     materialModel->computeJacobian(dt,
                                    numOwnedPoints,
                                    ownedIDs,
@@ -130,4 +172,5 @@ PeridigmNS::ModelEvaluator::evalJacobian(Teuchos::RCP<Workset> workset) const
                                    jacobian,
                                    jacobianType);
   }
+  timer.stopTimer(jacobianTimerId);
 }
@@ -87,6 +87,22 @@ namespace PeridigmNS {
 
     //! Private to prohibit copying
     ModelEvaluator& operator=(const ModelEvaluator&);
+
+    //! Registers the per-block timers the first time a given set of blocks is evaluated.
+    void initializeTimers(std::vector<PeridigmNS::Block>& blocks) const;
+
+    //! Timer ids for the phases of the model evaluation.
+    int damageTimerId;
+    int materialForceTimerId;
+    int jacobianTimerId;
+    int contactForceTimerId;
+
+    //! Timer ids for each block, nested within the phase timers.
+    mutable std::vector<int> blockTimerIds;
+
+    //! Hardware performance counter region ids.
+    int damageRegionId;
+    int materialForceRegionId;
   };
 }
 
@@ -113,13 +113,22 @@ public:
 	return neighborhoodList;
   }
 
+  //! Number of bonds, i.e., the neighborhood list size less the per-point neighbor counts.
+  long long NumBonds() const{
+	return (long long)neighborhoodListSize - (long long)numOwnedPoints;
+  }
+
   double memorySize() const{
-    int sizeInBytes =
-      (2*numOwnedPoints + neighborhoodListSize + 2)*sizeof(int) + 3*sizeof(int*);
-    double sizeInMegabytes = sizeInBytes/1048576.0;
+    double sizeInMegabytes = memoryBytes()/1048576.0;
     return sizeInMegabytes;
   }
 
+  long long memoryBytes() const{
+    long long sizeInBytes =
+      (2*(long long)numOwnedPoints + (long long)neighborhoodListSize + 2)*sizeof(int) + 3*sizeof(int*);
+    return sizeInBytes;
+  }
+
 protected:
   int numOwnedPoints;
   int* ownedIDs;
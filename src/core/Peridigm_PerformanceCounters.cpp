@@ -0,0 +1,288 @@
+/*! \file Peridigm_PerformanceCounters.cpp */
+
+#include "Peridigm_PerformanceCounters.hpp"
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+
+#ifdef HAVE_MPI
+#include <Epetra_MpiComm.h>
+#else
+typedef int MPI_Comm;
+#define MPI_COMM_WORLD 1
+#include <Epetra_SerialComm.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+
+using namespace std;
+
+namespace {
+
+  //! Event names, in the order of PerformanceCounters::Event.
+  const char* eventNames[PeridigmNS::PerformanceCounters::NUM_EVENTS] = { "cycles", "instructions", "L1D misses", "LLC misses", "branch misses" };
+
+  //! Cache line size assumed when estimating memory traffic from last-level cache misses.
+  const double cacheLineBytes = 64.0;
+
+#ifdef __linux__
+  //! Opens a counter for the calling thread, user space only; the first counter opened becomes the group leader.
+  int openEvent(unsigned int type, unsigned long long config, int groupFd){
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (groupFd == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>( syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0) );
+  }
+#endif
+}
+
+PeridigmNS::PerformanceCounters& PeridigmNS::PerformanceCounters::self() {
+  static PerformanceCounters performanceCounters;
+  return performanceCounters;
+}
+
+PeridigmNS::PerformanceCounters::PerformanceCounters()
+  : enabled(false), groupFd(-1), numOpenEvents(0), timeEnabled(0), timeRunning(0) {
+  for(int i=0 ; i<NUM_EVENTS ; ++i){
+    eventFds[i] = -1;
+    eventSlots[i] = -1;
+  }
+}
+
+PeridigmNS::PerformanceCounters::~PerformanceCounters() {
+#ifdef __linux__
+  for(int i=0 ; i<NUM_EVENTS ; ++i){
+    if(eventFds[i] != -1)
+      close(eventFds[i]);
+  }
+#endif
+}
+
+bool PeridigmNS::PerformanceCounters::enable(string& message) {
+
+  message.clear();
+  if(enabled)
+    return true;
+
+#ifdef __linux__
+  const unsigned int types[NUM_EVENTS] = { PERF_TYPE_HARDWARE,
+                                           PERF_TYPE_HARDWARE,
+                                           PERF_TYPE_HW_CACHE,
+                                           PERF_TYPE_HARDWARE,
+                                           PERF_TYPE_HARDWARE };
+  const unsigned long long configs[NUM_EVENTS] = { PERF_COUNT_HW_CPU_CYCLES,
+                                                   PERF_COUNT_HW_INSTRUCTIONS,
+                                                   PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                                                   PERF_COUNT_HW_CACHE_MISSES,
+                                                   PERF_COUNT_HW_BRANCH_MISSES };
+
+  int firstError = 0;
+  string unavailableEvents;
+  for(int i=0 ; i<NUM_EVENTS ; ++i){
+    int fd = openEvent(types[i], configs[i], groupFd);
+    if(fd == -1){
+      if(firstError == 0)
+        firstError = errno;
+      unavailableEvents += (unavailableEvents.empty() ? "" : ", ") + string(eventNames[i]);
+      continue;
+    }
+    if(groupFd == -1)
+      groupFd = fd;
+    eventFds[i] = fd;
+    eventSlots[i] = numOpenEvents++;
+  }
+
+  if(numOpenEvents == 0){
+    message = "perf_event_open() failed (" + string(strerror(firstError)) + "), check /proc/sys/kernel/perf_event_paranoid";
+    return false;
+  }
+
+  ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  enabled = true;
+
+  if(!unavailableEvents.empty())
+    message = "unavailable events: " + unavailableEvents;
+  return true;
+#else
+  message = "hardware performance counters are supported only on Linux";
+  return false;
+#endif
+}
+
+int PeridigmNS::PerformanceCounters::getRegionId(const string& name) {
+  map<string, int>::iterator it = regionIds.find(name);
+  if(it != regionIds.end())
+    return it->second;
+  int regionId = static_cast<int>( regionNames.size() );
+  regionIds[name] = regionId;
+  regionNames.push_back(name);
+  regions.push_back(Region());
+  return regionId;
+}
+
+void PeridigmNS::PerformanceCounters::readCounters(long long* values) {
+  for(int i=0 ; i<NUM_EVENTS ; ++i)
+    values[i] = 0;
+#ifdef __linux__
+  // Group read format:  number of events, time enabled, time running, then the event values
+  unsigned long long buffer[3 + NUM_EVENTS];
+  ssize_t bytesRead = read(groupFd, buffer, sizeof(buffer));
+  if(bytesRead < static_cast<ssize_t>( (3 + numOpenEvents)*sizeof(unsigned long long) ))
+    return;
+  timeEnabled = static_cast<long long>( buffer[1] );
+  timeRunning = static_cast<long long>( buffer[2] );
+  for(int i=0 ; i<NUM_EVENTS ; ++i){
+    if(eventSlots[i] != -1)
+      values[i] = static_cast<long long>( buffer[3 + eventSlots[i]] );
+  }
+#endif
+}
+
+void PeridigmNS::PerformanceCounters::printCounterData(ostream &out) {
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+
+  // Nothing to report unless counting was enabled on at least one processor
+  int localEnabled = enabled ? 1 : 0;
+  int globalEnabled(0);
+  Teuchos::reduceAll<int, int>(*teuchosComm, Teuchos::REDUCE_MAX, 1, &localEnabled, &globalEnabled);
+  if(globalEnabled == 0)
+    return;
+
+  // An event is reported only if it was counted on every processor
+  vector<int> localAvailable(NUM_EVENTS), globalAvailable(NUM_EVENTS);
+  for(int i=0 ; i<NUM_EVENTS ; ++i)
+    localAvailable[i] = (enabled && eventSlots[i] != -1 && timeRunning > 0) ? 1 : 0;
+  Teuchos::reduceAll<int, int>(*teuchosComm, Teuchos::REDUCE_MIN, NUM_EVENTS, &localAvailable[0], &globalAvailable[0]);
+
+  // Fraction of the time the counters were actually scheduled (less than one if the PMU was multiplexed)
+  double localRunning = (timeEnabled > 0) ? static_cast<double>(timeRunning)/timeEnabled : 1.0;
+  double minRunning(0.0);
+  Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MIN, 1, &localRunning, &minRunning);
+
+  // Regions are registered collectively, so the region ids agree across processors
+  int localCount = static_cast<int>( regions.size() );
+  int count(0);
+  Teuchos::reduceAll<int, int>(*teuchosComm, Teuchos::REDUCE_MIN, 1, &localCount, &count);
+  if(count == 0)
+    return;
+
+  const int numValues = NUM_EVENTS + 2;
+  vector<double> values(numValues*count), totals(numValues*count);
+  vector<double> calls(count), maxCalls(count);
+  for(int r=0 ; r<count ; ++r){
+    for(int i=0 ; i<NUM_EVENTS ; ++i)
+      values[numValues*r + i] = static_cast<double>(regions[r].counts[i]);
+    values[numValues*r + NUM_EVENTS] = 1.0e-9*regions[r].time;
+    values[numValues*r + NUM_EVENTS + 1] = static_cast<double>(regions[r].bonds);
+    calls[r] = static_cast<double>(regions[r].calls);
+  }
+  Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, numValues*count, &values[0], &totals[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, count, &calls[0], &maxCalls[0]);
+
+  if(teuchosComm->getRank() != 0)
+    return;
+
+  unsigned int nameLength = 6;
+  for(int r=0 ; r<count ; ++r){
+    if(regionNames[r].size() > nameLength) nameLength = regionNames[r].size();
+  }
+
+  int indent = 13;
+  const char* headers[] = { "Calls", "Time", "Bonds", "IPC", "L1D/bond", "LLC/bond", "Branch/bond", "ns/bond", "Bytes/bond" };
+  const int numHeaders = sizeof(headers)/sizeof(headers[0]);
+
+  out << "Hardware Performance Counters";
+  if(nProc > 1) out << " (summed over processors)";
+  out << ":" << endl;
+  out << "  ";
+  out.width(nameLength + 2); out << left << "";
+  for(int h=0 ; h<numHeaders ; ++h){
+    out.width(indent); out << right << headers[h];
+  }
+  out << endl;
+
+  for(int r=0 ; r<count ; ++r){
+    const double* total = &totals[numValues*r];
+    double time = total[NUM_EVENTS];
+    double bonds = total[NUM_EVENTS + 1];
+
+    // Per-bond metrics are reported only for regions that process bonds
+    vector<string> fields;
+    ostringstream field;
+    field << static_cast<long long>(maxCalls[r]);
+    fields.push_back(field.str());
+    field.str(""); field.setf(ios::fixed); field.precision(2);
+    field << time;
+    fields.push_back(field.str());
+    field.str(""); field.unsetf(ios::fixed);
+    field << static_cast<long long>(bonds);
+    fields.push_back(field.str());
+    field.str(""); field.setf(ios::fixed);
+    if(globalAvailable[CYCLES] && globalAvailable[INSTRUCTIONS] && total[CYCLES] > 0.0)
+      field << total[INSTRUCTIONS]/total[CYCLES];
+    else
+      field << "n/a";
+    fields.push_back(field.str());
+    const Event perBondEvents[] = { L1D_MISSES, LLC_MISSES, BRANCH_MISSES };
+    for(int e=0 ; e<3 ; ++e){
+      field.str("");
+      if(globalAvailable[perBondEvents[e]] && bonds > 0.0)
+        field << total[perBondEvents[e]]/bonds;
+      else
+        field << "n/a";
+      fields.push_back(field.str());
+    }
+    field.str("");
+    if(bonds > 0.0)
+      field << 1.0e9*time/bonds;
+    else
+      field << "n/a";
+    fields.push_back(field.str());
+    field.str("");
+    if(globalAvailable[LLC_MISSES] && bonds > 0.0)
+      field << cacheLineBytes*total[LLC_MISSES]/bonds;
+    else
+      field << "n/a";
+    fields.push_back(field.str());
+
+    out << "  ";
+    out.width(nameLength + 2); out << left << regionNames[r];
+    for(unsigned int f=0 ; f<fields.size() ; ++f){
+      out.width(indent); out << right << fields[f];
+    }
+    out << endl;
+  }
+
+  string unavailableEvents;
+  for(int i=0 ; i<NUM_EVENTS ; ++i){
+    if(!globalAvailable[i])
+      unavailableEvents += (unavailableEvents.empty() ? "" : ", ") + string(eventNames[i]);
+  }
+  if(!unavailableEvents.empty())
+    out << "  Not counted on all processors: " << unavailableEvents << endl;
+  if(minRunning < 1.0)
+    out << "  Counters were multiplexed; counts cover " << static_cast<int>(100.0*minRunning) << "% of the run on the least-sampled processor" << endl;
+  out << "  Bytes/bond is estimated as last-level cache misses times a " << static_cast<int>(cacheLineBytes) << "-byte cache line" << endl;
+  out << endl;
+}
@@ -0,0 +1,209 @@
+/*! \file Peridigm_PerformanceCounters.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_PERFORMANCECOUNTERS_HPP
+#define PERIDIGM_PERFORMANCECOUNTERS_HPP
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace PeridigmNS {
+
+//! Singleton class for sampling hardware performance counters over regions of the code.
+/*!
+  When enabled, a group of hardware counters (cycles, instructions, L1 data cache misses,
+  last-level cache misses, and branch misses) is opened for the calling thread with
+  perf_event_open().  Regions are identified by integer ids, obtained once with
+  getRegionId(); startRegion() and stopRegion() read the counters and accumulate the
+  differences, along with the elapsed time and the number of bonds processed, so that
+  per-bond costs can be reported.
+
+  If the counters cannot be opened (for example, on platforms other than Linux, under
+  a restrictive perf_event_paranoid setting, or in a virtual machine without a PMU),
+  counting remains disabled and startRegion() and stopRegion() do nothing.  Counters
+  that are opened but never scheduled by the kernel are reported as unavailable.
+*/
+class PerformanceCounters {
+
+public:
+
+  //! Hardware events that are counted.
+  enum Event { CYCLES=0, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+  //! Destructor, closes the counters.
+  ~PerformanceCounters();
+
+  //! Singleton.
+  static PerformanceCounters& self();
+
+  //! Opens the counters; returns false, with an explanation in message, if no counters are available.
+  bool enable(std::string& message);
+
+  //! Returns true if counting is enabled.
+  bool isEnabled() const { return enabled; }
+
+  //! Returns the id of the specified region, creates the region if it does not exist.
+  int getRegionId(const std::string& name);
+
+  //! Begins counting for the specified region.
+  void startRegion(int regionId) {
+    if(!enabled)
+      return;
+    Region& region = regions[regionId];
+    readCounters(region.startCounts);
+    region.startTime = now();
+  }
+
+  //! Ends counting for the specified region, in which numBonds bonds were processed.
+  void stopRegion(int regionId, long long numBonds) {
+    if(!enabled)
+      return;
+    long long stopTime = now();
+    long long stopCounts[NUM_EVENTS];
+    readCounters(stopCounts);
+    Region& region = regions[regionId];
+    for(int i=0 ; i<NUM_EVENTS ; ++i)
+      region.counts[i] += stopCounts[i] - region.startCounts[i];
+    region.time += stopTime - region.startTime;
+    region.bonds += numBonds;
+    region.calls += 1;
+  }
+
+  //! Prints the accumulated counts and the derived per-bond metrics, summed over all processors.
+  void printCounterData(std::ostream &out);
+
+private:
+
+  //! Private constructor
+  PerformanceCounters();
+
+  //! @name Private and unimplemented to prevent use
+  //@{
+  PerformanceCounters(const PerformanceCounters&);
+  PerformanceCounters& operator=(const PerformanceCounters&);
+  //@}
+
+  //! Monotonic clock, in nanoseconds.
+  static long long now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  //! Reads the current values of all events; events that are not available read as zero.
+  void readCounters(long long* values);
+
+  //! Accumulated data for a region.
+  struct Region {
+    Region() : time(0), startTime(0), bonds(0), calls(0) {
+      for(int i=0 ; i<NUM_EVENTS ; ++i)
+        counts[i] = startCounts[i] = 0;
+    }
+    long long counts[NUM_EVENTS];
+    long long startCounts[NUM_EVENTS];
+    long long time;
+    long long startTime;
+    long long bonds;
+    long long calls;
+  };
+
+protected:
+
+  //! True if counting is enabled.
+  bool enabled;
+
+  //! File descriptor of the group leader, -1 if not open.
+  int groupFd;
+
+  //! File descriptors of the individual events, -1 for events that could not be opened.
+  int eventFds[NUM_EVENTS];
+
+  //! Position of each event in the group read buffer, -1 for events that could not be opened.
+  int eventSlots[NUM_EVENTS];
+
+  //! Number of events in the group.
+  int numOpenEvents;
+
+  //! Time the group was enabled and running, as of the most recent read.
+  long long timeEnabled;
+  long long timeRunning;
+
+  //! Map that associates a name with a region id.
+  std::map<std::string, int> regionIds;
+
+  //! Region names, indexed by region id.
+  std::vector<std::string> regionNames;
+
+  //! Region data, indexed by region id.
+  std::vector<Region> regions;
+};
+
+//! Counts a region for the lifetime of the object.
+class ScopedCounters {
+
+public:
+
+  ScopedCounters(int regionId_, long long numBonds_) : regionId(regionId_), numBonds(numBonds_) { PerformanceCounters::self().startRegion(regionId); }
+
+  ~ScopedCounters() { PerformanceCounters::self().stopRegion(regionId, numBonds); }
+
+private:
+
+  //! @name Private and unimplemented to prevent use
+  //@{
+  ScopedCounters(const ScopedCounters&);
+  ScopedCounters& operator=(const ScopedCounters&);
+  //@}
+
+  int regionId;
+  long long numBonds;
+};
+
+}
+
+#endif // PERIDIGM_PERFORMANCECOUNTERS_HPP
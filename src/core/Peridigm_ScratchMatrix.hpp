@@ -86,6 +86,9 @@ namespace PeridigmNS {
     //! Access to underlying data array.
     const double *const * Data(){ return data; }
 
+    //! Writable access to the underlying rows, for kernels that fill the matrix.
+    double** WritableData(){ return data; }
+
     //! @name Accessor functions (warning: no bounds checking).
     //@{
 
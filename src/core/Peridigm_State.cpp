@@ -120,6 +120,24 @@ bool PeridigmNS::State::hasData(int fieldId)
   return keyExists;
 }
 
+long long PeridigmNS::State::pointDataBytes() const
+{
+  long long bytes = 0;
+  for(unsigned int i=0 ; i<pointData.size() ; ++i){
+    if(!pointData[i].is_null())
+      bytes += (long long)(pointData[i]->MyLength())*pointData[i]->NumVectors()*sizeof(double);
+  }
+  return bytes;
+}
+
+long long PeridigmNS::State::bondDataBytes() const
+{
+  long long bytes = 0;
+  if(!bondData.is_null())
+    bytes += (long long)(bondData->MyLength())*bondData->NumVectors()*sizeof(double);
+  return bytes;
+}
+
 Teuchos::RCP<Epetra_Vector> PeridigmNS::State::getData(int fieldId)
 {
   // This class was originally written to use only the std::map fieldToDataMap.
@@ -150,6 +168,53 @@ void PeridigmNS::State::copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::S
   }
 }
 
+void PeridigmNS::State::copyNeighborhoodDataFromState(Teuchos::RCP<PeridigmNS::State> source,
+                                                      int numPoints,
+                                                      const int* sourcePointIDs,
+                                                      int firstSourceBond,
+                                                      int numBonds)
+{
+  // Make sure the source isn't a null ref-count pointer
+  TEUCHOS_TEST_FOR_EXCEPTION(source.is_null(), Teuchos::NullReferenceError,
+                     "PeridigmNS::State::copyNeighborhoodDataFromState() called with null ref-count pointer.\n");
+
+  for(unsigned int i=0 ; i<pointData.size() ; ++i){
+    if(!pointData[i].is_null()){
+      TEUCHOS_TEST_FOR_EXCEPTION(source->getPointMultiVector(i).is_null(), Teuchos::NullReferenceError,
+                                 "PeridigmNS::State::copyNeighborhoodDataFromState() called with incompatible State.\n");
+      Epetra_MultiVector& sourceMultiVector = *(source->getPointMultiVector(i));
+      Epetra_MultiVector& targetMultiVector = *pointData[i];
+      TEUCHOS_TEST_FOR_EXCEPTION(sourceMultiVector.NumVectors() != targetMultiVector.NumVectors() || targetMultiVector.Map().NumMyElements() < numPoints,
+                                 std::range_error, "PeridigmNS::State::copyNeighborhoodDataFromState() called with incompatible State.\n");
+      // Point data has a constant element size
+      int elementSize = targetMultiVector.Map().ElementSize();
+      for(int iVec=0 ; iVec<targetMultiVector.NumVectors() ; ++iVec){
+        const double* sourceData = sourceMultiVector[iVec];
+        double* targetData = targetMultiVector[iVec];
+        for(int iPoint=0 ; iPoint<numPoints ; ++iPoint){
+          const double* sourcePointData = sourceData + elementSize*sourcePointIDs[iPoint];
+          for(int j=0 ; j<elementSize ; ++j)
+            targetData[elementSize*iPoint+j] = sourcePointData[j];
+        }
+      }
+    }
+  }
+
+  if(!bondData.is_null()){
+    TEUCHOS_TEST_FOR_EXCEPTION(source->getBondMultiVector().is_null(), Teuchos::NullReferenceError,
+                               "PeridigmNS::State::copyNeighborhoodDataFromState() called with incompatible State.\n");
+    Epetra_MultiVector& sourceMultiVector = *(source->getBondMultiVector());
+    TEUCHOS_TEST_FOR_EXCEPTION(sourceMultiVector.NumVectors() != bondData->NumVectors() || bondData->MyLength() < numBonds,
+                               std::range_error, "PeridigmNS::State::copyNeighborhoodDataFromState() called with incompatible State.\n");
+    for(int iVec=0 ; iVec<bondData->NumVectors() ; ++iVec){
+      const double* sourceData = sourceMultiVector[iVec] + firstSourceBond;
+      double* targetData = (*bondData)[iVec];
+      for(int iBond=0 ; iBond<numBonds ; ++iBond)
+        targetData[iBond] = sourceData[iBond];
+    }
+  }
+}
+
 void PeridigmNS::State::writeStateData(Teuchos::RCP<PeridigmNS::State> source,  std::string stateName,  std::string blockName,  char const * path)
 {
   char VectorName[100];
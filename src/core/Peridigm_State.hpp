@@ -117,12 +117,30 @@ public:
   //! Query the existence of a field id.
   bool hasData(int fieldId);
 
+  //! Number of bytes allocated for point data.
+  long long pointDataBytes() const;
+
+  //! Number of bytes allocated for bond data.
+  long long bondDataBytes() const;
+
   //! Provides access to an Epetra_Vector corresponding to the given field id.
   Teuchos::RCP<Epetra_Vector> getData(int fieldId);
 
   //! Copies data from a different state object based on global IDs; functions only if all the local IDs in the target map exist in and are locally owned in the source map.
   void copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::State> source);
 
+  /** \brief Copies the data of a set of points, and of a contiguous range of bonds, from a different state object based on local IDs.
+  **
+  **  Point sourcePointIDs[i] in the source is copied to local ID i, and bonds firstSourceBond through
+  **  firstSourceBond+numBonds-1 are copied to the first numBonds entries of the bond data.  No map lookups
+  **  are performed; the states must hold the same fields, and the target must be large enough.
+  **/
+  void copyNeighborhoodDataFromState(Teuchos::RCP<PeridigmNS::State> source,
+                                     int numPoints,
+                                     const int* sourcePointIDs,
+                                     int firstSourceBond,
+                                     int numBonds);
+
   //! Set restart files for state data
   void SetRestartFiles( std::string stateName, std::string blockName, char const * path);
 
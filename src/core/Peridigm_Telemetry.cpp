@@ -0,0 +1,181 @@
+/*! \file Peridigm_Telemetry.cpp */
+
+#include "Peridigm_Telemetry.hpp"
+#include "Peridigm_Memstat.hpp"
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define PERIDIGM_HAVE_UNIX_SOCKETS
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_Assert.hpp>
+
+using namespace std;
+
+PeridigmNS::Telemetry& PeridigmNS::Telemetry::self() {
+  static Telemetry telemetry;
+  return telemetry;
+}
+
+PeridigmNS::Telemetry::Telemetry()
+  : enabled(false), frequency(1), rank(0), socketDescriptor(-1), lastStep(0), lastWallTime(0.0), lastComputeTime(0.0) {}
+
+PeridigmNS::Telemetry::~Telemetry() {
+#ifdef PERIDIGM_HAVE_UNIX_SOCKETS
+  if(socketDescriptor >= 0)
+    close(socketDescriptor);
+#endif
+}
+
+double PeridigmNS::Telemetry::wallTime() {
+  return 1.0e-9*std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool PeridigmNS::Telemetry::enable(const string& fileName, const string& socketPath, int frequency_, int rank_, string& message) {
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(frequency_ < 1, "\n**** Error, the telemetry Frequency must be a positive number of steps.\n");
+  frequency = frequency_;
+  rank = rank_;
+
+  // Only processor 0 writes records
+  int opened = 1;
+  if(rank == 0){
+    if(!socketPath.empty()){
+#ifdef PERIDIGM_HAVE_UNIX_SOCKETS
+      sockaddr_un address;
+      memset(&address, 0, sizeof(address));
+      address.sun_family = AF_UNIX;
+      if(socketPath.size() >= sizeof(address.sun_path)){
+        message = "socket path " + socketPath + " is too long";
+        opened = 0;
+      }
+      else{
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        socketDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(socketDescriptor < 0 || connect(socketDescriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0){
+          message = "unable to connect to socket " + socketPath + " (" + strerror(errno) + ")";
+          if(socketDescriptor >= 0)
+            close(socketDescriptor);
+          socketDescriptor = -1;
+          opened = 0;
+        }
+      }
+#else
+      message = "UNIX domain sockets are not supported on this platform";
+      opened = 0;
+#endif
+    }
+    else{
+      file.open(fileName.c_str());
+      if(!file.is_open()){
+        message = "unable to open file " + fileName;
+        opened = 0;
+      }
+    }
+  }
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  Teuchos::broadcast<int, int>(*teuchosComm, 0, &opened);
+  enabled = (opened == 1);
+  return enabled;
+}
+
+void PeridigmNS::Telemetry::beginRun(int step) {
+  lastStep = step;
+  lastWallTime = wallTime();
+  lastComputeTime = 0.0;
+}
+
+void PeridigmNS::Telemetry::record(int step, int numSteps, double time, double dt, const LocalData& localData) {
+
+  if(!enabled)
+    return;
+
+  // Compute time since the previous record, and memory use, on this processor
+  double computeTime = localData.computeTime - lastComputeTime;
+  lastComputeTime = localData.computeTime;
+  double residentSetSize = static_cast<double>( Memstat::residentSetSize() );
+
+  const int numSums = 6;
+  double localSums[numSums] = { static_cast<double>(localData.numBonds),
+                                static_cast<double>(localData.numBrokenBonds),
+                                localData.kineticEnergy,
+                                static_cast<double>(localData.numContactPairs),
+                                computeTime,
+                                residentSetSize };
+  double globalSums[numSums];
+  const int numMaxes = 2;
+  double localMaxes[numMaxes] = { computeTime, residentSetSize };
+  double globalMaxes[numMaxes];
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+  Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_SUM, numSums, localSums, globalSums);
+  Teuchos::reduceAll<int, double>(*teuchosComm, Teuchos::REDUCE_MAX, numMaxes, localMaxes, globalMaxes);
+
+  double currentWallTime = wallTime();
+  double wallTimePerStep = (step > lastStep) ? (currentWallTime - lastWallTime)/(step - lastStep) : 0.0;
+  lastStep = step;
+  lastWallTime = currentWallTime;
+
+  if(rank != 0)
+    return;
+
+  double averageComputeTime = globalSums[4]/nProc;
+  double imbalance = averageComputeTime > 0.0 ? globalMaxes[0]/averageComputeTime : 1.0;
+  double bondsPerSecond = wallTimePerStep > 0.0 ? globalSums[0]/wallTimePerStep : 0.0;
+
+  stringstream ss;
+  ss << setprecision(9);
+  ss << "{\"step\":" << step
+     << ",\"steps\":" << numSteps
+     << ",\"time\":" << time
+     << ",\"dt\":" << dt
+     << ",\"wall_time_per_step\":" << wallTimePerStep
+     << ",\"bonds_per_second\":" << bondsPerSecond
+     << ",\"bonds\":" << static_cast<long long>(globalSums[0])
+     << ",\"broken_bonds\":" << static_cast<long long>(globalSums[1])
+     << ",\"kinetic_energy\":" << globalSums[2]
+     << ",\"contact_pairs\":" << static_cast<long long>(globalSums[3])
+     << ",\"imbalance\":" << imbalance
+     << ",\"rss_total_bytes\":" << static_cast<long long>(globalSums[5])
+     << ",\"rss_max_bytes\":" << static_cast<long long>(globalMaxes[1])
+     << ",\"eta_seconds\":" << (numSteps - step)*wallTimePerStep
+     << "}\n";
+  writeLine(ss.str());
+}
+
+void PeridigmNS::Telemetry::writeLine(const string& line) {
+#ifdef PERIDIGM_HAVE_UNIX_SOCKETS
+  if(socketDescriptor >= 0){
+    size_t sent = 0;
+    while(sent < line.size()){
+      ssize_t result = send(socketDescriptor, line.c_str() + sent, line.size() - sent, MSG_NOSIGNAL);
+      if(result < 0){
+        // The listener has gone away; the simulation carries on without telemetry
+        close(socketDescriptor);
+        socketDescriptor = -1;
+        return;
+      }
+      sent += static_cast<size_t>(result);
+    }
+    return;
+  }
+#endif
+  if(file.is_open())
+    file << line << flush;
+}
@@ -0,0 +1,147 @@
+/*! \file Peridigm_Telemetry.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_TELEMETRY_HPP
+#define PERIDIGM_TELEMETRY_HPP
+
+#include <string>
+#include <fstream>
+
+namespace PeridigmNS {
+
+//! Singleton class that streams progress and throughput records during a simulation.
+/*!
+  Every frequency steps, record() reduces the data of each processor and processor 0
+  writes a single-line JSON record with the step, simulation time, time step, wall time
+  per step, bonds per second, number of broken bonds, kinetic energy, number of contact
+  pairs, the load imbalance in internal force evaluation, the resident set size, and an
+  estimate of the remaining wall time.  Records are appended to a file, or sent to a
+  listener on a local UNIX domain socket, so that a running job can be monitored.
+*/
+class Telemetry {
+
+public:
+
+  //! Data of a single processor, accumulated by the caller.
+  struct LocalData {
+    LocalData() : numBonds(0), numBrokenBonds(0), kineticEnergy(0.0), numContactPairs(0), computeTime(0.0) {}
+    long long numBonds;
+    long long numBrokenBonds;
+    double kineticEnergy;
+    long long numContactPairs;
+    //! Cumulative time spent in internal force evaluation on this processor.
+    double computeTime;
+  };
+
+  //! Destructor.
+  ~Telemetry();
+
+  //! Singleton.
+  static Telemetry& self();
+
+  //! Enables telemetry; processor 0 writes to fileName or, if socketPath is not empty, to the UNIX domain socket socketPath.
+  /*!
+    Returns false and sets message if the output could not be opened on processor 0; the
+    return value is the same on all processors.
+  */
+  bool enable(const std::string& fileName, const std::string& socketPath, int frequency, int rank, std::string& message);
+
+  //! Returns true if telemetry is enabled.
+  bool isEnabled() const { return enabled; }
+
+  //! Returns true if a record is due at the given step.
+  bool isRecordStep(int step) const { return enabled && step % frequency == 0; }
+
+  //! Marks the start of time integration at the given step.
+  void beginRun(int step);
+
+  //! Reduces the data of each processor and writes a record; must be called on all processors.
+  void record(int step, int numSteps, double time, double dt, const LocalData& localData);
+
+private:
+
+  //! Private constructor
+  Telemetry();
+
+  //! @name Private and unimplemented to prevent use
+  //@{
+  Telemetry(const Telemetry&);
+  Telemetry& operator=(const Telemetry&);
+  //@}
+
+  //! Sends a line of text to the file or socket.
+  void writeLine(const std::string& line);
+
+  //! Returns the wall clock time in seconds.
+  static double wallTime();
+
+protected:
+
+  //! True if telemetry is enabled.
+  bool enabled;
+
+  //! Number of steps between records.
+  int frequency;
+
+  //! Rank of this processor.
+  int rank;
+
+  //! Output file, used if no socket is given.
+  std::ofstream file;
+
+  //! Connected socket descriptor, or -1.
+  int socketDescriptor;
+
+  //! Step, wall time, and cumulative compute time of the previous record.
+  int lastStep;
+  double lastWallTime;
+  double lastComputeTime;
+};
+
+}
+
+#endif // PERIDIGM_TELEMETRY_HPP
@@ -2,74 +2,394 @@
 
 #include "Peridigm_Timer.hpp"
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <vector>
+#include <set>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_DefaultComm.hpp>
 #include <Teuchos_GlobalMPISession.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Assert.hpp>
 
 using namespace std;
 
+namespace {
+
+  //! Smallest per-step time resolved by the histogram (seconds), and the number of bins per decade.
+  const double histogramMinTime = 1.0e-8;
+  const int histogramBinsPerDecade = 20;
+  const int histogramNumBins = 11*histogramBinsPerDecade;
+
+  //! Returns the given string with JSON special characters escaped.
+  string jsonEscape(const string& str){
+    string escaped;
+    for(unsigned int i=0 ; i<str.size() ; ++i){
+      if(str[i] == '"' || str[i] == '\\')
+        escaped += '\\';
+      escaped += str[i];
+    }
+    return escaped;
+  }
+
+  //! Appends the paths in the subtree rooted at the given path, in depth-first order.
+  void appendSubtree(const string& path,
+                     const map< string, vector<string> >& children,
+                     vector<string>& paths){
+    map< string, vector<string> >::const_iterator it = children.find(path);
+    if(it == children.end())
+      return;
+    for(unsigned int i=0 ; i<it->second.size() ; ++i){
+      paths.push_back(it->second[i]);
+      appendSubtree(it->second[i], children, paths);
+    }
+  }
+}
+
 PeridigmNS::Timer& PeridigmNS::Timer::self() {
   static Timer timer;
   return timer;
 }
 
+PeridigmNS::Timer::Timer()
+  : step(0), tracing(false), traceFirstStep(0), traceLastStep(0), traceRank(0), traceOrigin(0), traceNextEvent(0), traceNumEvents(0) {
+  // The root of the tree of scopes is always running
+  scopes.push_back(TimeKeeper(-1, -1));
+  activeScopes.push_back(0);
+}
+
+int PeridigmNS::Timer::getTimerId(const string& name) {
+  map<string, int>::iterator it = timerIds.find(name);
+  if(it != timerIds.end())
+    return it->second;
+  int timerId = static_cast<int>(timerNames.size());
+  timerNames.push_back(name);
+  timerIds[name] = timerId;
+  return timerId;
+}
+
+int PeridigmNS::Timer::createScope(int parent, int timerId) {
+  int scope = static_cast<int>(scopes.size());
+  scopes.push_back(TimeKeeper(timerId, parent));
+  scopes[parent].children.push_back(scope);
+  return scope;
+}
+
+double PeridigmNS::Timer::elapsedTime(const string& name) {
+  int timerId = getTimerId(name);
+  long long elapsedTime = 0;
+  for(unsigned int i=0 ; i<scopes.size() ; ++i){
+    if(scopes[i].timerId == timerId)
+      elapsedTime += scopes[i].elapsedTime;
+  }
+  return 1.0e-9*elapsedTime;
+}
+
+void PeridigmNS::Timer::beginStep(int step_) {
+  recordStep();
+  step = step_;
+}
+
+void PeridigmNS::Timer::recordStep() {
+  for(unsigned int i=1 ; i<scopes.size() ; ++i)
+    scopes[i].recordStep();
+}
+
+void PeridigmNS::Timer::collectPaths(int scope, const string& path, vector<string>& paths, vector<int>& pathScopes) const {
+  const vector<int>& children = scopes[scope].children;
+  for(unsigned int i=0 ; i<children.size() ; ++i){
+    string childPath = timerNames[scopes[children[i]].timerId];
+    if(scope != 0)
+      childPath = path + '\t' + childPath;
+    paths.push_back(childPath);
+    pathScopes.push_back(children[i]);
+    collectPaths(children[i], childPath, paths, pathScopes);
+  }
+}
+
+PeridigmNS::Timer::StepHistogram::StepHistogram()
+  : bins(histogramNumBins, 0), count(0), minTime(numeric_limits<long long>::max()), maxTime(0) {}
+
+void PeridigmNS::Timer::StepHistogram::add(long long time) {
+  double seconds = 1.0e-9*time;
+  int bin = 0;
+  if(seconds > histogramMinTime)
+    bin = static_cast<int>( histogramBinsPerDecade*log10(seconds/histogramMinTime) );
+  if(bin >= histogramNumBins)
+    bin = histogramNumBins - 1;
+  bins[bin] += 1;
+  count += 1;
+  minTime = std::min(minTime, time);
+  maxTime = std::max(maxTime, time);
+}
+
+double PeridigmNS::Timer::StepHistogram::min() const {
+  if(count == 0)
+    return 0.0;
+  return 1.0e-9*minTime;
+}
+
+double PeridigmNS::Timer::StepHistogram::percentile(double fraction) const {
+  if(count == 0)
+    return 0.0;
+  long long target = static_cast<long long>( ceil(fraction*count) );
+  if(target < 1)
+    target = 1;
+  long long cumulative = 0;
+  int bin = 0;
+  for(bin=0 ; bin<histogramNumBins-1 ; ++bin){
+    cumulative += bins[bin];
+    if(cumulative >= target)
+      break;
+  }
+  // Report the geometric center of the bin, limited to the observed range
+  double seconds = histogramMinTime*pow(10.0, (bin + 0.5)/histogramBinsPerDecade);
+  seconds = std::max(seconds, 1.0e-9*minTime);
+  seconds = std::min(seconds, 1.0e-9*maxTime);
+  return seconds;
+}
+
 void PeridigmNS::Timer::printTimingData(ostream &out){
 
-  int count = (int)( timers.size() );
+  // Include the step in progress in the per-step statistics
+  recordStep();
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+
+  // Paths of the local scopes, with the timer names of successive levels separated by tabs
+  vector<string> localPaths;
+  vector<int> localScopes;
+  collectPaths(0, "", localPaths, localScopes);
+  map<string, int> localPathScopes;
+  for(unsigned int i=0 ; i<localPaths.size() ; ++i)
+    localPathScopes[localPaths[i]] = localScopes[i];
+
+  // Form the union of the paths over all processors, so that the reductions below line up
+  string packedPaths;
+  for(unsigned int i=0 ; i<localPaths.size() ; ++i)
+    packedPaths += localPaths[i] + '\n';
+  string allPackedPaths = packedPaths;
+#ifdef HAVE_MPI
+  int packedLength = static_cast<int>( packedPaths.size() );
+  vector<int> packedLengths(nProc);
+  MPI_Allgather(&packedLength, 1, MPI_INT, &packedLengths[0], 1, MPI_INT, MPI_COMM_WORLD);
+  vector<int> displacements(nProc, 0);
+  for(int i=1 ; i<nProc ; ++i)
+    displacements[i] = displacements[i-1] + packedLengths[i-1];
+  vector<char> allPackedPathsBuffer(displacements[nProc-1] + packedLengths[nProc-1] + 1, '\0');
+  MPI_Allgatherv(const_cast<char*>(packedPaths.c_str()), packedLength, MPI_CHAR,
+                 &allPackedPathsBuffer[0], &packedLengths[0], &displacements[0], MPI_CHAR, MPI_COMM_WORLD);
+  allPackedPaths = string(&allPackedPathsBuffer[0], allPackedPathsBuffer.size() - 1);
+#endif
+
+  // Assemble the global tree, preserving the order in which timers were first encountered
+  map< string, vector<string> > children;
+  set<string> knownPaths;
+  size_t begin = 0;
+  while(begin < allPackedPaths.size()){
+    size_t end = allPackedPaths.find('\n', begin);
+    string path = allPackedPaths.substr(begin, end - begin);
+    begin = end + 1;
+    if(!knownPaths.insert(path).second)
+      continue;
+    size_t separator = path.rfind('\t');
+    string parentPath = (separator == string::npos) ? string() : path.substr(0, separator);
+    children[parentPath].push_back(path);
+  }
+  vector<string> paths;
+  appendSubtree(string(), children, paths);
+
+  int count = (int)( paths.size() );
+  if(count == 0)
+    return;
+
   vector<string> names(count);
-  vector<double> times(count);
-  vector<double> minTimes(count);
-  vector<double> maxTimes(count);
-  vector<double> totalTimes(count);
-  int i = 0;
-  for(map<string, TimeKeeper>::reverse_iterator it=timers.rbegin() ; it!=timers.rend() ; it++){
-    names[i] = it->first;
-    times[i] = it->second.getElapsedTime();
-    i++;
+  vector<int> depths(count);
+  vector<double> times(count), minTimes(count), maxTimes(count), totalTimes(count);
+  vector<double> calls(count), maxCalls(count);
+  vector<double> stepMins(count), stepMedians(count), stepP99s(count), stepCounts(count);
+  vector<double> minStepMins(count), maxStepMedians(count), maxStepP99s(count), maxStepCounts(count);
+  for(int i=0 ; i<count ; ++i){
+    size_t separator = paths[i].rfind('\t');
+    names[i] = (separator == string::npos) ? paths[i] : paths[i].substr(separator + 1);
+    depths[i] = static_cast<int>( std::count(paths[i].begin(), paths[i].end(), '\t') );
+    times[i] = calls[i] = stepMedians[i] = stepP99s[i] = stepCounts[i] = 0.0;
+    stepMins[i] = numeric_limits<double>::max();
+    map<string, int>::iterator it = localPathScopes.find(paths[i]);
+    if(it != localPathScopes.end()){
+      const TimeKeeper& timeKeeper = scopes[it->second];
+      times[i] = 1.0e-9*timeKeeper.elapsedTime;
+      calls[i] = static_cast<double>(timeKeeper.calls);
+      if(timeKeeper.stepHistogram.numSteps() > 0){
+        stepMins[i] = timeKeeper.stepHistogram.min();
+        stepMedians[i] = timeKeeper.stepHistogram.percentile(0.5);
+        stepP99s[i] = timeKeeper.stepHistogram.percentile(0.99);
+        stepCounts[i] = static_cast<double>(timeKeeper.stepHistogram.numSteps());
+      }
+    }
   }
 
-  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
   Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
   Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
   Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&calls[0], &maxCalls[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&stepMins[0], &minStepMins[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&stepMedians[0], &maxStepMedians[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&stepP99s[0], &maxStepP99s[0]);
+  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&stepCounts[0], &maxStepCounts[0]);
+
+  if(teuchosComm->getRank() != 0)
+    return;
 
   unsigned int nameLength = 0;
-  for(unsigned int i=0 ; i<names.size() ; ++i)
-    if(names[i].size() > nameLength) nameLength = names[i].size();
+  bool haveStepData = false;
+  for(int i=0 ; i<count ; ++i){
+    unsigned int length = 2*depths[i] + names[i].size();
+    if(length > nameLength) nameLength = length;
+    if(maxStepCounts[i] > 0.0) haveStepData = true;
+  }
+
+  // Full-precision copy of the timing data, for scripts that track performance over time
+  if(!timingDataFileName.empty()){
+    ofstream dataFile(timingDataFileName.c_str());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!dataFile.is_open(), "\n**** Error, unable to open timing data file " + timingDataFileName + "\n");
+    dataFile << setprecision(9);
+    dataFile << "{\"processors\":" << nProc << ",\"timers\":[";
+    for(int i=0 ; i<count ; ++i){
+      // The path is written as the list of timer names from the outermost scope inward
+      dataFile << (i == 0 ? "" : ",") << endl;
+      dataFile << "{\"path\":[\"";
+      size_t begin = 0, end;
+      while((end = paths[i].find('\t', begin)) != string::npos){
+        dataFile << jsonEscape(paths[i].substr(begin, end - begin)) << "\",\"";
+        begin = end + 1;
+      }
+      dataFile << jsonEscape(paths[i].substr(begin)) << "\"]";
+      dataFile << ",\"depth\":" << depths[i]
+               << ",\"min\":" << minTimes[i]
+               << ",\"max\":" << maxTimes[i]
+               << ",\"ave\":" << totalTimes[i]/nProc
+               << ",\"calls\":" << static_cast<long long>(maxCalls[i]);
+      if(maxStepCounts[i] > 0.0)
+        dataFile << ",\"step_min\":" << minStepMins[i]
+                 << ",\"step_median\":" << maxStepMedians[i]
+                 << ",\"step_p99\":" << maxStepP99s[i]
+                 << ",\"steps\":" << static_cast<long long>(maxStepCounts[i]);
+      dataFile << "}";
+    }
+    dataFile << endl << "]}" << endl;
+  }
 
   int indent = 15;
-  int nProc = teuchosComm->getSize();
 
-  if(nProc > 1 && teuchosComm->getRank() == 0){
-    out << "Wallclock Time (seconds):" << endl;
-    out << "  ";
-    out.width(nameLength + 17); out << "Min";
+  out << "Wallclock Time (seconds):" << endl;
+  out << "  ";
+  out.width(nameLength + 2); out << left << "";
+  if(nProc > 1){
+    out.width(indent); out << right << "Min";
     out.width(indent); out << right << "Max";
     out.width(indent); out << right << "Ave";
-    out << endl;
-    out.precision(2);
-    for(unsigned int i=0 ; i<names.size() ; ++i){
-      out << "  ";
-      out.width(nameLength + 2); out << left << names[i];
+    out.width(indent); out << right << "Max/Ave";
+  }
+  else{
+    out.width(indent); out << right << "Time";
+  }
+  out.width(indent); out << right << "Calls";
+  out << endl;
+  out.precision(2);
+  for(int i=0 ; i<count ; ++i){
+    out << "  ";
+    out.width(nameLength + 2); out << left << string(2*depths[i], ' ') + names[i];
+    if(nProc > 1){
+      double aveTime = totalTimes[i]/nProc;
+      double imbalance = aveTime > 0.0 ? maxTimes[i]/aveTime : 1.0;
       out.width(indent); out << right << minTimes[i];
       out.width(indent); out << right << maxTimes[i];
-      out.width(indent); out << right << totalTimes[i]/nProc;
-      out << endl;
+      out.width(indent); out << right << aveTime;
+      out.width(indent); out << right << imbalance;
+    }
+    else{
+      out.width(indent); out << right << minTimes[i];
     }
+    out.width(indent); out << right << static_cast<long long>(maxCalls[i]);
     out << endl;
   }
-  else if(nProc == 1){
-    out << "Wallclock Time (seconds):" << endl;
-    out.precision(2);
-    for(unsigned int i=0 ; i<names.size() ; ++i){
+  out << endl;
+
+  if(haveStepData){
+    out << "Time per Step (seconds";
+    if(nProc > 1) out << ", slowest processor";
+    out << "):" << endl;
+    out << "  ";
+    out.width(nameLength + 2); out << left << "";
+    out.width(indent); out << right << "Min";
+    out.width(indent); out << right << "Median";
+    out.width(indent); out << right << "P99";
+    out.width(indent); out << right << "Steps";
+    out << endl;
+    for(int i=0 ; i<count ; ++i){
+      if(maxStepCounts[i] == 0.0)
+        continue;
       out << "  ";
-      out.width(nameLength + 2); out << left << names[i];
-      out.width(indent); out << right << minTimes[i];
+      out.width(nameLength + 2); out << left << string(2*depths[i], ' ') + names[i];
+      out.width(indent); out << right << minStepMins[i];
+      out.width(indent); out << right << maxStepMedians[i];
+      out.width(indent); out << right << maxStepP99s[i];
+      out.width(indent); out << right << static_cast<long long>(maxStepCounts[i]);
       out << endl;
     }
     out << endl;
   }
 }
+
+void PeridigmNS::Timer::enableTrace(const string& fileNameBase, int firstStep, int lastStep, int bufferSize, int rank) {
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(bufferSize < 1, "**** Error:  Timer::enableTrace(), the trace buffer size must be positive.\n");
+  tracing = true;
+  traceFileName = fileNameBase;
+  traceFirstStep = firstStep;
+  traceLastStep = lastStep;
+  traceRank = rank;
+  traceOrigin = now();
+  traceEvents.resize(bufferSize);
+  traceNextEvent = 0;
+  traceNumEvents = 0;
+}
+
+void PeridigmNS::Timer::writeTrace() {
+
+  if(!tracing)
+    return;
+
+  stringstream fileName;
+  fileName << traceFileName << "." << traceRank << ".json";
+  ofstream outFile(fileName.str().c_str());
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!outFile.is_open(), "**** Error:  Timer::writeTrace(), unable to open file " + fileName.str() + "\n");
+
+  // Oldest events first; once the ring buffer has wrapped, the oldest event is the next to be overwritten
+  long long numEvents = std::min(traceNumEvents, static_cast<long long>(traceEvents.size()));
+  size_t firstEvent = (traceNumEvents > numEvents) ? traceNextEvent : 0;
+
+  outFile << "{\"traceEvents\":[" << endl;
+  outFile << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << traceRank << ",\"tid\":0,\"args\":{\"name\":\"Processor " << traceRank << "\"}}";
+  outFile << fixed << setprecision(3);
+  for(long long i=0 ; i<numEvents ; ++i){
+    const TraceEvent& event = traceEvents[(firstEvent + i) % traceEvents.size()];
+    outFile << "," << endl;
+    outFile << "{\"name\":\"" << jsonEscape(timerNames[event.timerId]) << "\",\"cat\":\"Peridigm\",\"ph\":\"X\""
+            << ",\"ts\":" << 1.0e-3*(event.startTime - traceOrigin)
+            << ",\"dur\":" << 1.0e-3*event.duration
+            << ",\"pid\":" << traceRank << ",\"tid\":0"
+            << ",\"args\":{\"step\":" << event.step << "}}";
+  }
+  outFile << endl << "]," << endl;
+  outFile << "\"displayTimeUnit\":\"ms\"," << endl;
+  outFile << "\"otherData\":{\"droppedEvents\":" << traceNumEvents - numEvents << "}" << endl;
+  outFile << "}" << endl;
+  outFile.close();
+}
@@ -48,7 +48,6 @@
 #ifndef PERIDIGM_TIMER_HPP
 #define PERIDIGM_TIMER_HPP
 
-#include <Teuchos_RCP.hpp>
 #ifdef HAVE_MPI
 #include <Epetra_MpiComm.h>
 #else
@@ -57,12 +56,27 @@ typedef int MPI_Comm;
 #include <Epetra_SerialComm.h>
 #endif
 
-#include <Epetra_Time.h>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
 #include <ostream>
 
 namespace PeridigmNS {
 
-//! Singleton class for performance monitoring; manages a set of TimeKeeper objects.
+//! Singleton class for performance monitoring; manages a tree of timed scopes.
+/*!
+  Timers are identified by integer ids, obtained once with getTimerId() and then used
+  for the (inexpensive) calls to startTimer() and stopTimer().  A timer started while
+  another timer is running is nested beneath it; a timer started under different
+  parents has a separate entry for each.  In addition to cumulative totals, the time
+  spent in each scope during each time step (delimited by calls to beginStep()) is
+  recorded in a histogram for the purpose of reporting per-step min/median/p99 times.
+
+  Optionally, each timed interval within a window of time steps is recorded in a
+  bounded ring buffer and written as a per-processor trace in the Chrome trace event
+  format, for viewing in chrome://tracing or Perfetto.
+*/
 class Timer {
 
 public:
@@ -73,22 +87,69 @@ public:
   //! Singleton.
   static Timer& self();
 
+  //! Returns the id of the specified timer, creates the timer if it does not exist.
+  int getTimerId(const std::string& name);
+
+  //! Starts specified timer, nested beneath the innermost running timer.
+  void startTimer(int timerId) {
+    int parent = activeScopes.back();
+    if(scopes[parent].timerId == timerId){
+      // Restarting a running timer resets its start time
+      scopes[parent].startTime = now();
+      return;
+    }
+    int scope = findChildScope(parent, timerId);
+    activeScopes.push_back(scope);
+    scopes[scope].startTime = now();
+  }
+
+  //! Stops specified timer, and any timers left running within it.
+  void stopTimer(int timerId) {
+    long long stopTime = now();
+    for(int i=static_cast<int>(activeScopes.size())-1 ; i>0 ; --i){
+      if(scopes[activeScopes[i]].timerId == timerId){
+        while(static_cast<int>(activeScopes.size()) > i){
+          scopes[activeScopes.back()].stop(stopTime);
+          if(tracing)
+            recordTraceEvent(activeScopes.back(), stopTime);
+          activeScopes.pop_back();
+        }
+        return;
+      }
+    }
+  }
+
   //! Starts specified timer, creates the timer if it does not exist.
-  void startTimer(const std::string& name) { timers[name].start(); }
+  void startTimer(const std::string& name) { startTimer(getTimerId(name)); }
 
   //! Stops specified timer.
-  void stopTimer(const std::string& name) { timers[name].stop(); }
+  void stopTimer(const std::string& name) { stopTimer(getTimerId(name)); }
+
+  //! Query specified timer for elasped time, summed over all scopes in which it was run.
+  double elapsedTime(const std::string& name);
 
-  //! Query specified timer for elasped time.
-  double elapsedTime(const std::string& name) { return timers[name].getElapsedTime(); }
+  //! Marks the beginning of the given time step; records the per-step times of the previous step.
+  void beginStep(int step);
 
-  //! Prints out a table of timing data.
+  //! Returns the current time step, as given to beginStep().
+  int currentStep() const { return step; }
+
+  //! Prints out the tree of timing data, with per-processor min/max/average, imbalance, and per-step statistics.
   void printTimingData(std::ostream &out);
 
+  //! Begins recording a trace of the timed intervals in time steps firstStep through lastStep, keeping at most bufferSize events.
+  void enableTrace(const std::string& fileNameBase, int firstStep, int lastStep, int bufferSize, int rank);
+
+  //! Writes the trace to the file fileNameBase.rank.json, if tracing is enabled.
+  void writeTrace();
+
+  //! Requests that printTimingData() also write the timing data, at full precision, to the given JSON file.
+  void setTimingDataFile(const std::string& fileName) { timingDataFileName = fileName; }
+
 private:
 
   //! Private constructor
-  Timer(){}
+  Timer();
 
   //! @name Private and unimplemented to prevent use
   //@{
@@ -96,39 +157,166 @@ private:
   Timer& operator=(const Timer&);
   //@}  
 
-  //! Time keeper class, operates like a stopwatch.
+  //! Monotonic clock, in nanoseconds.
+  static long long now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  //! Histogram of per-step times, with logarithmically-spaced bins.
+  class StepHistogram {
+
+  public:
+
+    StepHistogram();
+
+    //! Adds the time (in nanoseconds) for a single step.
+    void add(long long time);
+
+    //! Returns the number of steps recorded.
+    long long numSteps() const { return count; }
+
+    //! Returns the minimum per-step time, in seconds.
+    double min() const;
+
+    //! Returns an estimate of the given percentile (0.0 to 1.0) of the per-step times, in seconds.
+    double percentile(double fraction) const;
+
+  private:
+    std::vector<unsigned int> bins;
+    long long count;
+    long long minTime;
+    long long maxTime;
+  };
+
+  //! A timer within a specific parent scope, operates like a stopwatch.
   class TimeKeeper {
 
   public:
 
-    TimeKeeper() : elapsedTime(0.0) {
-#ifdef HAVE_MPI
-      epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_MpiComm(MPI_COMM_WORLD)));
-#else
-      epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_SerialComm()));
-#endif
+    TimeKeeper(int timerId_, int parent_)
+      : timerId(timerId_), parent(parent_), startTime(0), elapsedTime(0), stepTime(0), calls(0), stepCalls(0) {}
+
+    void stop(long long stopTime) {
+      long long interval = stopTime - startTime;
+      elapsedTime += interval;
+      stepTime += interval;
+      calls += 1;
+      stepCalls += 1;
     }
 
-    void start() {
-      epetraTime->ResetStartTime();
+    //! Records the time spent in this scope during the current step, if any, and resets it.
+    void recordStep() {
+      if(stepCalls > 0)
+        stepHistogram.add(stepTime);
+      stepTime = 0;
+      stepCalls = 0;
     }
 
-    void stop() {
-      elapsedTime += epetraTime->ElapsedTime();
+    int timerId;
+    int parent;
+    std::vector<int> children;
+    long long startTime;
+    long long elapsedTime;
+    long long stepTime;
+    long long calls;
+    int stepCalls;
+    StepHistogram stepHistogram;
+  };
+
+  //! Returns the scope for the given timer beneath the given parent scope, creates it if needed.
+  int findChildScope(int parent, int timerId) {
+    const std::vector<int>& children = scopes[parent].children;
+    for(unsigned int i=0 ; i<children.size() ; ++i){
+      if(scopes[children[i]].timerId == timerId)
+        return children[i];
     }
+    return createScope(parent, timerId);
+  }
 
-    //! Returns the cummulative elapsed time.
-    double getElapsedTime() const { return elapsedTime; }
+  //! Creates a new scope for the given timer beneath the given parent scope.
+  int createScope(int parent, int timerId);
 
-  private:
-    Teuchos::RCP<Epetra_Time> epetraTime;
-    double elapsedTime;
+  //! A single timed interval in the trace.
+  struct TraceEvent {
+    int timerId;
+    int step;
+    long long startTime;
+    long long duration;
   };
 
+  //! Adds the interval just completed by the given scope to the trace ring buffer.
+  void recordTraceEvent(int scope, long long stopTime) {
+    if(step < traceFirstStep || step > traceLastStep)
+      return;
+    TraceEvent& event = traceEvents[traceNextEvent];
+    event.timerId = scopes[scope].timerId;
+    event.step = step;
+    event.startTime = scopes[scope].startTime;
+    event.duration = stopTime - scopes[scope].startTime;
+    traceNumEvents += 1;
+    traceNextEvent += 1;
+    if(traceNextEvent == traceEvents.size())
+      traceNextEvent = 0;
+  }
+
+  //! Records the per-step times for all scopes.
+  void recordStep();
+
+  //! Appends the tab-delimited paths of the given scope and its descendants, in depth-first order.
+  void collectPaths(int scope, const std::string& path, std::vector<std::string>& paths, std::vector<int>& pathScopes) const;
+
 protected:
 
-  //! Map that associates a name with a TimeKeeper.
-  std::map<std::string, TimeKeeper> timers;
+  //! Map that associates a name with a timer id.
+  std::map<std::string, int> timerIds;
+
+  //! Timer names, indexed by timer id.
+  std::vector<std::string> timerNames;
+
+  //! Tree of timed scopes; the first entry is the root.
+  std::vector<TimeKeeper> scopes;
+
+  //! Stack of running scopes, beginning with the root.
+  std::vector<int> activeScopes;
+
+  //! Current time step.
+  int step;
+
+  //! JSON file written by printTimingData(); empty if not requested.
+  std::string timingDataFileName;
+
+  //! @name Trace data
+  //@{
+  bool tracing;
+  std::string traceFileName;
+  int traceFirstStep;
+  int traceLastStep;
+  int traceRank;
+  long long traceOrigin;
+  std::vector<TraceEvent> traceEvents;
+  std::size_t traceNextEvent;
+  long long traceNumEvents;
+  //@}
+};
+
+//! Starts a timer on construction and stops it on destruction.
+class ScopedTimer {
+
+public:
+
+  explicit ScopedTimer(int timerId_) : timerId(timerId_) { Timer::self().startTimer(timerId); }
+
+  ~ScopedTimer() { Timer::self().stopTimer(timerId); }
+
+private:
+
+  //! @name Private and unimplemented to prevent use
+  //@{
+  ScopedTimer(const ScopedTimer&);
+  ScopedTimer& operator=(const ScopedTimer&);
+  //@}
+
+  int timerId;
 };
 
 }
@@ -0,0 +1,153 @@
+/*! \file utPeridigm_HalfNeighborList.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <cstring>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_HalfNeighborList.hpp"
+#include "Peridigm_NeighborhoodData.hpp"
+
+using namespace std;
+using namespace PeridigmNS;
+
+namespace {
+
+  // Four owned points (0-3) and two ghosts (4, 5).  Point 0 is bonded to ghost 4 and point 1 to
+  // ghost 5; point 3 is bonded to point 1, which does not have point 3 in its neighborhood.  The
+  // neighbors of point 2 are not sorted.
+  //
+  //   point 0:  bonds 0, 1, 2 to points 1, 2, 4
+  //   point 1:  bonds 3, 4    to points 0, 5
+  //   point 2:  bonds 5, 6    to points 3, 0
+  //   point 3:  bonds 7, 8    to points 2, 1
+  const int numOwnedPoints = 4;
+  const int neighborhoodList[] = {3, 1, 2, 4,
+                                  2, 0, 5,
+                                  2, 3, 0,
+                                  2, 2, 1};
+
+  // Expected half list:  each paired bond once, from its lower-numbered point, and each one-sided bond
+  const int expectedBonds[] = {0, 1, 0,  3,
+                               0, 2, 1,  6,
+                               0, 4, 2, -1,
+                               1, 5, 4, -1,
+                               2, 3, 5,  7,
+                               3, 1, 8, -1};
+  const int expectedNumBonds = 6;
+  const int expectedNumPairedBonds = 3;
+
+  bool bondsMatch(const HalfNeighborList& halfNeighborList)
+  {
+    if(halfNeighborList.NumBonds() != expectedNumBonds)
+      return false;
+    for(int i=0 ; i<HalfNeighborList::BOND_SIZE*expectedNumBonds ; ++i){
+      if(halfNeighborList.Bonds()[i] != expectedBonds[i])
+        return false;
+    }
+    return true;
+  }
+}
+
+TEUCHOS_UNIT_TEST(HalfNeighborList, BondLayout) {
+
+  HalfNeighborList halfNeighborList(numOwnedPoints, neighborhoodList);
+
+  TEST_EQUALITY(halfNeighborList.NumOwnedPoints(), numOwnedPoints);
+  TEST_EQUALITY(halfNeighborList.NumBonds(), expectedNumBonds);
+  TEST_EQUALITY(halfNeighborList.NumPairedBonds(), expectedNumPairedBonds);
+  TEST_ASSERT(bondsMatch(halfNeighborList));
+
+  // every paired bond refers to the bond of the neighbor that points back to the owned point
+  const int* bond = halfNeighborList.Bonds();
+  for(int iBond=0 ; iBond<halfNeighborList.NumBonds() ; ++iBond, bond += HalfNeighborList::BOND_SIZE){
+    int point = bond[0];
+    int neighbor = bond[1];
+    int reverseBond = bond[3];
+    if(reverseBond != -1){
+      TEST_ASSERT(neighbor < numOwnedPoints);
+      TEST_ASSERT(point < neighbor);
+      // locate the reverse bond in the neighborhood list of the neighbor
+      int listIndex(0), bondIndex(0);
+      for(int p=0 ; p<neighbor ; ++p){
+        bondIndex += neighborhoodList[listIndex];
+        listIndex += neighborhoodList[listIndex] + 1;
+      }
+      TEST_ASSERT(reverseBond >= bondIndex && reverseBond < bondIndex + neighborhoodList[listIndex]);
+      TEST_EQUALITY(neighborhoodList[listIndex + 1 + reverseBond - bondIndex], point);
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(HalfNeighborList, FromNeighborhoodData) {
+
+  int neighborhoodListSize = sizeof(neighborhoodList)/sizeof(int);
+  NeighborhoodData neighborhoodData;
+  neighborhoodData.SetNumOwned(numOwnedPoints);
+  neighborhoodData.SetNeighborhoodListSize(neighborhoodListSize);
+  memcpy(neighborhoodData.NeighborhoodList(), neighborhoodList, neighborhoodListSize*sizeof(int));
+  for(int i=0, listIndex=0 ; i<numOwnedPoints ; ++i){
+    neighborhoodData.OwnedIDs()[i] = i;
+    neighborhoodData.NeighborhoodPtr()[i] = listIndex;
+    listIndex += neighborhoodList[listIndex] + 1;
+  }
+
+  HalfNeighborList halfNeighborList(neighborhoodData);
+  TEST_EQUALITY(halfNeighborList.NumPairedBonds(), expectedNumPairedBonds);
+  TEST_ASSERT(bondsMatch(halfNeighborList));
+
+  // rebuilding from an empty neighborhood clears the list
+  halfNeighborList.build(0, neighborhoodList);
+  TEST_EQUALITY(halfNeighborList.NumOwnedPoints(), 0);
+  TEST_EQUALITY(halfNeighborList.NumBonds(), 0);
+  TEST_EQUALITY(halfNeighborList.NumPairedBonds(), 0);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,118 @@
+/*! \file utPeridigm_InfluenceFunction.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_InfluenceFunction.hpp"
+#include <cmath>
+
+using namespace std;
+using namespace PeridigmNS;
+
+namespace {
+  double linearDecay(double zeta, double horizon){ return 1.0 - zeta/horizon; }
+  double inverseDistance(double zeta, double horizon){ return 1.0/zeta; }
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunctionTable, LinearDecay) {
+
+  double horizon = 2.0;
+  InfluenceFunctionTable cubicTable(&linearDecay, horizon, 64, InfluenceFunctionTable::CUBIC);
+  InfluenceFunctionTable linearTable(&linearDecay, horizon, 64, InfluenceFunctionTable::LINEAR);
+  TEST_ASSERT(cubicTable.isValid());
+  TEST_ASSERT(linearTable.isValid());
+  TEST_ASSERT(cubicTable.contains(0.0));
+  TEST_ASSERT(cubicTable.contains(horizon));
+  TEST_ASSERT(!cubicTable.contains(1.001*horizon));
+
+  // Both interpolations are exact for a linear function
+  for(int i=0 ; i<=100 ; ++i){
+    double zeta = i*horizon/100.0;
+    TEST_FLOATING_EQUALITY(cubicTable(zeta) + 1.0, linearDecay(zeta, horizon) + 1.0, 1.0e-14);
+    TEST_FLOATING_EQUALITY(linearTable(zeta) + 1.0, linearDecay(zeta, horizon) + 1.0, 1.0e-14);
+  }
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunctionTable, NonFiniteSample) {
+
+  // The sample at zeta = 0 is infinite, so the table must not be used
+  InfluenceFunctionTable table(&inverseDistance, 2.0, 64, InfluenceFunctionTable::CUBIC);
+  TEST_ASSERT(!table.isValid());
+}
+
+TEUCHOS_UNIT_TEST(InfluenceFunction, NonFiniteSampleFallsBackToParser) {
+
+  InfluenceFunction& influenceFunction = InfluenceFunction::self();
+  influenceFunction.setTableParameters(64, "Cubic");
+  influenceFunction.setInfluenceFunction("1.0/zeta");
+  InfluenceFunction::functionPointer function = influenceFunction.getInfluenceFunction();
+  TEST_EQUALITY(InfluenceFunction::getType(function), InfluenceFunction::TABULATED);
+
+  // No table is created for the singular function, every bond is evaluated by the parser
+  double horizon = 2.0;
+  TEST_ASSERT(influenceFunction.getTable(horizon) == NULL);
+  for(int i=1 ; i<=10 ; ++i){
+    double zeta = i*horizon/10.0;
+    TEST_FLOATING_EQUALITY(function(zeta, horizon), 1.0/zeta, 1.0e-14);
+  }
+
+  // A smooth function is tabulated
+  influenceFunction.setInfluenceFunction("1.0 - zeta/horizon");
+  function = influenceFunction.getInfluenceFunction();
+  TEST_ASSERT(influenceFunction.getTable(horizon) != NULL);
+  TEST_FLOATING_EQUALITY(function(0.5, horizon), 0.75, 1.0e-14);
+
+  // Restore the defaults
+  influenceFunction.setTableParameters(0, "Cubic");
+  influenceFunction.setInfluenceFunction("One");
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
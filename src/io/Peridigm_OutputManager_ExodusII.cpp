@@ -50,6 +50,8 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <cmath>
+#include <algorithm>
 
 #include <netcdf.h>
 #include <exodusII.h>
@@ -137,6 +139,27 @@ PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Te
       globalDataOnly = false;
   }
 
+  // Optional restriction of the output to a subset of the points
+  outputSubset = sublist(params, "Output Subset");
+  subsetOutput = false;
+
+  // Optional per-variable output settings
+  if (params->isSublist("Output Variable Options")) {
+    Teuchos::ParameterList& variableOptions = params->sublist("Output Variable Options");
+    for (Teuchos::ParameterList::ConstIterator it = variableOptions.begin(); it != variableOptions.end(); ++it) {
+      string name = it->first;
+      TEUCHOS_TEST_FOR_EXCEPTION( !outputVariables->isParameter(name), std::invalid_argument,
+                                  "PeridigmNS::OutputManager_ExodusII:::OutputManager_ExodusII() -- Output Variable Options given for " + name + ", which is not listed under Output Variables.");
+      double deltaThreshold = variableOptions.sublist(name).get<double>("Delta Threshold", 0.0);
+      if (deltaThreshold > 0.0) {
+        PeridigmNS::FieldSpec spec = PeridigmNS::FieldManager::self().getFieldSpec(name);
+        TEUCHOS_TEST_FOR_EXCEPTION( spec.getRelation() == PeridigmField::GLOBAL, std::invalid_argument,
+                                    "PeridigmNS::OutputManager_ExodusII:::OutputManager_ExodusII() -- Delta Threshold is not supported for global variable " + name + ".");
+        deltaThresholds[name] = deltaThreshold;
+      }
+    }
+  }
+
   // Initialize count (number of times write() has been called)
   // Initialize exodusCount (number of timesteps data actually written to exodus file)
   // Initialize to 0 because first call to write() corresponds to timestep 1
@@ -145,8 +168,14 @@ PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Te
   // Sentinal value for file handle
   file_handle = -1;
 
-  // Default to storing and writing doubles
-  CPU_word_size = IO_word_size = sizeof(double);
+  // Default to storing and writing doubles; optionally store data in single precision
+  string outputPrecision = params->get<string>("Output Precision","Double");
+  TEUCHOS_TEST_FOR_EXCEPTION( outputPrecision != "Double" && outputPrecision != "Single", std::invalid_argument,
+                              "PeridigmNS::OutputManager_ExodusII:::OutputManager_ExodusII() -- Output Precision must be Double or Single.");
+  CPU_word_size = sizeof(double);
+  IO_word_size = sizeof(double);
+  if (outputPrecision == "Single")
+    IO_word_size = sizeof(float);
   
   // Not called yet
   initializeExodusDatabaseCalled = false;
@@ -174,6 +203,18 @@ Teuchos::ParameterList PeridigmNS::OutputManager_ExodusII::getValidParameterList
   Teuchos::setStringToIntegralParameter<int>("Output Format","BINARY","ASCII or BINARY",Teuchos::tuple<string>("ASCII","BINARY"),&validParameterList);
   setIntParameter("Output Frequency",-1,"Frequency of Output",&validParameterList,intParam);
   validParameterList.set("Parallel Write",true);
+  Teuchos::setStringToIntegralParameter<int>("Output Precision","Double","Double or Single",Teuchos::tuple<string>("Double","Single"),&validParameterList);
+
+  // Optional subset of the points written to the database
+  Teuchos::ParameterList& validOutputSubsetParameterList = validParameterList.sublist("Output Subset");
+  setIntParameter("Stride",1,"Write only points whose global id is a multiple of the stride",&validOutputSubsetParameterList,intParam);
+  validOutputSubsetParameterList.set("Node Set","");
+  setDoubleParameter("X Min",-std::numeric_limits<double>::max(),"Bounding box lower x bound",&validOutputSubsetParameterList,dblParam);
+  setDoubleParameter("X Max",std::numeric_limits<double>::max(),"Bounding box upper x bound",&validOutputSubsetParameterList,dblParam);
+  setDoubleParameter("Y Min",-std::numeric_limits<double>::max(),"Bounding box lower y bound",&validOutputSubsetParameterList,dblParam);
+  setDoubleParameter("Y Max",std::numeric_limits<double>::max(),"Bounding box upper y bound",&validOutputSubsetParameterList,dblParam);
+  setDoubleParameter("Z Min",-std::numeric_limits<double>::max(),"Bounding box lower z bound",&validOutputSubsetParameterList,dblParam);
+  setDoubleParameter("Z Max",std::numeric_limits<double>::max(),"Bounding box upper z bound",&validOutputSubsetParameterList,dblParam);
 
   // Create a vector of valid output variables
   // Do not include bond data, since we can not output it
@@ -201,6 +242,13 @@ Teuchos::ParameterList PeridigmNS::OutputManager_ExodusII::getValidParameterList
   for(unsigned int i=0 ; i<validOutputFieldSpecs.size() ; ++i)
     validOutputVariablesParameterList.set(validOutputFieldSpecs[i].getLabel(), false);
 
+  // Per-variable output settings
+  Teuchos::ParameterList& validOutputVariableOptionsParameterList = validParameterList.sublist("Output Variable Options");
+  for(unsigned int i=0 ; i<validOutputFieldSpecs.size() ; ++i){
+    Teuchos::ParameterList& variableOptions = validOutputVariableOptionsParameterList.sublist(validOutputFieldSpecs[i].getLabel());
+    setDoubleParameter("Delta Threshold",0.0,"Skip the variable when its max change since the last dump is below this value; values at skipped steps are undefined",&variableOptions,dblParam);
+  }
+
   return validParameterList;
 }
 
@@ -257,8 +305,11 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
   if (retval!= 0) reportExodusError(retval, "write", "ex_put_time");
 
   int num_nodes(1);
-  if(!globalDataOnly)
+  int num_output_nodes(1);
+  if(!globalDataOnly){
     num_nodes = peridigm->getOneDimensionalMap()->NumMyElements();
+    num_output_nodes = outputNodes.size();
+  }
 
   // Allocate temporary storage for all mothership-like data
   std::vector<double> x_vec(num_nodes), y_vec(num_nodes), z_vec(num_nodes);
@@ -277,6 +328,11 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
     string name = it->first;
     PeridigmNS::FieldSpec spec = PeridigmNS::FieldManager::self().getFieldSpec(name);
 
+    // Skip variables that have not changed appreciably since they were last written
+    // Nothing is written for a skipped variable, its values at this step are undefined (netCDF fill values)
+    if (deltaThresholds.find(name) != deltaThresholds.end() && !variableChanged(blocks, spec))
+      continue;
+
     double *block_ptr = NULL;
     if (spec.getRelation() == PeridigmField::GLOBAL) {
       // global vars are static within a block, so only need to reference first block
@@ -338,9 +394,17 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
           }
         } // end switch on data dimension
       } // end loop over blocks
+      // Retain only the nodes in the output subset (outputNodes is sorted, so the compaction can be done in place)
+      if (subsetOutput) {
+        for (int j=0; j<num_output_nodes; j++) {
+          xptr[j] = xptr[outputNodes[j]];
+          yptr[j] = yptr[outputNodes[j]];
+          zptr[j] = zptr[outputNodes[j]];
+        }
+      }
       // Mothership-like vectors filled now; pass data to exodus database (switch again on dimension of data)
       if (spec.getLength() == PeridigmField::SCALAR) {
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[name], num_nodes, xptr);
+        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[name], num_output_nodes, xptr);
         if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
       }
       else if (spec.getLength() == PeridigmField::VECTOR) {
@@ -348,11 +412,11 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
         string tmpnameX = name+"X";
         string tmpnameY = name+"Y";
         string tmpnameZ = name+"Z";
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameX], num_nodes, xptr);
+        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameX], num_output_nodes, xptr);
         if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameY], num_nodes, yptr);
+        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameY], num_output_nodes, yptr);
         if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameZ], num_nodes, zptr);
+        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameZ], num_output_nodes, zptr);
         if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
       }
     } // end if per-node variable
@@ -360,12 +424,15 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
     else if (spec.getRelation() == PeridigmField::ELEMENT) {
       // Loop over all blocks, passing data from each block to exodus database
       std::vector<PeridigmNS::Block>::iterator blockIt;
-      for(blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++) {
-        int block_num_nodes = (blockIt->getDataManager()->getOwnedScalarPointMap())->NumMyElements();
+      int blockIndex = 0;
+      for(blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++, blockIndex++) {
+        // Block-local indices of the elements in the output subset
+        const std::vector<int>& outputElements = blockOutputElements[blockIndex];
+        int block_num_nodes = outputElements.size();
         if (block_num_nodes == 0) continue; // Don't write data for empty blocks
         if (spec.getId() == elementIdFieldId) { // Handle special case of ID (int type)
           for (int j=0; j<block_num_nodes; j++)
-            xptr[j] = (double)(((blockIt->getDataManager()->getOwnedScalarPointMap())->GID(j))+1);
+            xptr[j] = (double)(((blockIt->getDataManager()->getOwnedScalarPointMap())->GID(outputElements[j]))+1);
           retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[name], blockIt->getID(), block_num_nodes, xptr);
           if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
         }
@@ -385,15 +452,20 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
             epetra_vector->ExtractView(&block_ptr);
             // switch on dimension of data
             if (spec.getLength() == PeridigmField::SCALAR) {
+              if (subsetOutput) {
+                for (int j=0;j<block_num_nodes; j++)
+                  xptr[j] = block_ptr[outputElements[j]];
+                block_ptr = xptr;
+              }
               retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[name], blockIt->getID(), block_num_nodes, block_ptr);
               if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
             }
             else if (spec.getLength() == PeridigmField::VECTOR) {
               // copy data into x, y, and z vectors (non-interleaved)
               for (int j=0;j<block_num_nodes; j++) {
-                xptr[j] = block_ptr[3*j];
-                yptr[j] = block_ptr[3*j+1];
-                zptr[j] = block_ptr[3*j+2];
+                xptr[j] = block_ptr[3*outputElements[j]];
+                yptr[j] = block_ptr[3*outputElements[j]+1];
+                zptr[j] = block_ptr[3*outputElements[j]+2];
               }
               // write the vectors to the exodus file
               string tmpnameX = name+"X";
@@ -424,7 +496,7 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
               for(int component=0 ; component<9 ; ++component){
                 // copy data into a non-interleaved array
                 for (int j=0; j<block_num_nodes; j++)
-                  xptr[j] = block_ptr[9*j+component];
+                  xptr[j] = block_ptr[9*outputElements[j]+component];
                 // write data to exodus file
                 string tmpname = name+suffix[component];
                 retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpname], blockIt->getID(), block_num_nodes, xptr);
@@ -446,7 +518,7 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
               for(int component=0 ; component<length ; ++component){
                 // copy data into a non-interleaved array
                 for (int j=0; j<block_num_nodes; j++)
-                  xptr[j] = block_ptr[length*j+component];
+                  xptr[j] = block_ptr[length*outputElements[j]+component];
                 // write data to exodus file
                 string tmpname = name+suffix[component];
                 retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpname], blockIt->getID(), block_num_nodes, xptr);
@@ -516,12 +588,31 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
    * Initialize ExodusII database
    */
 
+  // Determine which points will be written to the database
+  computeOutputSubset(blocks);
+  std::vector<int> outputNodeIndex(peridigm->getOneDimensionalMap()->NumMyElements(), -1);
+  for(unsigned int i=0 ; i<outputNodes.size() ; ++i)
+    outputNodeIndex[outputNodes[i]] = i;
+
   // Obtain the node sets
   Teuchos::RCP< std::map< std::string, std::vector<int> > > exodusNodeSets = peridigm->getExodusNodeSets();
   std::map< std::string, std::vector<int> >::iterator nsIt;
 
+  // Restrict the node sets to the output subset, renumbering the nodes accordingly
+  if(subsetOutput){
+    for(nsIt = exodusNodeSets->begin() ; nsIt != exodusNodeSets->end() ; nsIt++){
+      std::vector<int> subsetNodeSet;
+      for(unsigned int i=0 ; i<nsIt->second.size() ; ++i){
+        int index = outputNodeIndex[nsIt->second[i] - 1];
+        if(index != -1)
+          subsetNodeSet.push_back(index + 1);
+      }
+      nsIt->second.swap(subsetNodeSet);
+    }
+  }
+
   int num_dimensions = 3;
-  int num_nodes = peridigm->getOneDimensionalMap()->NumMyElements();
+  int num_nodes = outputNodes.size();
   int num_elements = num_nodes;
   int num_element_blocks = blocks->size();
   int num_node_sets = exodusNodeSets()->size();
@@ -534,12 +625,12 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   if(num_nodes == 0)
     haveData = false;
 
-  // Default to storing and writing doubles
-  int CPU_word_size, IO_word_size;
-  CPU_word_size = IO_word_size = sizeof(double);
-
   // Initialize exodus database; Overwrite any existing file with this name
-  file_handle = ex_create(filename.str().c_str(),EX_CLOBBER,&CPU_word_size,&IO_word_size);
+  // Variables skipped under a Delta Threshold occupy no storage only in the netCDF-4 format
+  int createMode = EX_CLOBBER;
+  if(!deltaThresholds.empty())
+    createMode |= EX_NETCDF4;
+  file_handle = ex_create(filename.str().c_str(),createMode,&CPU_word_size,&IO_word_size);
   if (file_handle < 0) reportExodusError(file_handle, "OutputManager_ExodusII", "ex_create");
 
   // clear the maps
@@ -606,13 +697,12 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   // So, extract and copy the data to temporary storage that can be handed to the exodus api
   double *coord_values;
   peridigm->x->ExtractView( &coord_values );
-  int numMyElements = peridigm->x->Map().NumMyElements();
-  std::vector<double> xcoord_values_vec(numMyElements), ycoord_values_vec(numMyElements), zcoord_values_vec(numMyElements);
+  std::vector<double> xcoord_values_vec(num_nodes), ycoord_values_vec(num_nodes), zcoord_values_vec(num_nodes);
   double *xcoord_values = &xcoord_values_vec[0];
   double *ycoord_values = &ycoord_values_vec[0];
   double *zcoord_values = &zcoord_values_vec[0];
-  for( int i=0 ; i<numMyElements ; i++ ) {
-    int firstPoint = peridigm->x->Map().FirstPointInElement(i);
+  for( int i=0 ; i<num_nodes ; i++ ) {
+    int firstPoint = peridigm->x->Map().FirstPointInElement(outputNodes[i]);
     xcoord_values[i] = coord_values[firstPoint];
     ycoord_values[i] = coord_values[firstPoint+1];
     zcoord_values[i] = coord_values[firstPoint+2];
@@ -633,8 +723,8 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   std::vector<PeridigmNS::Block>::iterator blockIt;
   int i=0;
   for(i=0, blockIt = blocks->begin(); blockIt != blocks->end(); blockIt++, i++) {
-    // Use only the number of owned elements
-    num_elem_in_block[i] = (blockIt->getDataManager()->getOwnedScalarPointMap())->NumMyElements();
+    // Use only the number of owned elements in the output subset
+    num_elem_in_block[i] = blockOutputElements[i].size();
     num_nodes_in_elem[i] = 1; // always using sphere elements
     elem_block_ID[i]     = blockIt->getID();
     retval = ex_put_elem_block(file_handle,elem_block_ID[i],"SPHERE",num_elem_in_block[i],num_nodes_in_elem[i],0);
@@ -653,14 +743,15 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   if (retval!= 0) reportExodusError(retval, "initializeExodusDatabase", "ex_put_names EX_ELEM_BLOCK");
 
   // Write element connectivity
-  for(blockIt = blocks->begin(); blockIt != blocks->end(); blockIt++) {
-    int numMyElements = blockIt->getOwnedScalarPointMap()->NumMyElements();
+  for(i=0, blockIt = blocks->begin(); blockIt != blocks->end(); blockIt++, i++) {
+    const std::vector<int>& outputElements = blockOutputElements[i];
+    int numMyElements = outputElements.size();
     if (numMyElements == 0) continue; // don't insert connectivity info for empty blocks
     std::vector<int> connect_vec(numMyElements);
     int *connect = &connect_vec[0];
     for (int j=0;j<numMyElements;j++) {
-      int GID = blockIt->getOwnedScalarPointMap()->GID(j);
-      connect[j] = peridigm->getOneDimensionalMap()->LID(GID)+1;
+      int GID = blockIt->getOwnedScalarPointMap()->GID(outputElements[j]);
+      connect[j] = outputNodeIndex[peridigm->getOneDimensionalMap()->LID(GID)]+1;
     }
     retval = ex_put_elem_conn(file_handle, blockIt->getID(), connect);
     if (retval!= 0) reportExodusError(retval, "initializeExodusDatabase", "ex_put_elem_conn");
@@ -670,7 +761,7 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   std::vector<int> node_map_vec(num_nodes);
   int *node_map = &node_map_vec[0];
   for (i=0; i<num_nodes; i++){
-    node_map[i] = peridigm->getOneDimensionalMap()->GID(i)+1;
+    node_map[i] = peridigm->getOneDimensionalMap()->GID(outputNodes[i])+1;
   }
   retval = ex_put_node_num_map(file_handle, node_map);
   if (retval!= 0) reportExodusError(retval, "initializeExodusDatabase", "ex_put_node_num_map");
@@ -679,11 +770,12 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP<
   std::vector<int> elem_map_vec(num_nodes);
   int *elem_map = &elem_map_vec[0];
   int elem_map_index = 0;
-  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++) {
+  for(i=0, blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++, i++) {
     Teuchos::RCP<const Epetra_BlockMap> map = blockIt->getOwnedScalarPointMap();
-    for(int i=0; i<map->NumMyElements() ; ++i){
+    const std::vector<int>& outputElements = blockOutputElements[i];
+    for(unsigned int j=0; j<outputElements.size() ; ++j){
       TEUCHOS_TEST_FOR_EXCEPT_MSG(elem_map_index >= num_nodes, "\nPeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(), Error processing element map!\n");
-      elem_map[elem_map_index++] = map->GID(i)+1;
+      elem_map[elem_map_index++] = map->GID(outputElements[j])+1;
     }
   }
   retval = ex_put_elem_num_map(file_handle, elem_map);
@@ -936,10 +1028,6 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabaseWithOnlyGlobalD
    * Now, initialize ExodusII database
    */
 
-  // Default to storing and writing doubles
-  int CPU_word_size, IO_word_size;
-  CPU_word_size = IO_word_size = sizeof(double);
-
   // Initialize exodus database; Overwrite any existing file with this name
   file_handle = ex_create(filename.str().c_str(),EX_CLOBBER,&CPU_word_size,&IO_word_size);
   if (file_handle < 0) reportExodusError(file_handle, "OutputManager_ExodusII", "ex_create");
@@ -1050,6 +1138,123 @@ void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabaseWithOnlyGlobalD
   }
 }
 
+void PeridigmNS::OutputManager_ExodusII::computeOutputSubset(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) {
+
+  Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap = peridigm->getOneDimensionalMap();
+  int numOwnedPoints = oneDimensionalMap->NumMyElements();
+
+  // Flag the points that pass all of the requested filters
+  std::vector<bool> inSubset(numOwnedPoints, true);
+  subsetOutput = false;
+
+  // Every k-th point, based on global id so that the subset does not depend on the decomposition
+  int stride = outputSubset->get<int>("Stride", 1);
+  TEUCHOS_TEST_FOR_EXCEPTION(stride < 1, std::invalid_argument, "PeridigmNS::OutputManager_ExodusII::computeOutputSubset() -- Stride must be a positive integer.");
+  if(stride > 1){
+    subsetOutput = true;
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      if(oneDimensionalMap->GID(i) % stride != 0)
+        inSubset[i] = false;
+    }
+  }
+
+  // Points in a node set
+  if(outputSubset->isParameter("Node Set")){
+    subsetOutput = true;
+    string nodeSetName = outputSubset->get<string>("Node Set");
+    Teuchos::RCP< std::map< std::string, std::vector<int> > > exodusNodeSets = peridigm->getExodusNodeSets();
+    std::map< std::string, std::vector<int> >::iterator nsIt = exodusNodeSets->find(nodeSetName);
+    TEUCHOS_TEST_FOR_EXCEPTION(nsIt == exodusNodeSets->end(), std::invalid_argument,
+                               "PeridigmNS::OutputManager_ExodusII::computeOutputSubset() -- Unknown node set " + nodeSetName + ".");
+    std::vector<bool> inNodeSet(numOwnedPoints, false);
+    for(unsigned int i=0 ; i<nsIt->second.size() ; ++i)
+      inNodeSet[nsIt->second[i] - 1] = true;
+    for(int i=0 ; i<numOwnedPoints ; ++i)
+      inSubset[i] = inSubset[i] && inNodeSet[i];
+  }
+
+  // Points within a bounding box (reference configuration)
+  const char* boundNames[6] = {"X Min", "X Max", "Y Min", "Y Max", "Z Min", "Z Max"};
+  double bounds[6] = {-std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                      -std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                      -std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  bool haveBoundingBox = false;
+  for(int i=0 ; i<6 ; ++i){
+    if(outputSubset->isParameter(boundNames[i])){
+      bounds[i] = outputSubset->get<double>(boundNames[i]);
+      haveBoundingBox = true;
+    }
+  }
+  if(haveBoundingBox){
+    subsetOutput = true;
+    double *coord_values;
+    peridigm->x->ExtractView( &coord_values );
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      int firstPoint = peridigm->x->Map().FirstPointInElement(i);
+      for(int dof=0 ; dof<3 ; ++dof){
+        double coord = coord_values[firstPoint+dof];
+        if(coord < bounds[2*dof] || coord > bounds[2*dof+1])
+          inSubset[i] = false;
+      }
+    }
+  }
+
+  outputNodes.clear();
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    if(inSubset[i])
+      outputNodes.push_back(i);
+  }
+
+  blockOutputElements.clear();
+  blockOutputElements.resize(blocks->size());
+  int blockIndex = 0;
+  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++, blockIndex++) {
+    Teuchos::RCP<const Epetra_BlockMap> map = blockIt->getOwnedScalarPointMap();
+    std::vector<int>& outputElements = blockOutputElements[blockIndex];
+    for(int j=0 ; j<map->NumMyElements() ; ++j){
+      if(inSubset[oneDimensionalMap->LID(map->GID(j))])
+        outputElements.push_back(j);
+    }
+  }
+}
+
+bool PeridigmNS::OutputManager_ExodusII::variableChanged(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks,
+                                                         const PeridigmNS::FieldSpec& spec) {
+
+  std::vector< std::vector<double> >& lastValues = lastWrittenValues[spec.getLabel()];
+  bool firstDump = lastValues.empty();
+
+  PeridigmField::Step step = PeridigmField::STEP_NONE;
+  if(spec.getTemporal() == PeridigmField::TWO_STEP)
+    step = PeridigmField::STEP_NP1;
+  int length = PeridigmField::variableDimension(spec.getLength());
+
+  // Compare the owned values against those at the last dump
+  std::vector< std::vector<double> > currentValues(blocks->size());
+  double localMaxChange(0.0), globalMaxChange(0.0);
+  int blockIndex = 0;
+  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++, blockIndex++) {
+    if(!blockIt->hasData(spec.getId(), step))
+      continue;
+    double *block_ptr;
+    blockIt->getData(spec.getId(), step)->ExtractView(&block_ptr);
+    unsigned int numValues = length*blockIt->getOwnedScalarPointMap()->NumMyElements();
+    currentValues[blockIndex].assign(block_ptr, block_ptr + numValues);
+    if(!firstDump && lastValues[blockIndex].size() == numValues){
+      for(unsigned int i=0 ; i<numValues ; ++i)
+        localMaxChange = std::max(localMaxChange, std::fabs(block_ptr[i] - lastValues[blockIndex][i]));
+    }
+  }
+
+  // Skip or write consistently across all processors
+  peridigm->getEpetraComm()->MaxAll(&localMaxChange, &globalMaxChange, 1);
+  if(!firstDump && globalMaxChange < deltaThresholds[spec.getLabel()])
+    return false;
+
+  lastValues.swap(currentValues);
+  return true;
+}
+
 void PeridigmNS::OutputManager_ExodusII::reportExodusError(int errorCode, const char *methodName, const char*exodusMethodName) {
   std::stringstream ss;
   if (errorCode < 0) { // error
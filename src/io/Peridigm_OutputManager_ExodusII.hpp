@@ -47,8 +47,10 @@
 #define PERIDIGM_OUTPUTMANAGER_EXODUSII_HPP
 
 #include <map>
+#include <vector>
 
 #include <Peridigm_OutputManager.hpp>
+#include <Peridigm_Field.hpp>
 
 #include <Teuchos_ParameterList.hpp>
 
@@ -103,6 +105,12 @@ namespace PeridigmNS {
     //! Write the QA record
     void writeQARecord(int exoid);
 
+    //! Determine which on-processor points are written to the database (Output Subset)
+    void computeOutputSubset(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
+    //! Returns true if the variable changed by more than its Delta Threshold since it was last written
+    bool variableChanged(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, const PeridigmNS::FieldSpec& spec);
+
     //! Parent pointer
     PeridigmNS::Peridigm *peridigm;
 
@@ -130,6 +138,24 @@ namespace PeridigmNS {
     //! Flag indicating Exodus databases that contain only global data
     bool globalDataOnly;
 
+    //! Parameters defining the subset of points written to the database
+    Teuchos::RCP<Teuchos::ParameterList> outputSubset;
+
+    //! Flag indicating that only a subset of the points is written to the database
+    bool subsetOutput;
+
+    //! Local ids (one-dimensional map) of the nodes written to the database, in ascending order
+    std::vector<int> outputNodes;
+
+    //! For each block, the owned block-local indices of the elements written to the database
+    std::vector< std::vector<int> > blockOutputElements;
+
+    //! Per-variable Delta Threshold; variables are skipped when the max change since the last dump is below it, leaving undefined values at that step
+    std::map<std::string, double> deltaThresholds;
+
+    //! Values of delta-thresholded variables at the last dump, stored per block
+    std::map< std::string, std::vector< std::vector<double> > > lastWrittenValues;
+
     //! Map from global output field name to integer. Exodus uses an integer (1..k)  to index the output fields
     std::map <std::string, int> global_output_field_map;
 
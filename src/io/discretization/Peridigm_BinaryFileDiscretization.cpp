@@ -0,0 +1,208 @@
+/*! \file Peridigm_BinaryFileDiscretization.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_BinaryFileDiscretization.hpp"
+#include "Peridigm_MappedFile.hpp"
+
+#include <Epetra_BlockMap.h>
+
+#include <cstring>
+#include <climits>
+#include <stdint.h>
+
+using namespace std;
+
+PeridigmNS::BinaryFileDiscretization::BinaryFileDiscretization(const Teuchos::RCP<const Epetra_Comm>& epetra_comm,
+                                                               const Teuchos::RCP<Teuchos::ParameterList>& params) :
+  PointCloudDiscretization(epetra_comm, params)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(params->get<string>("Type") != "Binary File", "Invalid Type in BinaryFileDiscretization");
+
+  string meshFileName = params->get<string>("Input Mesh File");
+
+  // Read this processor's share of the points directly from the memory-mapped file
+  // Each processor reads a contiguous range of points in processor order, so the global ids assigned in
+  // createDiscretization() are the indices of the points in the file
+  vector<double> coordinates;
+  vector<double> volumes;
+  vector<double> horizons;
+  vector<int> blockIds;
+  map<int, string> blockNames;
+  bool hasHorizons(false);
+  readBinaryFile(meshFileName, coordinates, volumes, hasHorizons, horizons, blockIds, blockNames);
+
+  createDiscretization(coordinates, volumes, blockIds, hasHorizons, horizons, blockNames);
+
+  // Keep only the node set entries that are owned by this processor in the load balanced decomposition
+  for(map< string, vector<int> >::iterator it = nodeSets->begin() ; it != nodeSets->end() ; it++){
+    vector<int>& nodeSet = it->second;
+    vector<int> ownedNodes;
+    for(unsigned int i=0 ; i<nodeSet.size() ; ++i){
+      if(oneDimensionalMap->LID(nodeSet[i]) != -1)
+        ownedNodes.push_back(nodeSet[i]);
+    }
+    nodeSet.swap(ownedNodes);
+  }
+}
+
+PeridigmNS::BinaryFileDiscretization::~BinaryFileDiscretization() {}
+
+namespace {
+
+  //! Header of a binary discretization file, see Peridigm_BinaryFileDiscretization.hpp for the file layout.
+  struct BinaryDiscretizationHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t numPoints;
+    uint64_t numNodeSets;
+    uint64_t numBlockNames;
+    uint64_t reserved[3];
+  };
+
+  const char binaryDiscretizationMagic[8] = {'P', 'D', 'B', 'I', 'N', 'D', 'S', 'C'};
+  const uint32_t binaryDiscretizationVersion = 2;
+  const uint32_t binaryDiscretizationHorizonFlag = 1;
+  const size_t binaryDiscretizationNameLength = 64;
+}
+
+void PeridigmNS::BinaryFileDiscretization::readBinaryFile(const string& binaryFileName,
+                                                          vector<double>& coordinates,
+                                                          vector<double>& volumes,
+                                                          bool& hasHorizons,
+                                                          vector<double>& horizons,
+                                                          vector<int>& blockIds,
+                                                          map<int, string>& blockNames)
+{
+  // The mapping is released when file goes out of scope, including when one of the checks below throws
+  MappedFile file(binaryFileName, "discretization binary file");
+  size_t fileSize = file.size();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(fileSize < sizeof(BinaryDiscretizationHeader), "**** Error, discretization binary file is too small to contain a header.\n");
+  const char* const fileBegin = file.data();
+
+  BinaryDiscretizationHeader header;
+  memcpy(&header, fileBegin, sizeof(header));
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(memcmp(header.magic, binaryDiscretizationMagic, 8) != 0,
+                              "**** Error, " + binaryFileName + " is not a Peridigm binary discretization file.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(header.version < 1 || header.version > binaryDiscretizationVersion,
+                              "**** Error, unsupported binary discretization file version.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(header.numPoints > static_cast<uint64_t>(INT_MAX),
+                              "**** Error, binary discretization file contains more points than can be indexed.\n");
+
+  size_t numPoints = static_cast<size_t>(header.numPoints);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(header.numPoints == 0, "**** Error reading discretization binary file, no data found.\n");
+  hasHorizons = (header.flags & binaryDiscretizationHorizonFlag) != 0;
+
+  // Version 1 files have no block names, the field was reserved
+  uint64_t numBlockNames = header.version >= 2 ? header.numBlockNames : 0;
+
+  // Byte offsets of the arrays
+  size_t coordinatesOffset = sizeof(BinaryDiscretizationHeader);
+  size_t volumesOffset = coordinatesOffset + 3*numPoints*sizeof(double);
+  size_t horizonsOffset = volumesOffset + numPoints*sizeof(double);
+  size_t blockIdsOffset = horizonsOffset + (hasHorizons ? numPoints*sizeof(double) : 0);
+  size_t blockNamesOffset = blockIdsOffset + numPoints*sizeof(int32_t);
+  size_t nodeSetsOffset = blockNamesOffset + numBlockNames*(sizeof(int32_t) + binaryDiscretizationNameLength);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(fileSize < nodeSetsOffset, "**** Error, discretization binary file is truncated.\n");
+
+  // This processor's contiguous share of the points
+  size_t first = (numPoints * myPID) / numPID;
+  size_t last = (numPoints * (myPID + 1)) / numPID;
+  size_t count = last - first;
+
+  coordinates.resize(3*count);
+  volumes.resize(count);
+  blockIds.resize(count);
+  if(count > 0){
+    memcpy(&coordinates[0], fileBegin + coordinatesOffset + 3*first*sizeof(double), 3*count*sizeof(double));
+    memcpy(&volumes[0], fileBegin + volumesOffset + first*sizeof(double), count*sizeof(double));
+    vector<int32_t> fileBlockIds(count);
+    memcpy(&fileBlockIds[0], fileBegin + blockIdsOffset + first*sizeof(int32_t), count*sizeof(int32_t));
+    for(size_t i=0 ; i<count ; ++i)
+      blockIds[i] = static_cast<int>(fileBlockIds[i]);
+    if(hasHorizons){
+      horizons.resize(count);
+      memcpy(&horizons[0], fileBegin + horizonsOffset + first*sizeof(double), count*sizeof(double));
+    }
+  }
+
+  // Block names
+  size_t offset = blockNamesOffset;
+  for(uint64_t iBlock=0 ; iBlock<numBlockNames ; ++iBlock){
+    int32_t blockId;
+    memcpy(&blockId, fileBegin + offset, sizeof(int32_t));
+    offset += sizeof(int32_t);
+    char name[binaryDiscretizationNameLength + 1];
+    memcpy(name, fileBegin + offset, binaryDiscretizationNameLength);
+    name[binaryDiscretizationNameLength] = '\0';
+    offset += binaryDiscretizationNameLength;
+    blockNames[static_cast<int>(blockId)] = string(name);
+  }
+
+  // Node sets are read in full, entries not owned after load balancing are discarded in the constructor
+  offset = nodeSetsOffset;
+  for(uint64_t iSet=0 ; iSet<header.numNodeSets ; ++iSet){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(fileSize < offset + binaryDiscretizationNameLength + sizeof(uint64_t),
+                                "**** Error, discretization binary file is truncated.\n");
+    char name[binaryDiscretizationNameLength + 1];
+    memcpy(name, fileBegin + offset, binaryDiscretizationNameLength);
+    name[binaryDiscretizationNameLength] = '\0';
+    offset += binaryDiscretizationNameLength;
+    uint64_t numNodes;
+    memcpy(&numNodes, fileBegin + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(fileSize < offset + numNodes*sizeof(int32_t), "**** Error, discretization binary file is truncated.\n");
+    string nodeSetName(name);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) != nodeSets->end(), "**** Duplicate node set found: " + nodeSetName + "\n");
+    vector<int>& nodeSet = (*nodeSets)[nodeSetName];
+    vector<int32_t> nodeIds(numNodes);
+    if(numNodes > 0)
+      memcpy(&nodeIds[0], fileBegin + offset, numNodes*sizeof(int32_t));
+    nodeSet.assign(nodeIds.begin(), nodeIds.end());
+    offset += numNodes*sizeof(int32_t);
+  }
+}
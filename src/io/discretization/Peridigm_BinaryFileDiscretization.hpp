@@ -0,0 +1,101 @@
+/*! \file Peridigm_BinaryFileDiscretization.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_BINARYFILEDISCRETIZATION_HPP
+#define PERIDIGM_BINARYFILEDISCRETIZATION_HPP
+
+#include "Peridigm_PointCloudDiscretization.hpp"
+
+namespace PeridigmNS {
+
+  /*! \brief Discretization class that creates discretization from a binary file containing node locations, volumes, and block ids.
+   *
+   *  The binary file is a 64-byte header followed by contiguous arrays (all values little endian):
+   *
+   *  - char magic[8] = "PDBINDSC", uint32 version = 2, uint32 flags (bit 0 set if horizons are present),
+   *    uint64 number of points, uint64 number of node sets, uint64 number of block names, 24 reserved bytes
+   *  - double coordinates[3*numPoints], stored as (x, y, z) triplets
+   *  - double volumes[numPoints]
+   *  - double horizons[numPoints], present only if the horizon flag is set
+   *  - int32 blockIds[numPoints]
+   *  - for each block name:  int32 blockId, char name[64]
+   *  - for each node set:  char name[64], uint64 numNodes, int32 nodeIds[numNodes] (0-based)
+   *
+   *  Version 1 files have no block names.  Blocks without a name are named "block_<id>".  The global id of each
+   *  point is its index in the arrays.  Files are written by scripts/convert_to_binary_discretization.py.
+   */
+  class BinaryFileDiscretization : public PeridigmNS::PointCloudDiscretization {
+
+  public:
+
+    //! Constructor
+    BinaryFileDiscretization(const Teuchos::RCP<const Epetra_Comm>& epetraComm,
+                             const Teuchos::RCP<Teuchos::ParameterList>& params);
+
+    //! Destructor
+    virtual ~BinaryFileDiscretization();
+
+  private:
+
+    //! Private to prohibit copying
+    BinaryFileDiscretization(const BinaryFileDiscretization&);
+
+    //! Private to prohibit copying
+    BinaryFileDiscretization& operator=(const BinaryFileDiscretization&);
+
+    //! Memory-maps the binary file and copies this processor's contiguous share of the points, the block names, and all node sets.
+    void readBinaryFile(const std::string& binaryFileName,
+                        std::vector<double>& coordinates,
+                        std::vector<double>& volumes,
+                        bool& hasHorizons,
+                        std::vector<double>& horizons,
+                        std::vector<int>& blockIds,
+                        std::map<int, std::string>& blockNames);
+  };
+}
+
+#endif // PERIDIGM_BINARYFILEDISCRETIZATION_HPP
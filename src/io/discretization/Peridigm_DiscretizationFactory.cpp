@@ -49,6 +49,7 @@
 #include "Peridigm_DiscretizationFactory.hpp"
 #include "Peridigm_ExodusDiscretization.hpp"
 #include "Peridigm_TextFileDiscretization.hpp"
+#include "Peridigm_BinaryFileDiscretization.hpp"
 #include "Peridigm_PdQuickGridDiscretization.hpp"
 
 using namespace std;
@@ -78,12 +79,15 @@ PeridigmNS::DiscretizationFactory::create(const Teuchos::RCP<const Epetra_Comm>&
   else if(type == "Text File"){
 	discretization = Teuchos::rcp(new PeridigmNS::TextFileDiscretization(epetra_comm, discParams));
   }
+  else if(type == "Binary File"){
+	discretization = Teuchos::rcp(new PeridigmNS::BinaryFileDiscretization(epetra_comm, discParams));
+  }
   else if(type == "PdQuickGrid"){
 	discretization = Teuchos::rcp(new PeridigmNS::PdQuickGridDiscretization(epetra_comm, discParams));
   }
   else{
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, 
-		       "**** Invalid discretization type.  Valid types are \"Exodus\", \"Text File\", and \"PdQuickGrid\".\n");
+		       "**** Invalid discretization type.  Valid types are \"Exodus\", \"Text File\", \"Binary File\", and \"PdQuickGrid\".\n");
   }
  
   return discretization;
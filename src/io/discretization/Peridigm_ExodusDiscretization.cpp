@@ -51,9 +51,12 @@
 #include "Peridigm_GeometryUtils.hpp"
 #include "Peridigm_Constants.hpp"
 #include "Peridigm_Enums.hpp"
+#include "PdZoltan.h"
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
+#include <Epetra_MultiVector.h>
 #include <Epetra_Import.h>
+#include <Epetra_Export.h>
 #include <Epetra_MpiComm.h>
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_DefaultComm.hpp>
@@ -62,6 +65,7 @@
 #include <Ionit_Initializer.h>
 #include <sstream>
 #include <set>
+#include <algorithm>
 #include <math.h>
 #include <exodusII.h>
 
@@ -77,6 +81,7 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   storeExodusMesh(false),
   constructInterfaces(false),
   computeIntersections(false),
+  parallelRead(false),
   maxElementDimension(0.0),
   numBonds(0),
   maxNumBondsPerElem(0),
@@ -109,11 +114,21 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
     storeExodusMesh = constructInterfaces;
   }
 
+  // Read a single, undecomposed mesh file in parallel (each processor reads a contiguous slice of the elements)
+  if(params->isParameter("Parallel Read")){
+    parallelRead = params->get<bool>("Parallel Read");
+  }
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(parallelRead && storeExodusMesh,
+                              "**** Error:  \"Parallel Read\" is not compatible with \"Store Exodus Mesh\", \"Compute Element-Horizon Intersections\", or \"Construct Interfaces\".\n");
+
   // Set up bond filters
   createBondFilters(params);
 
   // Load data from mesh file
-  loadData(meshFileName);
+  if(parallelRead && numPID > 1)
+    loadDataParallel(meshFileName);
+  else
+    loadData(meshFileName);
 
   if(computeIntersections)
     maxElementDimension = computeMaxElementDimension();
@@ -616,6 +631,341 @@ void PeridigmNS::ExodusDiscretization::loadData(const string& meshFileName)
   if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadData()", "ex_close");
 }
 
+void PeridigmNS::ExodusDiscretization::loadDataParallel(const string& meshFileName)
+{
+  // Open the (single) genesis file on every processor
+  int compWordSize = sizeof(double);
+  int ioWordSize = 0;
+  float exodusVersion;
+  int exodusFileId = ex_open(meshFileName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
+  if(exodusFileId < 0){
+    cout << "\n****Error on processor " << myPID << ": unable to open file " << meshFileName.c_str() << "\n" << endl;
+    reportExodusError(exodusFileId, "ExodusDiscretization::loadDataParallel()", "ex_open");
+  }
+
+  // Read the initialization parameters
+  int numDim, numNodes, numElem, numElemBlocks, numNodeSets, numSideSets;
+  char title[MAX_LINE_LENGTH];
+  int retval = ex_get_init(exodusFileId, title, &numDim, &numNodes, &numElem, &numElemBlocks, &numNodeSets, &numSideSets);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_init");
+
+  // Each processor is responsible for a contiguous range of elements, [myFirstElem, myFirstElem + myNumElem)
+  // Exodus numbers elements block by block, so the range may span several element blocks
+  int myFirstElem = static_cast<int>( (static_cast<long long>(numElem) * myPID) / numPID );
+  int myLastElem = static_cast<int>( (static_cast<long long>(numElem) * (myPID + 1)) / numPID );
+  int myNumElem = myLastElem - myFirstElem;
+
+  // Global element numbering for this processor's slice
+  vector<int> elemIdMap(myNumElem);
+  if(myNumElem > 0){
+    retval = ex_get_partial_id_map(exodusFileId, EX_ELEM_MAP, myFirstElem + 1, myNumElem, elemIdMap.data());
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_id_map");
+  }
+
+  // Use the original_global_id_map, if one is provided (see loadData())
+  int numNodeMaps, numElemMaps;
+  retval = ex_get_map_param(exodusFileId, &numNodeMaps, &numElemMaps);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_map_param");
+  if(numElemMaps > 0){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numElemMaps > 1,
+                                "**** Error in ExodusDiscretization::loadDataParallel(), genesis file contains invalid number of auxiliary element maps (>1).\n");
+    char mapName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_MAP, 1, mapName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_name");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(string(mapName) != string("original_global_id_map"),
+                                "**** Error in ExodusDiscretization::loadDataParallel(), unknown exodus EX_ELEM_MAP: " + string(mapName) + ".\n");
+    if(myNumElem > 0){
+      retval = ex_get_partial_num_map(exodusFileId, EX_ELEM_MAP, 1, myFirstElem + 1, myNumElem, elemIdMap.data());
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_num_map");
+    }
+  }
+  for(int i=0 ; i<myNumElem ; ++i)
+    elemIdMap[i] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+
+  vector<int> elemBlockIds(numElemBlocks);
+  retval = ex_get_elem_blk_ids(exodusFileId, &elemBlockIds[0]);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_elem_blk_ids");
+
+  // Read the connectivity (and sphere attributes) for the portion of each block that falls in this processor's range
+  // The block metadata is read on all processors so that every processor is aware of every block
+  vector<ExodusElementType> myElemType(myNumElem, UNKNOWN_ELEMENT);
+  vector<int> myElemBlockId(myNumElem);
+  vector<int> myElemConnOffset(myNumElem + 1, 0);
+  vector<int> myConn;
+  vector<double> mySphereVolume(myNumElem, 0.0);
+  map<int, string> blockIdToName;
+  bool tenNodedTetWarningGiven(false), twentyNodedHexWarningGiven(false);
+  int blockFirstElem(0), myLocalElem(0);
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; iElemBlock++){
+
+    int elemBlockId = elemBlockIds[iElemBlock];
+
+    char exodusElemBlockName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_BLOCK, elemBlockId, exodusElemBlockName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_name");
+    string elemBlockName(exodusElemBlockName);
+    if(elemBlockName.size() == 0){
+      stringstream ss;
+      ss << "block_" << elemBlockId;
+      elemBlockName = ss.str();
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(elementBlocks->find(elemBlockName) != elementBlocks->end(), "**** Duplicate block found: " + elemBlockName + "\n");
+    (*elementBlocks)[elemBlockName] = vector<int>();
+    blockIdToName[elemBlockId] = elemBlockName;
+
+    char elemType[MAX_STR_LENGTH];
+    int numElemThisBlock, numNodesPerElem, numAttributes;
+    retval = ex_get_elem_block(exodusFileId, elemBlockId, elemType, &numElemThisBlock, &numNodesPerElem, &numAttributes);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_elem_block");
+
+    // Intersection of this block with this processor's element range
+    int first = max(blockFirstElem, myFirstElem);
+    int last = min(blockFirstElem + numElemThisBlock, myLastElem);
+    blockFirstElem += numElemThisBlock;
+    if(last <= first)
+      continue;
+    int numElemToRead = last - first;
+    int startInBlock = first - (blockFirstElem - numElemThisBlock);
+
+    ExodusElementType exodusElementType(UNKNOWN_ELEMENT);
+    string elemTypeString(elemType);
+    to_upper(elemTypeString);
+    if(elemTypeString == string("SPHERE"))
+      exodusElementType = SPHERE_ELEMENT;
+    else if(elemTypeString == string("TET") || elemTypeString == string("TETRA") || elemTypeString == string("TET4") || elemTypeString == string("TET10"))
+      exodusElementType = TET_ELEMENT;
+    else if(elemTypeString == string("HEX") || elemTypeString == string("HEX8") || elemTypeString == string("HEX20"))
+      exodusElementType = HEX_ELEMENT;
+    else{
+      string msg = "\n**** Error in loadDataParallel(), unknown element type " + elemTypeString + ".\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
+    }
+
+    if(exodusElementType == TET_ELEMENT && numNodesPerElem == 10 && !tenNodedTetWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 10-node tetrahedron element, will be treated as 4-node tetrahedron element." << endl;
+      tenNodedTetWarningGiven = true;
+    }
+    if(exodusElementType == HEX_ELEMENT && numNodesPerElem == 20 && !twentyNodedHexWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 20-node hexahedron element, will be treated as 8-node hexahedron element." << endl;
+      twentyNodedHexWarningGiven = true;
+    }
+
+    vector<int> conn(numElemToRead*numNodesPerElem);
+    retval = ex_get_partial_conn(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock + 1, numElemToRead, &conn[0], NULL, NULL);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_conn");
+
+    vector<double> attributes;
+    if(exodusElementType == SPHERE_ELEMENT){
+      attributes.resize(numElemToRead*numAttributes);
+      retval = ex_get_partial_attr(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock + 1, numElemToRead, &attributes[0]);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_attr");
+    }
+
+    for(int iElem=0 ; iElem<numElemToRead ; ++iElem, ++myLocalElem){
+      myElemType[myLocalElem] = exodusElementType;
+      myElemBlockId[myLocalElem] = elemBlockId;
+      for(int i=0 ; i<numNodesPerElem ; ++i)
+        myConn.push_back(conn[iElem*numNodesPerElem + i] - 1); // Note the switch from 1-based indexing to 0-based indexing
+      myElemConnOffset[myLocalElem+1] = static_cast<int>(myConn.size());
+      // The second attribute is the sphere volume
+      if(exodusElementType == SPHERE_ELEMENT)
+        mySphereVolume[myLocalElem] = attributes[iElem*numAttributes + 1];
+    }
+  }
+
+  // Each processor reads a contiguous chunk of the node coordinates, [myFirstLinearNode, myFirstLinearNode + myNumLinearNodes)
+  // The coordinates are then imported by the processors whose elements reference the nodes
+  Epetra_Map linearNodeMap(numNodes, 0, *comm);
+  int myFirstLinearNode = linearNodeMap.MinMyGID();
+  int myNumLinearNodes = linearNodeMap.NumMyElements();
+  Epetra_MultiVector linearNodeCoordinates(linearNodeMap, 3);
+  if(myNumLinearNodes > 0){
+    retval = ex_get_partial_coord(exodusFileId, myFirstLinearNode + 1, myNumLinearNodes, linearNodeCoordinates[0], linearNodeCoordinates[1], linearNodeCoordinates[2]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_coord");
+  }
+
+  // The nodes referenced by this processor's elements
+  vector<int> myNodes(myConn);
+  sort(myNodes.begin(), myNodes.end());
+  myNodes.erase(unique(myNodes.begin(), myNodes.end()), myNodes.end());
+  int myNumNodes = static_cast<int>(myNodes.size());
+  Epetra_Map myNodeMap(-1, myNumNodes, myNodes.data(), 0, *comm);
+  Epetra_Import nodeImporter(myNodeMap, linearNodeMap);
+  Epetra_MultiVector exodusNodeCoordinates(myNodeMap, 3);
+  exodusNodeCoordinates.Import(linearNodeCoordinates, nodeImporter, Insert);
+  for(unsigned int i=0 ; i<myConn.size() ; ++i)
+    myConn[i] = myNodeMap.LID(myConn[i]); // Note the switch from global to local node ids
+
+  // Convert elements to spheres
+  QUICKGRID::Data decomp = QUICKGRID::allocatePdGridData(myNumElem, 3);
+  decomp.globalNumPoints = numElem;
+  int* decompGlobalIds = decomp.myGlobalIDs.get();
+  double* decompX = decomp.myX.get();
+  double* decompVolume = decomp.cellVolume.get();
+  vector<double> nodeCoordinates;
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem){
+    int numNodesPerElem = myElemConnOffset[iElem+1] - myElemConnOffset[iElem];
+    nodeCoordinates.resize(3*numNodesPerElem);
+    for(int i=0 ; i<numNodesPerElem ; ++i){
+      int nodeId = myConn[myElemConnOffset[iElem] + i];
+      nodeCoordinates[3*i] = exodusNodeCoordinates[0][nodeId];
+      nodeCoordinates[3*i+1] = exodusNodeCoordinates[1][nodeId];
+      nodeCoordinates[3*i+2] = exodusNodeCoordinates[2][nodeId];
+    }
+    double volume(0.0);
+    double* coord = &decompX[3*iElem];
+    if(myElemType[iElem] == SPHERE_ELEMENT){
+      coord[0] = nodeCoordinates[0];
+      coord[1] = nodeCoordinates[1];
+      coord[2] = nodeCoordinates[2];
+      volume = mySphereVolume[iElem];
+    }
+    else if(myElemType[iElem] == TET_ELEMENT){
+      tetCentroidAndVolume(&nodeCoordinates[0], coord, &volume);
+    }
+    else if(myElemType[iElem] == HEX_ELEMENT){
+      hexCentroidAndVolume(&nodeCoordinates[0], coord, &volume);
+    }
+    decompGlobalIds[iElem] = elemIdMap[iElem];
+    decompVolume[iElem] = volume;
+  }
+
+  // Node sets are converted to the sphere mesh by flagging each element that contains a node in the set
+  // The flags are stored in a multivector so that they follow the elements through the load balancing step
+  nodeSets = Teuchos::rcp< map<string, vector<int> > >(new map<string, vector<int> >() );
+  nodeSetIds = Teuchos::rcp< map<string, int> >(new map<string, int>() );
+  vector<int> exodusNodeSetIds(numNodeSets);
+  vector<string> nodeSetNames(numNodeSets);
+  if(numNodeSets > 0){
+    retval = ex_get_node_set_ids(exodusFileId, &exodusNodeSetIds[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_node_set_ids");
+  }
+  for(int i=0 ; i<numNodeSets ; ++i){
+    int nodeSetId = exodusNodeSetIds[i];
+    char exodusNodeSetName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_NODE_SET, nodeSetId, exodusNodeSetName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_name");
+    string nodeSetName(exodusNodeSetName);
+    if(nodeSetName.size() == 0){
+      stringstream ss;
+      ss << "nodelist_" << nodeSetId;
+      nodeSetName = ss.str();
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) != nodeSets->end(), "**** Duplicate node set found: " + nodeSetName + "\n");
+    (*nodeSets)[nodeSetName] = vector<int>();
+    (*nodeSetIds)[nodeSetName] = nodeSetId;
+    nodeSetNames[i] = nodeSetName;
+  }
+
+  // For each node referenced by this processor's elements, record the (local) elements that it belongs to
+  vector< vector<int> > elementsThatNodeBelongsTo(myNumNodes);
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem){
+    for(int i=myElemConnOffset[iElem] ; i<myElemConnOffset[iElem+1] ; ++i)
+      elementsThatNodeBelongsTo[myConn[i]].push_back(iElem);
+  }
+
+  Epetra_BlockMap tempOneDimensionalMap(numElem, myNumElem, elemIdMap.data(), 1, 0, *comm);
+  Epetra_Vector tempBlockID(tempOneDimensionalMap);
+  for(int iElem=0 ; iElem<myNumElem ; ++iElem)
+    tempBlockID[iElem] = myElemBlockId[iElem];
+  Epetra_MultiVector tempNodeSetFlags(tempOneDimensionalMap, max(numNodeSets, 1));
+  if(numNodeSets > 0){
+
+    // Each processor reads a contiguous slice of each node set
+    vector<int> sliceNodes, sliceNodeSets;
+    for(int iSet=0 ; iSet<numNodeSets ; ++iSet){
+      int numNodesInSet, numDistributionFactorsInSet;
+      retval = ex_get_node_set_param(exodusFileId, exodusNodeSetIds[iSet], &numNodesInSet, &numDistributionFactorsInSet);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_node_set_param");
+      int mySliceFirst = static_cast<int>( (static_cast<long long>(numNodesInSet) * myPID) / numPID );
+      int mySliceLast = static_cast<int>( (static_cast<long long>(numNodesInSet) * (myPID + 1)) / numPID );
+      int mySliceSize = mySliceLast - mySliceFirst;
+      if(mySliceSize > 0){
+        vector<int> nodeSetNodeList(mySliceSize);
+        retval = ex_get_partial_set(exodusFileId, EX_NODE_SET, exodusNodeSetIds[iSet], mySliceFirst + 1, mySliceSize, &nodeSetNodeList[0], NULL);
+        if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_get_partial_set");
+        for(int i=0 ; i<mySliceSize ; ++i){
+          sliceNodes.push_back(nodeSetNodeList[i] - 1); // Note the switch from 1-based indexing to 0-based indexing
+          sliceNodeSets.push_back(iSet);
+        }
+      }
+    }
+
+    // Flag the nodes of the slices on the linear node map, and then import the flags for the nodes referenced by this processor's elements
+    vector<int> uniqueSliceNodes(sliceNodes);
+    sort(uniqueSliceNodes.begin(), uniqueSliceNodes.end());
+    uniqueSliceNodes.erase(unique(uniqueSliceNodes.begin(), uniqueSliceNodes.end()), uniqueSliceNodes.end());
+    Epetra_Map sliceNodeMap(-1, static_cast<int>(uniqueSliceNodes.size()), uniqueSliceNodes.data(), 0, *comm);
+    Epetra_MultiVector sliceNodeSetFlags(sliceNodeMap, numNodeSets);
+    for(unsigned int i=0 ; i<sliceNodes.size() ; ++i)
+      sliceNodeSetFlags[sliceNodeSets[i]][sliceNodeMap.LID(sliceNodes[i])] = 1.0;
+    Epetra_MultiVector linearNodeSetFlags(linearNodeMap, numNodeSets);
+    Epetra_Export sliceExporter(sliceNodeMap, linearNodeMap);
+    linearNodeSetFlags.Export(sliceNodeSetFlags, sliceExporter, Add);
+    Epetra_MultiVector myNodeSetFlags(myNodeMap, numNodeSets);
+    myNodeSetFlags.Import(linearNodeSetFlags, nodeImporter, Insert);
+
+    // Keep the flagged nodes that belong to this processor's elements
+    for(int iSet=0 ; iSet<numNodeSets ; ++iSet){
+      double* flags = tempNodeSetFlags[iSet];
+      for(int node=0 ; node<myNumNodes ; ++node){
+        if(myNodeSetFlags[iSet][node] == 0.0)
+          continue;
+        const vector<int>& elements = elementsThatNodeBelongsTo[node];
+        for(unsigned int j=0 ; j<elements.size() ; ++j)
+          flags[elements[j]] = 1.0;
+      }
+    }
+  }
+
+  if(verbose && myPID == 0){
+    stringstream ss;
+    ss << "\nGenesis file " << meshFileName << " (parallel read)" << endl;
+    ss << "  title " << title << endl;
+    ss << "  number of dimensions " << numDim << endl;
+    ss << "  number of nodes " << numNodes << endl;
+    ss << "  number of elements " << numElem << endl;
+    ss << "  number of blocks " << numElemBlocks << endl;
+    ss << "  number of node sets " << numNodeSets << endl;
+    ss << "  number of side sets (ignored) " << numSideSets << endl;
+    cout << ss.str() << endl;
+  }
+
+  retval = ex_close(exodusFileId);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadDataParallel()", "ex_close");
+
+  // Load balance the sphere mesh
+  decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+
+  // Create the owned maps
+  oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numElem, decomp.numPoints, decomp.myGlobalIDs.get(), 1, 0, *comm));
+  threeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numElem, decomp.numPoints, decomp.myGlobalIDs.get(), 3, 0, *comm));
+
+  // Create Epetra_Vectors for the initial positions, volumes, and block_ids in the load balanced configuration
+  initialX = Teuchos::rcp(new Epetra_Vector(Copy, *threeDimensionalMap, decomp.myX.get()));
+  cellVolume = Teuchos::rcp(new Epetra_Vector(Copy, *oneDimensionalMap, decomp.cellVolume.get()));
+  blockID = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  Epetra_Import importer(*oneDimensionalMap, tempOneDimensionalMap);
+  blockID->Import(tempBlockID, importer, Insert);
+  Epetra_MultiVector nodeSetFlags(*oneDimensionalMap, tempNodeSetFlags.NumVectors());
+  nodeSetFlags.Import(tempNodeSetFlags, importer, Insert);
+
+  // Create the element list for each block and each node set
+  for(int i=0 ; i<oneDimensionalMap->NumMyElements() ; ++i){
+    int globalId = oneDimensionalMap->GID(i);
+    int elemBlockId = static_cast<int>( (*blockID)[i] );
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(blockIdToName.find(elemBlockId) == blockIdToName.end(),
+                                "\n**** Error in ExodusDiscretization::loadDataParallel(), invalid block id.\n");
+    (*elementBlocks)[blockIdToName[elemBlockId]].push_back(globalId);
+    for(int iSet=0 ; iSet<numNodeSets ; ++iSet){
+      if(nodeSetFlags[iSet][i] != 0.0)
+        (*nodeSets)[nodeSetNames[iSet]].push_back(globalId);
+    }
+  }
+}
+
 void
 PeridigmNS::ExodusDiscretization::constructInterfaceData()
 {
@@ -136,6 +136,9 @@ namespace PeridigmNS {
     //! Loads mesh data into Epetra_Vectors (initial positions, volumes, block ids) and stores original Exodus node locations and connectivity.
     void loadData(const std::string& meshFileName);
 
+    //! Loads a contiguous slice of the elements in a single (undecomposed) mesh file on each processor and load balances the result.
+    void loadDataParallel(const std::string& meshFileName);
+
   protected:
 
     template<class T>
@@ -206,6 +209,9 @@ namespace PeridigmNS {
     //! Boolean flag indicating that element-horizon intersections should be computed
     bool computeIntersections;
 
+    //! Boolean flag indicating that all processors read a single mesh file in parallel
+    bool parallelRead;
+
     //! Maximum element dimension of the original exodus mesh
     double maxElementDimension;
 
@@ -0,0 +1,113 @@
+/*! \file Peridigm_MappedFile.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_MAPPEDFILE_HPP
+#define PERIDIGM_MAPPEDFILE_HPP
+
+#include <Teuchos_Assert.hpp>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace PeridigmNS {
+
+  //! Read-only memory mapping of a file, which is unmapped when the object goes out of scope (including when a reader throws).
+  class MappedFile {
+
+  public:
+
+    //! Maps the file; throws if it cannot be opened or mapped.  An empty file is not mapped.  The description is used in error messages.
+    MappedFile(const std::string& fileName, const std::string& description)
+      : mapping(MAP_FAILED), fileSize(0)
+    {
+      int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(fileDescriptor < 0, "**** Error opening " + description + ".\n");
+      struct stat fileStatus;
+      int statResult = fstat(fileDescriptor, &fileStatus);
+      if(statResult == 0){
+        fileSize = static_cast<size_t>(fileStatus.st_size);
+        if(fileSize > 0)
+          mapping = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+      }
+      close(fileDescriptor);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(statResult != 0, "**** Error reading size of " + description + ".\n");
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(fileSize > 0 && mapping == MAP_FAILED, "**** Error memory-mapping " + description + ".\n");
+    }
+
+    ~MappedFile(){
+      if(mapping != MAP_FAILED)
+        munmap(mapping, fileSize);
+    }
+
+    //! Start of the mapped file, or null for an empty file.
+    const char* data() const { return mapping == MAP_FAILED ? 0 : static_cast<const char*>(mapping); }
+
+    //! Size of the file in bytes.
+    size_t size() const { return fileSize; }
+
+    //! Tells the kernel that the file will be read front to back.
+    void adviseSequential() const {
+      if(mapping != MAP_FAILED)
+        madvise(mapping, fileSize, MADV_SEQUENTIAL);
+    }
+
+  private:
+
+    //! Private to prohibit copying
+    MappedFile(const MappedFile&);
+
+    //! Private to prohibit copying
+    MappedFile& operator=(const MappedFile&);
+
+    void* mapping;
+    size_t fileSize;
+  };
+}
+
+#endif // PERIDIGM_MAPPEDFILE_HPP
@@ -48,15 +48,12 @@
 #ifndef PERIDIGM_TEXTFILEDISCRETIZATION_HPP
 #define PERIDIGM_TEXTFILEDISCRETIZATION_HPP
 
-#include "Peridigm_Discretization.hpp"
-#include <Teuchos_ParameterList.hpp>
-#include <Epetra_Comm.h>
-#include "QuickGridData.h"
+#include "Peridigm_PointCloudDiscretization.hpp"
 
 namespace PeridigmNS {
 
   //! Discretization class that creates discretization from a text file containing node locations, volumes, and block ids.
-  class TextFileDiscretization : public PeridigmNS::Discretization {
+  class TextFileDiscretization : public PeridigmNS::PointCloudDiscretization {
 
   public:
 
@@ -67,54 +64,6 @@ namespace PeridigmNS {
     //! Destructor
     virtual ~TextFileDiscretization();
 
-    //! Return d-dimensional map
-    virtual Teuchos::RCP<const Epetra_BlockMap> getGlobalOwnedMap(int d) const;
-
-    //! Return d-dimensional overlap map (includes ghosts)
-    virtual Teuchos::RCP<const Epetra_BlockMap> getGlobalOverlapMap(int d) const;
-
-    //! Bond map, used for constitutive data stored on each bond. This is a non-overlapping map.
-    virtual Teuchos::RCP<const Epetra_BlockMap> getGlobalBondMap() const;
-
-    //! Get initial positions
-    virtual Teuchos::RCP<Epetra_Vector> getInitialX() const;
-
-    //! Get the horizon value for each point.
-    virtual Teuchos::RCP<Epetra_Vector> getHorizon() const;
-
-    //! Get cell volumes
-    virtual Teuchos::RCP<Epetra_Vector> getCellVolume() const;
-
-    //! Get a vector containing the block ID of each element
-    virtual Teuchos::RCP<Epetra_Vector> getBlockID() const;
-
-    //! Get the neighbor list for all locally-owned nodes
-    virtual Teuchos::RCP<PeridigmNS::NeighborhoodData> getNeighborhoodData() const;
-
-    //! Get interface data for all locally-owned nodes
-    virtual Teuchos::RCP<PeridigmNS::InterfaceData> getInterfaceData() const{return Teuchos::null;}
-
-    //! determine if interface data was constructed
-    virtual bool InterfacesAreConstructed() const{return false;}
-
-    //! Get the number of bonds on this processor
-    virtual unsigned int getNumBonds() const;
-
-    //! Get the number of elems on this processor
-    virtual unsigned int getNumElem() const {return oneDimensionalMap->NumMyElements();}
-
-    //! Get the maximum number of bonds per element on this processor
-    virtual unsigned int getMaxNumBondsPerElem() const;
-
-    //! Get the minimum element radius in the model (used for example for determining magnitude of finite-difference probe).
-    virtual double getMinElementRadius() const { return minElementRadius; }
-
-    //! Get the maximum element radius in the model (used for example for determining magnitude of finite-difference probe).
-    virtual double getMaxElementRadius() const { return maxElementRadius; }
-
-    //! Get the maximum element dimension (for example the diagonal of a hex element, used for partial volume neighbor search).
-    virtual double getMaxElementDimension() const { return maxElementDimension; }
-
   private:
 
     //! Private to prohibit copying
@@ -123,77 +72,11 @@ namespace PeridigmNS {
     //! Private to prohibit copying
     TextFileDiscretization& operator=(const TextFileDiscretization&);
 
-    //! Creates a discretization object based on data read from a text file.
-    QUICKGRID::Data getDecomp(const std::string& textFileName,
-                              const Teuchos::RCP<Teuchos::ParameterList>& params);
-
-  protected:
-
-    template<class T>
-    struct NonDeleter{
-      void operator()(T* d) {}
-    };
-
-    //! Create maps
-    void createMaps(const QUICKGRID::Data& decomp);
-
-    //! Create vectors
-    void createVectors();
-
-    //! Create NeighborhoodData
-    void createNeighborhoodData(const QUICKGRID::Data& decomp);
-
-    //! Filter bonds from neighborhood list
-    Teuchos::RCP<PeridigmNS::NeighborhoodData> filterBonds(Teuchos::RCP<PeridigmNS::NeighborhoodData> unfilteredNeighborhoodData);
-
-    //! Maps
-    Teuchos::RCP<Epetra_BlockMap> oneDimensionalMap;
-    Teuchos::RCP<Epetra_BlockMap> oneDimensionalOverlapMap;
-    Teuchos::RCP<Epetra_BlockMap> threeDimensionalMap;
-    Teuchos::RCP<Epetra_BlockMap> threeDimensionalOverlapMap;
-    Teuchos::RCP<Epetra_BlockMap> bondMap;
-
-    //! Minimum element radius
-    double minElementRadius;
-
-    //! Maximum element radius
-    double maxElementRadius;
-
-    //! Maximum element dimension
-    double maxElementDimension;
-
-    //! Vector containing initial positions
-    Teuchos::RCP<Epetra_Vector> initialX;
-
-    //! Vector containing horizons
-    Teuchos::RCP<Epetra_Vector> horizonForEachPoint;
-
-    //! Vector containing cell volumes
-    Teuchos::RCP<Epetra_Vector> cellVolume;
-
-    //! Vector containing the block ID of each element
-    Teuchos::RCP<Epetra_Vector> blockID;
-
-    //! Struct containing neighborhoods for owned nodes.
-    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData;
-
-    //! Returns number of bonds on this processor
-    unsigned int numBonds;
-
-    //! Returns the max number of bonds per element on this processor
-    unsigned int maxNumBondsPerElem;
-
-    //! Processor ID
-    int myPID;
-
-    //! Number of Processors
-    int numPID;
-
-    //! Discretization parameter controling the formation of bonds
-    std::string bondFilterCommand;
-
-    //! Epetra communicator
-    Teuchos::RCP<const Epetra_Comm> comm;
+    //! Memory-maps the text file and parses the lines that begin within this processor's share of the file.
+    void readTextFile(const std::string& textFileName,
+                      std::vector<double>& coordinates,
+                      std::vector<double>& volumes,
+                      std::vector<int>& blockIds);
   };
 }
 
@@ -7,6 +7,9 @@
 #include <malloc.h>
 #endif
 #include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
 #include <vector>
 
 #include <Teuchos_CommHelpers.hpp>
@@ -30,12 +33,18 @@ PeridigmNS::Memstat * PeridigmNS::Memstat::Instance()
 
 void PeridigmNS::Memstat::addStat(const std::string & description){
 
-  size_t heap_size = 0;
+  long long heap_size = 0;
 
 #if defined(__GNUC__) && defined(__linux__)
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  // mallinfo2 reports size_t values; the int fields of mallinfo overflow above 2 GB
+  struct mallinfo2 minfo = mallinfo2();
+  heap_size = (long long) minfo.uordblks + (long long) minfo.hblkhd;
+#else
   static struct mallinfo minfo;
   minfo = mallinfo();
-  heap_size = minfo.uordblks + minfo.hblkhd;
+  heap_size = (long long) (unsigned int) minfo.uordblks + (long long) (unsigned int) minfo.hblkhd;
+#endif
 
 #elif defined(__APPLE__)
   malloc_statistics_t t = {0,0,0,0};
@@ -44,66 +53,130 @@ void PeridigmNS::Memstat::addStat(const std::string & description){
 
 #endif
 
-//  static struct mallinfo minfo;
-//  minfo = mallinfo();
-//  size_t heap_size = (unsigned int) minfo.uordblks + (unsigned int) minfo.hblkhd;
+  long long rss = residentSetSize();
 
   // if the descriptor already exists, update it if the memory use is higher
-  std::map<std::string, unsigned int>::iterator it = stats.find(description);
+  std::map<std::string, Stat>::iterator it = stats.find(description);
   if (it != stats.end()){
-    if(heap_size > it->second)
-      it->second = heap_size;
+    if(heap_size > it->second.heap)
+      it->second.heap = heap_size;
+    if(rss > it->second.rss)
+      it->second.rss = rss;
   }
   // otherwise create a new entry
-  else
-    stats.insert(std::pair<std::string,unsigned int>(description,heap_size));
+  else{
+    Stat stat;
+    stat.heap = heap_size;
+    stat.rss = rss;
+    stats.insert(std::pair<std::string,Stat>(description,stat));
+  }
 }
 
-void PeridigmNS::Memstat::printStats(){
+void PeridigmNS::Memstat::setSubsystemBytes(const std::string & subsystem, long long bytes){
+  subsystemBytes[subsystem] = bytes;
+}
 
-    if(myComm->NumProc()== 1){
-      if(myComm->MyPID() == 0){
-      cout << "Memory Usage (Heap Alloc MB):\n";
-      //cout << "  " << left << setw(30) << "Checkpoint Description" << right << setw(12) << "Heap Alloc" << "\n";
-      for(std::map<std::string,unsigned int>::iterator it=stats.begin();it!=stats.end();++it){
+namespace {
+  //! Returns the value (in bytes) of the given field of /proc/self/status, or zero if it is unavailable
+  long long procStatusBytes(const std::string & field){
+    long long bytes = 0;
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while(std::getline(status, line)){
+      if(line.compare(0, field.size(), field) == 0 && line.size() > field.size() && line[field.size()] == ':'){
+        std::istringstream iss(line.substr(field.size() + 1));
+        long long kilobytes = 0;
+        iss >> kilobytes;
+        bytes = 1024*kilobytes;
+        break;
+      }
+    }
+    return bytes;
+  }
+}
+
+long long PeridigmNS::Memstat::residentSetSize(){
+  return procStatusBytes("VmRSS");
+}
+
+long long PeridigmNS::Memstat::peakResidentSetSize(){
+  return procStatusBytes("VmHWM");
+}
+
+void PeridigmNS::Memstat::printTable(const std::string & title, const std::vector<std::string> & names, const std::vector<double> & values){
+
+  int count = (int)( values.size() );
+  if(count == 0)
+    return;
+
+  if(myComm->NumProc()== 1){
+    if(myComm->MyPID() == 0){
+      cout << title << "\n";
+      for(int i=0 ; i<count ; ++i){
         // if the name is long, trim it:
-        std::string desc = it->first;
+        std::string desc = names[i];
         if(desc.length() > 25) desc.resize(25);
-        cout << "  " << left << setw(30) <<  desc << right << setw(12) << (double)it->second / (1024.0 * 1024.0) << "\n";
+        cout << "  " << left << setw(30) <<  desc << right << setw(12) << values[i] / (1024.0 * 1024.0) << "\n";
       }
       cout << "\n";
-      }
     }
-    else{
-      int count = (int)( stats.size() );
-      vector<std::string> names(count);
-      vector<double> times(count);
-      vector<double> minTimes(count);
-      vector<double> maxTimes(count);
-      vector<double> totalTimes(count);
-      int i = 0;
-      for(map<std::string, unsigned int>::reverse_iterator it=stats.rbegin() ; it!=stats.rend() ; it++){
-        std::string desc = it->first; // truncate the name if its too long
-        if(desc.length() > 25) desc.resize(25);
-        names[i] = desc;
-        times[i] = it->second;
-        i++;
-      }
-      Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
-      if(myComm->MyPID() == 0){
-
-      cout << "Memory Usage (Heap Alloc MB):\n";
-
+  }
+  else{
+    vector<double> minValues(count);
+    vector<double> maxValues(count);
+    vector<double> totalValues(count);
+    Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&values[0], &minValues[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&values[0], &maxValues[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&values[0], &totalValues[0]);
+    if(myComm->MyPID() == 0){
+      cout << title << "\n";
       cout << "  " << left << setw(30) << " " << right << setw(12) << "Min" << right << setw(15) << "Max" << right << setw(15) << "Ave" << endl;
-      for(unsigned int i=0 ; i<names.size() ; ++i){
-        cout << "  " << left << setw(30) << names[i] << right << setw(12) << minTimes[i] / (1024.0 * 1024.0)
-                                                     << right << setw(15) << maxTimes[i]/ (1024.0 * 1024.0)
-                                                     << right << setw(15) << (totalTimes[i]/myComm->NumProc()) / (1024.0 * 1024.0)<< "\n";
+      for(int i=0 ; i<count ; ++i){
+        std::string desc = names[i]; // truncate the name if its too long
+        if(desc.length() > 25) desc.resize(25);
+        cout << "  " << left << setw(30) << desc << right << setw(12) << minValues[i] / (1024.0 * 1024.0)
+                                                << right << setw(15) << maxValues[i]/ (1024.0 * 1024.0)
+                                                << right << setw(15) << (totalValues[i]/myComm->NumProc()) / (1024.0 * 1024.0)<< "\n";
       }
       cout << "\n";
-      }
     }
+  }
+}
+
+void PeridigmNS::Memstat::printStats(){
+
+  vector<std::string> names;
+  vector<double> heapValues;
+  vector<double> rssValues;
+  for(std::map<std::string, Stat>::iterator it=stats.begin() ; it!=stats.end() ; ++it){
+    names.push_back(it->first);
+    heapValues.push_back( (double) it->second.heap );
+    rssValues.push_back( (double) it->second.rss );
+  }
+  printTable("Memory Usage (Heap Alloc MB):", names, heapValues);
+
+  // Resident set size at each checkpoint, followed by the current value and the high-water mark
+  long long peakRss = peakResidentSetSize();
+  if(peakRss > 0){
+    names.push_back("Current");
+    rssValues.push_back( (double) residentSetSize() );
+    names.push_back("Peak");
+    rssValues.push_back( (double) peakRss );
+    printTable("Memory Usage (Resident Set MB):", names, rssValues);
+  }
+
+  names.clear();
+  vector<double> subsystemValues;
+  double totalSubsystemBytes = 0.0;
+  for(std::map<std::string, long long>::iterator it=subsystemBytes.begin() ; it!=subsystemBytes.end() ; ++it){
+    names.push_back(it->first);
+    subsystemValues.push_back( (double) it->second );
+    totalSubsystemBytes += it->second;
+  }
+  if(!subsystemValues.empty()){
+    names.push_back("Total");
+    subsystemValues.push_back(totalSubsystemBytes);
+  }
+  printTable("Memory Usage (Subsystems MB):", names, subsystemValues);
 }
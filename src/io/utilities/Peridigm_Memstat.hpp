@@ -49,6 +49,7 @@
 #define PERIDIGM_MEMSTAT_HPP
 
 #include <string>
+#include <vector>
 #include <map>
 #include <Teuchos_RCP.hpp>
 #include <Epetra_MpiComm.h>
@@ -57,6 +58,9 @@
 // This is a very simple class that keeps track of memory use at selected
 // points in the code that are usually associated with large allocations
 // (i.e. allocating the jacobian, or performing the neighborhood search)
+// In addition to the heap allocation, the resident set size and its high-water
+// mark are recorded (Linux only), and subsystems may register the number of bytes
+// they hold so that memory use can be attributed.
 // For more sophisticated profiling, the user should use a tool like valgrind.
 
 namespace PeridigmNS {
@@ -80,9 +84,18 @@ public:
   //! Add a memory stat and catagory to the list
   void addStat(const std::string & description);
 
+  //! Set the number of bytes currently held by a subsystem
+  void setSubsystemBytes(const std::string & subsystem, long long bytes);
+
   //! Print out the stats
   void printStats();
 
+  //! Current resident set size in bytes (zero if unavailable)
+  static long long residentSetSize();
+
+  //! High-water mark of the resident set size in bytes (zero if unavailable)
+  static long long peakResidentSetSize();
+
 private:
 
   //! Constructor
@@ -94,8 +107,21 @@ private:
   Memstat& operator=(const Memstat&);
   //@}  
 
+  //! Reduce the given values over all processors and print the min, max, and average (in MB)
+  void printTable(const std::string & title, const std::vector<std::string> & names, const std::vector<double> & values);
+
+  //! Memory use recorded at a checkpoint
+  struct Stat {
+    Stat() : heap(0), rss(0) {}
+    long long heap;
+    long long rss;
+  };
+
   //! Map that associates a description with a stat
-  std::map<std::string, unsigned int> stats;
+  std::map<std::string, Stat> stats;
+
+  //! Map that associates a subsystem with the number of bytes it holds
+  std::map<std::string, long long> subsystemBytes;
 
   static Memstat * myMemstatPtr;
   static Teuchos::RCP<const Epetra_Comm> myComm;
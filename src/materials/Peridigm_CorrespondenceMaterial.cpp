@@ -50,6 +50,7 @@
 #include "elastic.h"
 #include "correspondence.h"
 #include <Teuchos_Assert.hpp>
+#include <algorithm>
 
 using namespace std;
 
@@ -167,15 +168,15 @@ PeridigmNS::CorrespondenceMaterial::initialize(const double dt,
   dataManager.getData(m_shapeTensorInverseFieldId, PeridigmField::STEP_NONE)->ExtractView(&shapeTensorInverse);
   dataManager.getData(m_deformationGradientFieldId, PeridigmField::STEP_NONE)->ExtractView(&deformationGradient);
 
+  // The shape tensor depends only on the reference configuration, so its inverse is
+  // computed here once and reused by computeForce() on every step.
   int shapeTensorReturnCode = 
-    CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(volume,
-                                                                               horizon,
-                                                                               modelCoordinates,
-                                                                               coordinates,
-                                                                               shapeTensorInverse,
-                                                                               deformationGradient,
-                                                                               neighborhoodList,
-                                                                               numOwnedPoints);
+    CORRESPONDENCE::computeShapeTensorInverse(volume,
+                                              horizon,
+                                              modelCoordinates,
+                                              shapeTensorInverse,
+                                              neighborhoodList,
+                                              numOwnedPoints);
 
   string shapeTensorErrorMessage =
     "**** Error:  CorrespondenceMaterial::initialize() failed to compute shape tensor.\n";
@@ -183,6 +184,15 @@ PeridigmNS::CorrespondenceMaterial::initialize(const double dt,
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
   TEUCHOS_TEST_FOR_EXCEPT_MSG(shapeTensorReturnCode != 0, shapeTensorErrorMessage);
 
+  CORRESPONDENCE::computeApproximateDeformationGradient(volume,
+                                                        horizon,
+                                                        modelCoordinates,
+                                                        coordinates,
+                                                        shapeTensorInverse,
+                                                        deformationGradient,
+                                                        neighborhoodList,
+                                                        numOwnedPoints);
+
 }
 
 void
@@ -205,24 +215,18 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_shapeTensorInverseFieldId, PeridigmField::STEP_NONE)->ExtractView(&shapeTensorInverse);
   dataManager.getData(m_deformationGradientFieldId, PeridigmField::STEP_NONE)->ExtractView(&deformationGradient);
   
-  // Compute the inverse of the shape tensor and the approximate deformation gradient
+  // Compute the approximate deformation gradient using the inverse of the shape tensor
+  // stored in initialize().
   // The approximate deformation gradient will be used by the derived class (specific correspondence material model)
   // to compute the Cauchy stress.
-  // The inverse of the shape tensor is stored for later use after the Cauchy stress calculation
-  int shapeTensorReturnCode = 
-    CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(volume,
-                                                                               horizon,
-                                                                               modelCoordinates,
-                                                                               coordinates,
-                                                                               shapeTensorInverse,
-                                                                               deformationGradient,
-                                                                               neighborhoodList,
-                                                                               numOwnedPoints);
-  string shapeTensorErrorMessage =
-    "**** Error:  CorrespondenceMaterial::computeForce() failed to compute shape tensor.\n";
-  shapeTensorErrorMessage +=
-    "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(shapeTensorReturnCode != 0, shapeTensorErrorMessage);
+  CORRESPONDENCE::computeApproximateDeformationGradient(volume,
+                                                        horizon,
+                                                        modelCoordinates,
+                                                        coordinates,
+                                                        shapeTensorInverse,
+                                                        deformationGradient,
+                                                        neighborhoodList,
+                                                        numOwnedPoints);
 
   double *leftStretchTensorN, *leftStretchTensorNP1, *rotationTensorN, *rotationTensorNP1, *unrotatedRateOfDeformation;
   dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_N)->ExtractView(&leftStretchTensorN);
@@ -286,13 +290,10 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
 
   double *delta = horizon;
-  double* stress = cauchyStressNP1;
-  double* shapeTensorInv = shapeTensorInverse;
-  double* defGrad = deformationGradient;
 
   double *modelCoordinatesPtr, *neighborModelCoordinatesPtr, *forceDensityPtr, *neighborForceDensityPtr, *partialStressPtr;
   double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  double TX, TY, TZ, omega, vol, neighborVol, jacobianDeterminant;
+  double TX, TY, TZ, omega, vol, neighborVol;
   int numNeighbors, neighborIndex;
 
   string matrixInversionErrorMessage =
@@ -300,28 +301,30 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   matrixInversionErrorMessage +=
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
 
-  vector<double> defGradInvVector(9), piolaStressVector(9), tempVector(9);
-  double* defGradInv = &defGradInvVector[0];
-  double* piolaStress = &piolaStressVector[0];
-  double* temp = &tempVector[0];
+  // Products of the first Piola-Kirchhoff stress and the shape tensor inverse, computed
+  // for one batch of points at a time with the batched tensor kernels
+  const int batchSize = CORRESPONDENCE::TENSOR_BATCH_SIZE;
+  vector<double> tempVector(9*batchSize);
+  double* temp;
 
   // Loop over the material points and convert the Cauchy stress into pairwise peridynamic force densities
   const int *neighborListPtr = neighborhoodList;
-  for(int iID=0 ; iID<numOwnedPoints ; ++iID, 
-          ++delta, defGrad+=9, stress+=9, shapeTensorInv+=9){
-
-    // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
-
-    // Invert the deformation gradient and store the determinant
-    int matrixInversionReturnCode =
-      CORRESPONDENCE::Invert3by3Matrix(defGrad, jacobianDeterminant, defGradInv);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(matrixInversionReturnCode != 0, matrixInversionErrorMessage);
-    
-    //P = J * \sigma * F^(-T)
-    CORRESPONDENCE::MatrixMultiply(false, true, jacobianDeterminant, stress, defGradInv, piolaStress);
-
-    // Inner product of Piola stress and the inverse of the shape tensor
-    CORRESPONDENCE::MatrixMultiply(false, false, 1.0, piolaStress, shapeTensorInv, temp);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID, ++delta){
+
+    if(iID%batchSize == 0){
+
+      // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
+      // temp = first Piola-Kirchhoff stress * shapeTensor^-1
+      int numBatchPoints = std::min(batchSize, numOwnedPoints - iID);
+      int matrixInversionReturnCode =
+        CORRESPONDENCE::computeFirstPiolaKirchhoffStressShapeTensorInverseProduct(deformationGradient + 9*iID,
+                                                                                  cauchyStressNP1 + 9*iID,
+                                                                                  shapeTensorInverse + 9*iID,
+                                                                                  &tempVector[0],
+                                                                                  numBatchPoints);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(matrixInversionReturnCode != 0, matrixInversionErrorMessage);
+    }
+    temp = &tempVector[9*(iID%batchSize)];
 
     // Loop over the neighbors and compute contribution to force densities
     modelCoordinatesPtr = modelCoordinates + 3*iID;
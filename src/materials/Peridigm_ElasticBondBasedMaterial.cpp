@@ -52,7 +52,7 @@
 
 PeridigmNS::ElasticBondBasedMaterial::ElasticBondBasedMaterial(const Teuchos::ParameterList& params)
   : Material(params),
-    m_bulkModulus(0.0), m_density(0.0), m_horizon(0.0), m_volumeFieldId(-1), m_damageFieldId(-1),
+    m_bulkModulus(0.0), m_density(0.0), m_horizon(0.0), m_applyAnalyticJacobian(true), m_useHalfNeighborList(false), m_finiteDifferenceJacobianActive(false), m_volumeFieldId(-1), m_damageFieldId(-1),
     m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_forceDensityFieldId(-1), m_bondDamageFieldId(-1)
 {
   //! \todo Add meaningful asserts on material properties.
@@ -62,6 +62,16 @@ PeridigmNS::ElasticBondBasedMaterial::ElasticBondBasedMaterial(const Teuchos::Pa
   if(params.isParameter("Young's Modulus") || params.isParameter("Poisson's Ratio") || params.isParameter("Shear Modulus")){
     TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  The Elastic bond based material model supports only one elastic constant, the bulk modulus.");
   }
+  // The bond-based model has no automatic differentiation Jacobian; an explicit request for it
+  // selects the finite-difference Jacobian, as it did before the analytic tangent was the default
+  if(params.isParameter("Apply Automatic Differentiation Jacobian"))
+    m_applyAnalyticJacobian = false;
+  if(params.isParameter("Apply Analytic Jacobian"))
+    m_applyAnalyticJacobian = params.get<bool>("Apply Analytic Jacobian");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_applyAnalyticJacobian && params.isParameter("Apply Automatic Differentiation Jacobian") && params.get<bool>("Apply Automatic Differentiation Jacobian"),
+                              "**** Error:  \"Apply Analytic Jacobian\" and \"Apply Automatic Differentiation Jacobian\" cannot both be true.");
+  if(params.isParameter("Half Neighbor List"))
+    m_useHalfNeighborList = params.get<bool>("Half Neighbor List");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_volumeFieldId                  = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR,      PeridigmField::CONSTANT, "Volume");
@@ -90,6 +100,9 @@ PeridigmNS::ElasticBondBasedMaterial::initialize(const double dt,
                                                  const int* neighborhoodList,
                                                  PeridigmNS::DataManager& dataManager)
 {
+  if(m_useHalfNeighborList){
+    m_halfNeighborList.build(numOwnedPoints, neighborhoodList);
+  }
 }
 
 void
@@ -111,5 +124,87 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
   dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
 
-  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  // The half neighbor list applies to the block neighborhood given to initialize(), and not
+  // to the single-point neighborhoods of the finite-difference Jacobian
+  if(m_useHalfNeighborList && !m_finiteDifferenceJacobianActive){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numOwnedPoints != m_halfNeighborList.NumOwnedPoints(),
+                                "**** Error:  ElasticBondBasedMaterial::computeForce() called with a neighborhood that does not match the half neighbor list; initialize() must be called whenever the neighborhood is replaced.\n");
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBasedHalfNeighborList(x,y,cellVolume,bondDamage,force,m_halfNeighborList.Bonds(),m_halfNeighborList.NumBonds(),m_bulkModulus,m_horizon);
+  }
+  else
+    MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeJacobian(const double dt,
+                                                      const int numOwnedPoints,
+                                                      const int* ownedIDs,
+                                                      const int* neighborhoodList,
+                                                      PeridigmNS::DataManager& dataManager,
+                                                      PeridigmNS::SerialMatrix& jacobian,
+                                                      PeridigmNS::Material::JacobianType jacobianType) const
+{
+  if(m_applyAnalyticJacobian){
+    // Compute the Jacobian from the closed-form tangent
+    computeAnalyticJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+  }
+  else{
+    // Call the base class function, which computes the Jacobian by finite difference
+    m_finiteDifferenceJacobianActive = true;
+    PeridigmNS::Material::computeJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+    m_finiteDifferenceJacobianActive = false;
+  }
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeAnalyticJacobian(const double dt,
+                                                              const int numOwnedPoints,
+                                                              const int* ownedIDs,
+                                                              const int* neighborhoodList,
+                                                              PeridigmNS::DataManager& dataManager,
+                                                              PeridigmNS::SerialMatrix& jacobian,
+                                                              PeridigmNS::Material::JacobianType jacobianType) const
+{
+  // Each bond couples only its two end points, so its 6x6 tangent is summed into the
+  // global tangent matrix directly
+
+  // Extract pointers to the underlying data
+  double *x, *y, *cellVolume, *bondDamage;
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+
+  const Epetra_BlockMap& ownedScalarPointMap = *dataManager.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapScalarPointMap = *dataManager.getOverlapScalarPointMap();
+
+  if(scratchMatrix.Dimension() < 6)
+    scratchMatrix.Resize(6);
+  int globalIndices[6];
+
+  int neighborhoodListIndex = 0;
+  int bondIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int globalID = ownedScalarPointMap.GID(iID);
+    for(int j=0 ; j<3 ; ++j)
+      globalIndices[j] = 3*globalID+j;
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborID = neighborhoodList[neighborhoodListIndex++];
+      int neighborGlobalID = overlapScalarPointMap.GID(neighborID);
+      for(int j=0 ; j<3 ; ++j)
+        globalIndices[3+j] = 3*neighborGlobalID+j;
+
+      MATERIAL_EVALUATION::computeBondTangentStiffnessElasticBondBased(&x[3*iID],&x[3*neighborID],&y[3*iID],&y[3*neighborID],
+                                                                       cellVolume[iID],cellVolume[neighborID],bondDamage[bondIndex++],
+                                                                       scratchMatrix.WritableData(),m_bulkModulus,m_horizon);
+
+      if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+        jacobian.addValues(6, globalIndices, scratchMatrix.Data());
+      else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL)
+        jacobian.addBlockDiagonalValues(6, globalIndices, scratchMatrix.Data());
+      else // unknown jacobian type
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+    }
+  }
 }
@@ -49,6 +49,7 @@
 #define PERIDIGM_ELASTICBONDBASEDMATERIAL_HPP
 
 #include "Peridigm_Material.hpp"
+#include "Peridigm_HalfNeighborList.hpp"
 
 namespace PeridigmNS {
 
@@ -97,6 +98,26 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the jacobian.
+    virtual void
+    computeJacobian(const double dt,
+                    const int numOwnedPoints,
+                    const int* ownedIDs,
+                    const int* neighborhoodList,
+                    PeridigmNS::DataManager& dataManager,
+                    PeridigmNS::SerialMatrix& jacobian,
+                    PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
+    //! Evaluate the jacobian from the closed-form tangent of each bond.
+    virtual void
+    computeAnalyticJacobian(const double dt,
+                            const int numOwnedPoints,
+                            const int* ownedIDs,
+                            const int* neighborhoodList,
+                            PeridigmNS::DataManager& dataManager,
+                            PeridigmNS::SerialMatrix& jacobian,
+                            PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
   protected:
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -110,6 +131,16 @@ namespace PeridigmNS {
     double m_bulkModulus;
     double m_density;
     double m_horizon;
+    bool m_applyAnalyticJacobian;
+
+    //! Evaluate each bond once from a half neighbor list
+    bool m_useHalfNeighborList;
+
+    //! Half neighbor list, rebuilt by each call to initialize() (the block calls initialize() whenever it sets up its neighborhood data)
+    HalfNeighborList m_halfNeighborList;
+
+    //! True while the finite-difference Jacobian evaluates the force on its own single-point neighborhoods
+    mutable bool m_finiteDifferenceJacobianActive;
 
     // field spec ids for all relevant data
     std::vector<int> m_fieldIds;
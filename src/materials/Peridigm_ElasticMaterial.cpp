@@ -48,6 +48,7 @@
 #include "Peridigm_ElasticMaterial.hpp"
 #include "Peridigm_Field.hpp"
 #include "elastic.h"
+#include "neighborhood_fad.h"
 #ifdef PERIDIGM_KOKKOS
   #include "elastic_kokkos.h"
 #endif
@@ -62,6 +63,7 @@ using namespace std;
 PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& params)
   : Material(params),
     m_bulkModulus(0.0), m_shearModulus(0.0), m_density(0.0), m_alpha(0.0), m_horizon(0.0),
+    m_applyAnalyticJacobian(true),
     m_applyAutomaticDifferentiationJacobian(true),
     m_applyThermalStrains(false),
     m_computePartialStress(false),
@@ -75,8 +77,15 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   m_shearModulus = calculateShearModulus(params);
   m_density = params.get<double>("Density");
   m_horizon = params.get<double>("Horizon");
-  if(params.isParameter("Apply Automatic Differentiation Jacobian"))
+  // An explicit request for the automatic differentiation Jacobian turns off the analytic default
+  if(params.isParameter("Apply Automatic Differentiation Jacobian")){
     m_applyAutomaticDifferentiationJacobian = params.get<bool>("Apply Automatic Differentiation Jacobian");
+    m_applyAnalyticJacobian = false;
+  }
+  if(params.isParameter("Apply Analytic Jacobian"))
+    m_applyAnalyticJacobian = params.get<bool>("Apply Analytic Jacobian");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_applyAnalyticJacobian && params.isParameter("Apply Automatic Differentiation Jacobian") && m_applyAutomaticDifferentiationJacobian,
+                              "**** Error:  \"Apply Analytic Jacobian\" and \"Apply Automatic Differentiation Jacobian\" cannot both be true.");
 
   if(params.isParameter("Thermal Expansion Coefficient")){
     m_alpha = params.get<double>("Thermal Expansion Coefficient");
@@ -170,11 +179,18 @@ PeridigmNS::ElasticMaterial::computeForce(const double dt,
   if(m_computePartialStress)
     dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
 #ifdef PERIDIGM_KOKKOS
+  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
   MATERIAL_EVALUATION::computeInternalForceLinearElasticKokkos(x,y,weightedVolume,cellVolume,dilatation,bondDamage,scf,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
 #else
-  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+  if(partialStress == NULL){
+    // Single sweep over the bonds of each point, the force loop reuses the bond quantities computed for the dilatation
+    MATERIAL_EVALUATION::computeDilatationAndInternalForceLinearElastic(x,y,weightedVolume,cellVolume,bondDamage,dilatation,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_bondCache,m_OMEGA,m_alpha,deltaTemperature);
+  }
+  else{
+    MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
+    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+  }
 #endif
 }
 
@@ -251,7 +267,11 @@ PeridigmNS::ElasticMaterial::computeJacobian(const double dt,
                                              PeridigmNS::SerialMatrix& jacobian,
                                              PeridigmNS::Material::JacobianType jacobianType) const
 {
-  if(m_applyAutomaticDifferentiationJacobian){
+  if(m_applyAnalyticJacobian){
+    // Compute the Jacobian from the closed-form tangent
+    computeAnalyticJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+  }
+  else if(m_applyAutomaticDifferentiationJacobian){
     // Compute the Jacobian via automatic differentiation
     computeAutomaticDifferentiationJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);  
   }
@@ -262,6 +282,75 @@ PeridigmNS::ElasticMaterial::computeJacobian(const double dt,
 }
 
 
+void
+PeridigmNS::ElasticMaterial::computeAnalyticJacobian(const double dt,
+                                                     const int numOwnedPoints,
+                                                     const int* ownedIDs,
+                                                     const int* neighborhoodList,
+                                                     PeridigmNS::DataManager& dataManager,
+                                                     PeridigmNS::SerialMatrix& jacobian,
+                                                     PeridigmNS::Material::JacobianType jacobianType) const
+{
+  // The tangent of each neighborhood is evaluated in place from the overlap data, so no
+  // temporary neighborhood data is required
+
+  // Extract pointers to the underlying data
+  double *x, *y, *cellVolume, *weightedVolume, *bondDamage, *deltaTemperature;
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_weightedVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&weightedVolume);
+  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  deltaTemperature = NULL;
+  if(m_applyThermalStrains)
+    dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
+
+  const Epetra_BlockMap& ownedScalarPointMap = *dataManager.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapScalarPointMap = *dataManager.getOverlapScalarPointMap();
+  vector<int> globalIndices;
+
+  // Loop over all points.
+  int neighborhoodListIndex = 0;
+  int bondIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    const int* neighPtr = &neighborhoodList[neighborhoodListIndex];
+    int numNeighbors = *neighPtr;
+    int numDof = 3*(numNeighbors+1);
+
+    // Resize scratchMatrix if necessary
+    if(scratchMatrix.Dimension() < numDof)
+      scratchMatrix.Resize(numDof);
+
+    // Create a list of global indices for the rows/columns in the scratch matrix,
+    // with the node at the center of the neighborhood first
+    globalIndices.resize(numDof);
+    int globalID = ownedScalarPointMap.GID(iID);
+    for(int j=0 ; j<3 ; ++j)
+      globalIndices[j] = 3*globalID+j;
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      globalID = overlapScalarPointMap.GID(neighPtr[iNID+1]);
+      for(int j=0 ; j<3 ; ++j)
+        globalIndices[3*(iNID+1)+j] = 3*globalID+j;
+    }
+
+    MATERIAL_EVALUATION::computeTangentStiffnessLinearElastic(iID,neighPtr,x,y,weightedVolume[iID],cellVolume,&bondDamage[bondIndex],scratchMatrix.WritableData(),
+                                                              m_bulkModulus,m_shearModulus,m_horizon,m_bondCache,m_OMEGA,m_alpha,deltaTemperature);
+
+    // Sum the values into the global tangent matrix (this is expensive).
+    if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+      jacobian.addValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL) {
+      jacobian.addBlockDiagonalValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    }
+    else // unknown jacobian type
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+
+    neighborhoodListIndex += numNeighbors+1;
+    bondIndex += numNeighbors;
+  }
+}
+
 void
 PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const double dt,
                                                                      const int numOwnedPoints,
@@ -273,10 +362,6 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
 {
   // Compute contributions to the tangent matrix on an element-by-element basis
 
-  // To reduce memory re-allocation, use static variable to store Fad types for
-  // current coordinates (independent variables).
-  static vector<Sacado::Fad::DFad<double> > y_AD;
-
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
@@ -344,39 +429,18 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
     deltaTemperature = NULL;
     if(m_applyThermalStrains)
       tempDataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
-    // Create arrays of Fad objects for the current coordinates, dilatation, and force density
-    // Modify the existing vector of Fad objects for the current coordinates
-    if((int)y_AD.size() < numDof)
-      y_AD.resize(numDof);
-    for(int i=0 ; i<numDof ; ++i){
-      y_AD[i].diff(i, numDof);
-      y_AD[i].val() = y[i];
-    }
-    // Create vectors of empty AD types for the dependent variables
-    vector<Sacado::Fad::DFad<double> > dilatation_AD(numEntries);
-    vector<Sacado::Fad::DFad<double> > force_AD(numDof);
-
-    vector<Sacado::Fad::DFad<double> > partialStress_AD;
-    Sacado::Fad::DFad<double> *partialStress_AD_Ptr = NULL;
-    if(m_computePartialStress){
-      partialStress_AD.resize(numDof*numDof);
-      partialStress_AD_Ptr = &partialStress_AD[0];
-    }
-
-    // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,&tempNeighborhoodList[0],tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
-
-    // Load derivative values into scratch matrix
-    // Multiply by volume along the way to convert force density to force
-    double value;
-    for(int row=0 ; row<numDof ; ++row){
-      for(int col=0 ; col<numDof ; ++col){
-	value = force_AD[row].dx(col) * cellVolume[row/3];
-	TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in ElasticMaterial::computeAutomaticDifferentiationJacobian().\n");
-        scratchMatrix(row, col) = value;
-      }
-    }
+    // Evaluate the tangent with the smallest statically sized AD type that holds the
+    // neighborhood, so that the derivative arrays live on the stack
+    if(numNeighbors <= 32)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<32>::type >(numEntries, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature);
+    else if(numNeighbors <= 64)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<64>::type >(numEntries, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature);
+    else if(numNeighbors <= 128)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<128>::type >(numEntries, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature);
+    else if(numNeighbors <= 256)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<256>::type >(numEntries, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature);
+    else
+      computeAutomaticDifferentiationJacobianForNeighborhood< Sacado::Fad::DFad<double> >(numEntries, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, deltaTemperature);
 
     // Sum the values into the global tangent matrix (this is expensive).
     if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
@@ -388,3 +452,61 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
       TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
   }
 }
+
+template<typename ScalarT>
+void
+PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobianForNeighborhood(const int numEntries,
+                                                                                    const int* tempNeighborhoodList,
+                                                                                    const double* x,
+                                                                                    const double* y,
+                                                                                    const double* cellVolume,
+                                                                                    const double* weightedVolume,
+                                                                                    const double* bondDamage,
+                                                                                    const double* deltaTemperature) const
+{
+  int numDof = 3*numEntries;
+  int tempNumOwnedPoints = 1;
+
+  // To reduce memory re-allocation, use static variables to store the Fad types for the
+  // current coordinates (independent variables) and the dependent variables.
+  static vector<ScalarT> y_AD;
+  static vector<ScalarT> dilatation_AD;
+  static vector<ScalarT> force_AD;
+  static vector<ScalarT> partialStress_AD;
+  if((int)y_AD.size() < numDof){
+    y_AD.resize(numDof);
+    dilatation_AD.resize(numEntries);
+    force_AD.resize(numDof);
+  }
+
+  // Seed the current coordinates, and clear the force density, which the model sums into
+  for(int i=0 ; i<numDof ; ++i){
+    y_AD[i].diff(i, numDof);
+    y_AD[i].val() = y[i];
+    force_AD[i] = ScalarT(numDof, 0.0);
+  }
+
+  // The partial stress is stored for the owned point only
+  ScalarT *partialStress_AD_Ptr = NULL;
+  if(m_computePartialStress){
+    partialStress_AD.resize(9);
+    for(int i=0 ; i<9 ; ++i)
+      partialStress_AD[i] = ScalarT(numDof, 0.0);
+    partialStress_AD_Ptr = &partialStress_AD[0];
+  }
+
+  // Evaluate the constitutive model using the AD types
+  MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
+  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,tempNeighborhoodList,tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+
+  // Load derivative values into scratch matrix
+  // Multiply by volume along the way to convert force density to force
+  double value;
+  for(int row=0 ; row<numDof ; ++row){
+    for(int col=0 ; col<numDof ; ++col){
+      value = force_AD[row].dx(col) * cellVolume[row/3];
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN detected in ElasticMaterial::computeAutomaticDifferentiationJacobian().\n");
+      scratchMatrix(row, col) = value;
+    }
+  }
+}
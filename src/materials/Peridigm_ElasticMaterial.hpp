@@ -49,6 +49,7 @@
 #define PERIDIGM_ELASTICMATERIAL_HPP
 
 #include "Peridigm_Material.hpp"
+#include "material_utilities.h"
 #include "Peridigm_InfluenceFunction.hpp"
 
 namespace PeridigmNS {
@@ -165,7 +166,29 @@ namespace PeridigmNS {
                                             PeridigmNS::SerialMatrix& jacobian,
                                             PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
 
+    //! Evaluate the jacobian from the closed-form tangent of the linear peridynamic solid.
+    virtual void
+    computeAnalyticJacobian(const double dt,
+                            const int numOwnedPoints,
+                            const int* ownedIDs,
+                            const int* neighborhoodList,
+                            PeridigmNS::DataManager& dataManager,
+                            PeridigmNS::SerialMatrix& jacobian,
+                            PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
   protected:
+
+    //! Evaluates the tangent of a single neighborhood into scratchMatrix, differentiating with the AD type ScalarT.
+    template<typename ScalarT>
+    void
+    computeAutomaticDifferentiationJacobianForNeighborhood(const int numEntries,
+                                                           const int* tempNeighborhoodList,
+                                                           const double* x,
+                                                           const double* y,
+                                                           const double* cellVolume,
+                                                           const double* weightedVolume,
+                                                           const double* bondDamage,
+                                                           const double* deltaTemperature) const;
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
     inline double distance(double a1, double a2, double a3,
@@ -180,6 +203,7 @@ namespace PeridigmNS {
     double m_density;
     double m_alpha;
     double m_horizon;
+    bool m_applyAnalyticJacobian;
     bool m_applyAutomaticDifferentiationJacobian;
     bool m_applyThermalStrains;
     bool m_computePartialStress;
@@ -198,6 +222,9 @@ namespace PeridigmNS {
     int m_bondDamageFieldId;
     int m_temperatureFieldId;
     int m_deltaTemperatureFieldId;
+
+    //! Bond quantities cached between the dilatation and force sweeps
+    mutable MATERIAL_EVALUATION::BondCache m_bondCache;
   };
 }
 
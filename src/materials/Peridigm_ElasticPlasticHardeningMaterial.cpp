@@ -51,6 +51,7 @@
 #include "elastic_plastic.h"
 #include "elastic_plastic_hardening.h"
 #include "material_utilities.h"
+#include "neighborhood_fad.h"
 #include <Teuchos_Assert.hpp>
 #include <Epetra_SerialComm.h>
 #include <Epetra_Vector.h>
@@ -168,26 +169,27 @@ PeridigmNS::ElasticPlasticHardeningMaterial::computeForce(const double dt,
   // Zero out the force
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon);
-  MATERIAL_EVALUATION::computeInternalForceIsotropicHardeningPlastic(x,
-                                                                     y,
-                                                                     weightedVolume,
-                                                                     volume,
-                                                                     dilatation,
-                                                                     bondDamage,
-                                                                     ownedShearCorrectionFactor,
-                                                                     edpN,
-                                                                     edpNP1,
-                                                                     lambdaN,
-                                                                     lambdaNP1,
-                                                                     force,
-                                                                     neighborhoodList,
-                                                                     numOwnedPoints,
-                                                                     m_bulkModulus,
-                                                                     m_shearModulus,
-                                                                     m_horizon,
-                                                                     m_yieldStress,
-                                                                     m_hardeningModulus);
+  MATERIAL_EVALUATION::computeDilatationAndInternalForceIsotropicHardeningPlastic(x,
+                                                                                  y,
+                                                                                  weightedVolume,
+                                                                                  volume,
+                                                                                  bondDamage,
+                                                                                  dilatation,
+                                                                                  ownedShearCorrectionFactor,
+                                                                                  edpN,
+                                                                                  edpNP1,
+                                                                                  lambdaN,
+                                                                                  lambdaNP1,
+                                                                                  force,
+                                                                                  neighborhoodList,
+                                                                                  numOwnedPoints,
+                                                                                  m_bulkModulus,
+                                                                                  m_shearModulus,
+                                                                                  m_horizon,
+                                                                                  m_yieldStress,
+                                                                                  m_hardeningModulus,
+                                                                                  m_bondCache,
+                                                                                  m_yieldingPoints);
 }
 
 void
@@ -220,10 +222,6 @@ PeridigmNS::ElasticPlasticHardeningMaterial::computeAutomaticDifferentiationJaco
 {
   // Compute contributions to the tangent matrix on an element-by-element basis
 
-  // To reduce memory re-allocation, use static variable to store Fad types for
-  // current coordinates (independent variables).
-  static vector<Sacado::Fad::DFad<double> > y_AD;
-
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
@@ -292,53 +290,93 @@ PeridigmNS::ElasticPlasticHardeningMaterial::computeAutomaticDifferentiationJaco
     tempDataManager.getData(m_lambdaFieldId, PeridigmField::STEP_N)->ExtractView(&lambdaN);
     tempDataManager.getData(m_surfaceCorrectionFactorFieldId, PeridigmField::STEP_NONE)->ExtractView(&ownedShearCorrectionFactor);
 
-    // Create arrays of Fad objects for the current coordinates, dilatation, and force density
-    // Modify the existing vector of Fad objects for the current coordinates
-    if((int)y_AD.size() < numDof)
-      y_AD.resize(numDof);
-    for(int i=0 ; i<numDof ; ++i){
-      y_AD[i].diff(i, numDof);
-      y_AD[i].val() = y[i];
-    }
-    // Create vectors of empty AD types for the dependent variables
-    vector<Sacado::Fad::DFad<double> > dilatation_AD(numEntries);
-    vector<Sacado::Fad::DFad<double> > lambdaNP1_AD(numEntries);
+    // Evaluate the tangent with the smallest statically sized AD type that holds the
+    // neighborhood, so that the derivative arrays live on the stack
     int numBonds = tempDataManager.getData(m_deviatoricPlasticExtensionFieldId, PeridigmField::STEP_N)->MyLength();
-    vector<Sacado::Fad::DFad<double> > edpNP1(numBonds);
-    vector<Sacado::Fad::DFad<double> > force_AD(numDof);
-
-    // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon);
-    MATERIAL_EVALUATION::computeInternalForceIsotropicHardeningPlastic(x,
-                                                                       &y_AD[0],
-                                                                       weightedVolume,
-                                                                       cellVolume,
-                                                                       &dilatation_AD[0],
-                                                                       bondDamage,
-                                                                       ownedShearCorrectionFactor,
-                                                                       edpN,
-                                                                       &edpNP1[0],
-                                                                       lambdaN,
-                                                                       &lambdaNP1_AD[0],
-                                                                       &force_AD[0],
-                                                                       &tempNeighborhoodList[0],
-                                                                       tempNumOwnedPoints,
-                                                                       m_bulkModulus,
-                                                                       m_shearModulus,
-                                                                       m_horizon,
-                                                                       m_yieldStress,
-                                                                       m_hardeningModulus);
-
-    // Load derivative values into scratch matrix
-    // Multiply by volume along the way to convert force density to force
-    for(int row=0 ; row<numDof ; ++row){
-      for(int col=0 ; col<numDof ; ++col){
-        scratchMatrix(row, col) = force_AD[row].dx(col) * cellVolume[row/3];
-      }
-    }
+    if(numNeighbors <= 32)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<32>::type >(numEntries, numBonds, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN);
+    else if(numNeighbors <= 64)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<64>::type >(numEntries, numBonds, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN);
+    else if(numNeighbors <= 128)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<128>::type >(numEntries, numBonds, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN);
+    else if(numNeighbors <= 256)
+      computeAutomaticDifferentiationJacobianForNeighborhood< MATERIAL_EVALUATION::NeighborhoodFad<256>::type >(numEntries, numBonds, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN);
+    else
+      computeAutomaticDifferentiationJacobianForNeighborhood< Sacado::Fad::DFad<double> >(numEntries, numBonds, &tempNeighborhoodList[0], x, y, cellVolume, weightedVolume, bondDamage, ownedShearCorrectionFactor, edpN, lambdaN);
 
     // Sum the values into the global tangent matrix (this is expensive).
     jacobian.addValues((int)globalIndices.size(), &globalIndices[0], scratchMatrix.Data());
   }
 }
 
+template<typename ScalarT>
+void
+PeridigmNS::ElasticPlasticHardeningMaterial::computeAutomaticDifferentiationJacobianForNeighborhood(const int numEntries,
+                                                                                                    const int numBonds,
+                                                                                                    const int* tempNeighborhoodList,
+                                                                                                    const double* x,
+                                                                                                    const double* y,
+                                                                                                    const double* cellVolume,
+                                                                                                    const double* weightedVolume,
+                                                                                                    const double* bondDamage,
+                                                                                                    const double* ownedShearCorrectionFactor,
+                                                                                                    const double* edpN,
+                                                                                                    const double* lambdaN) const
+{
+  int numDof = 3*numEntries;
+  int tempNumOwnedPoints = 1;
+
+  // To reduce memory re-allocation, use static variables to store the Fad types for the
+  // current coordinates (independent variables) and the dependent variables.
+  static vector<ScalarT> y_AD;
+  static vector<ScalarT> dilatation_AD;
+  static vector<ScalarT> lambdaNP1_AD;
+  static vector<ScalarT> edpNP1;
+  static vector<ScalarT> force_AD;
+  if((int)y_AD.size() < numDof){
+    y_AD.resize(numDof);
+    dilatation_AD.resize(numEntries);
+    lambdaNP1_AD.resize(numEntries);
+    force_AD.resize(numDof);
+  }
+  if((int)edpNP1.size() < numBonds)
+    edpNP1.resize(numBonds);
+
+  // Seed the current coordinates, and clear the force density, which the model sums into
+  for(int i=0 ; i<numDof ; ++i){
+    y_AD[i].diff(i, numDof);
+    y_AD[i].val() = y[i];
+    force_AD[i] = ScalarT(numDof, 0.0);
+  }
+
+  // Evaluate the constitutive model using the AD types
+  MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon);
+  MATERIAL_EVALUATION::computeInternalForceIsotropicHardeningPlastic(x,
+                                                                     &y_AD[0],
+                                                                     weightedVolume,
+                                                                     cellVolume,
+                                                                     &dilatation_AD[0],
+                                                                     bondDamage,
+                                                                     ownedShearCorrectionFactor,
+                                                                     edpN,
+                                                                     &edpNP1[0],
+                                                                     lambdaN,
+                                                                     &lambdaNP1_AD[0],
+                                                                     &force_AD[0],
+                                                                     tempNeighborhoodList,
+                                                                     tempNumOwnedPoints,
+                                                                     m_bulkModulus,
+                                                                     m_shearModulus,
+                                                                     m_horizon,
+                                                                     m_yieldStress,
+                                                                     m_hardeningModulus);
+
+  // Load derivative values into scratch matrix
+  // Multiply by volume along the way to convert force density to force
+  for(int row=0 ; row<numDof ; ++row){
+    for(int col=0 ; col<numDof ; ++col){
+      scratchMatrix(row, col) = force_AD[row].dx(col) * cellVolume[row/3];
+    }
+  }
+}
+
@@ -49,6 +49,7 @@
 #define PERIDIGM_ELASTICPLASTICHARDENINGMATERIAL_HPP
 
 #include "Peridigm_Material.hpp"
+#include "elastic_plastic_hardening.h"
 
 namespace PeridigmNS {
 
@@ -118,6 +119,21 @@ namespace PeridigmNS {
 
   protected:
 
+    //! Evaluates the tangent of a single neighborhood into scratchMatrix, differentiating with the AD type ScalarT.
+    template<typename ScalarT>
+    void
+    computeAutomaticDifferentiationJacobianForNeighborhood(const int numEntries,
+                                                           const int numBonds,
+                                                           const int* tempNeighborhoodList,
+                                                           const double* x,
+                                                           const double* y,
+                                                           const double* cellVolume,
+                                                           const double* weightedVolume,
+                                                           const double* bondDamage,
+                                                           const double* ownedShearCorrectionFactor,
+                                                           const double* edpN,
+                                                           const double* lambdaN) const;
+
     // material parameters
     double m_bulkModulus;
     double m_shearModulus;
@@ -143,6 +159,12 @@ namespace PeridigmNS {
     int m_deviatoricPlasticExtensionFieldId;
     int m_lambdaFieldId;
     int m_surfaceCorrectionFactorFieldId;
+
+    //! Bond quantities cached between the dilatation and force sweeps
+    mutable MATERIAL_EVALUATION::BondCache m_bondCache;
+
+    //! Yielding points collected for the return mapping
+    mutable MATERIAL_EVALUATION::YieldingPoints m_yieldingPoints;
   };
 }
 
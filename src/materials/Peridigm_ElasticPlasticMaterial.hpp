@@ -49,6 +49,7 @@
 #define PERIDIGM_ELASTICPLASTICMATERIAL_HPP_
 
 #include "Peridigm_Material.hpp"
+#include "elastic_plastic.h"
 
 namespace PeridigmNS {
 
@@ -118,6 +119,20 @@ namespace PeridigmNS {
 
   protected:
 
+    //! Evaluates the tangent of a single neighborhood into scratchMatrix, differentiating with the AD type ScalarT.
+    template<typename ScalarT>
+    void
+    computeAutomaticDifferentiationJacobianForNeighborhood(const int numEntries,
+                                                           const int numBonds,
+                                                           const int* tempNeighborhoodList,
+                                                           const double* x,
+                                                           const double* y,
+                                                           const double* cellVolume,
+                                                           const double* weightedVolume,
+                                                           const double* bondDamage,
+                                                           const double* edpN,
+                                                           const double* lambdaN) const;
+
     // material parameters
     double m_bulkModulus;
     double m_shearModulus;
@@ -141,6 +156,12 @@ namespace PeridigmNS {
     int m_bondDamageFieldId;
     int m_deviatoricPlasticExtensionFieldId;
     int m_lambdaFieldId;
+
+    //! Bond quantities cached between the dilatation and force sweeps
+    mutable MATERIAL_EVALUATION::BondCache m_bondCache;
+
+    //! Yielding points collected for the return mapping
+    mutable MATERIAL_EVALUATION::YieldingPoints m_yieldingPoints;
   };
 }
 
@@ -49,6 +49,7 @@
 #include "Peridigm_Field.hpp"
 #include <Teuchos_Assert.hpp>
 #include <Epetra_SerialComm.h>
+#include <algorithm>
 #include <cmath>
 
 using namespace std;
@@ -109,69 +110,86 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
   int velocityFId = fieldManager.getFieldId("Velocity");
   int forceDensityFId = fieldManager.getFieldId("Force_Density");
 
-  // Loop over all points.
+  // Find the largest neighborhood, which determines the size of the neighborhood workspace.
+  int maxNumNeighbors = 0;
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex];
+    if(numNeighbors > maxNumNeighbors)
+      maxNumNeighbors = numNeighbors;
+    neighborhoodListIndex += numNeighbors+1;
+  }
+
+  // The neighborhood of each point is copied into a single data manager, which is reused for every point.
+  // It has the same fields as the real data manager, and is reallocated only when a larger neighborhood appears.
+  vector<int> fieldIds = dataManager.getFieldIds();
+  if(m_neighborhoodDataManager.is_null() || maxNumNeighbors+1 > m_neighborhoodCapacity || fieldIds != m_neighborhoodFieldIds){
+    m_neighborhoodCapacity = std::max(maxNumNeighbors+1, m_neighborhoodCapacity);
+    m_neighborhoodFieldIds = fieldIds;
+    vector<int> tempMyGlobalIDs(m_neighborhoodCapacity);
+    for(int i=0 ; i<m_neighborhoodCapacity ; ++i)
+      tempMyGlobalIDs[i] = i;
+    Epetra_SerialComm serialComm;
+    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(m_neighborhoodCapacity, m_neighborhoodCapacity, &tempMyGlobalIDs[0], 1, 0, serialComm));
+    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(m_neighborhoodCapacity, m_neighborhoodCapacity, &tempMyGlobalIDs[0], 3, 0, serialComm));
+    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], m_neighborhoodCapacity-1, 0, serialComm));
+    m_neighborhoodDataManager = Teuchos::rcp(new PeridigmNS::DataManager);
+    m_neighborhoodDataManager->setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
+                                       tempOneDimensionalMap,
+                                       Teuchos::RCP<const Epetra_BlockMap>(),
+                                       tempThreeDimensionalMap,
+                                       tempBondMap);
+    m_neighborhoodDataManager->allocateData(fieldIds);
+  }
+  PeridigmNS::DataManager& tempDataManager = *m_neighborhoodDataManager;
+
+  // Extract pointers to the underlying data in the neighborhood workspace.
+  double *volume, *y, *v, *force;
+  tempDataManager.getData(volumeFId, PeridigmField::STEP_NONE)->ExtractView(&volume);
+  tempDataManager.getData(coordinatesFId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  tempDataManager.getData(velocityFId, PeridigmField::STEP_NP1)->ExtractView(&v);
+  tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1)->ExtractView(&force);
+
+  // Create a temporary array for storing force.
+  vector<double> tempForce(numDoFs*m_neighborhoodCapacity);
+
+  // Set up numOwnedPoints and ownedIDs.
+  // There is only one owned ID, and it has local ID zero in the tempDataManager.
+  int tempNumOwnedPoints = 1;
+  vector<int> tempOwnedIDs(1);
+  tempOwnedIDs[0] = 0;
 
-    // Create a temporary neighborhood consisting of a single point and its neighbors.
+  // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
+  // Resize scratchMatrix if necessary
+  if(scratchMatrix.Dimension() < numDoFs*(maxNumNeighbors+1))
+    scratchMatrix.Resize(numDoFs*(maxNumNeighbors+1));
+
+  vector<int> sourcePointIDs(maxNumNeighbors+1);
+  vector<int> tempNeighborhoodList(maxNumNeighbors+1);
+  vector<int> globalIndices;
+
+  // Loop over all points.
+  neighborhoodListIndex = 0;
+  int bondIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    // Gather a temporary neighborhood consisting of a single point and its neighbors.
     int numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    vector<int> tempMyGlobalIDs(numNeighbors+1);
+    int numPoints = numNeighbors+1;
     // Put the node at the center of the neighborhood at the beginning of the list.
-    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
-    vector<int> tempNeighborhoodList(numNeighbors+1);
+    sourcePointIDs[0] = iID;
     tempNeighborhoodList[0] = numNeighbors;
     for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
+      sourcePointIDs[iNID+1] = neighborhoodList[neighborhoodListIndex++];
       tempNeighborhoodList[iNID+1] = iNID+1;
     }
-
-    Epetra_SerialComm serialComm;
-    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numNeighbors+1, numNeighbors+1, &tempMyGlobalIDs[0], 1, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numNeighbors+1, numNeighbors+1, &tempMyGlobalIDs[0], 3, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
-
-    // Create a temporary DataManager containing data for this point and its neighborhood.
-    PeridigmNS::DataManager tempDataManager;
-    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempOneDimensionalMap,
-                            Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempThreeDimensionalMap,
-                            tempBondMap);
-
-    // The temporary data manager will have the same fields and data as the real data manager.
-    vector<int> fieldIds = dataManager.getFieldIds();
-    tempDataManager.allocateData(fieldIds);
-    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
-
-    // Set up numOwnedPoints and ownedIDs.
-    // There is only one owned ID, and it has local ID zero in the tempDataManager.
-    int tempNumOwnedPoints = 1;
-    vector<int> tempOwnedIDs(1);
-    tempOwnedIDs[0] = 0;
-
-    // Extract pointers to the underlying data.
-    double *volume, *y, *v, *force;
-    tempDataManager.getData(volumeFId, PeridigmField::STEP_NONE)->ExtractView(&volume);
-    tempDataManager.getData(coordinatesFId, PeridigmField::STEP_NP1)->ExtractView(&y);
-    tempDataManager.getData(velocityFId, PeridigmField::STEP_NP1)->ExtractView(&v);
-    tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1)->ExtractView(&force);
-
-    // Create a temporary vector for storing force.
-    Teuchos::RCP<Epetra_Vector> forceVector = tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1);
-    Teuchos::RCP<Epetra_Vector> tempForceVector = Teuchos::rcp(new Epetra_Vector(*forceVector));
-    double* tempForce;
-    tempForceVector->ExtractView(&tempForce);
-
-    // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
-    // Resize scratchMatrix if necessary
-    if(scratchMatrix.Dimension() < numDoFs*(numNeighbors+1))
-      scratchMatrix.Resize(numDoFs*(numNeighbors+1));
+    tempDataManager.copyNeighborhoodDataFromDataManager(dataManager, numPoints, &sourcePointIDs[0], bondIndex, numNeighbors);
+    bondIndex += numNeighbors;
 
     // Create a list of global indices for the rows/columns in the scratch matrix.
-    vector<int> globalIndices(numDoFs*(numNeighbors+1));
-    for(int i=0 ; i<numNeighbors+1 ; ++i){
-      int globalID = tempOneDimensionalMap->GID(i);
+    globalIndices.resize(numDoFs*numPoints);
+    for(int i=0 ; i<numPoints ; ++i){
+      int globalID = (i == 0) ? dataManager.getOwnedScalarPointMap()->GID(iID) : dataManager.getOverlapScalarPointMap()->GID(sourcePointIDs[i]);
       for(int j=0 ; j<numDoFs ; ++j){
         globalIndices[numDoFs*i+j] = numDoFs*globalID+j;
       }
@@ -180,7 +198,7 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
     if(finiteDifferenceScheme == FORWARD_DIFFERENCE){
       // Compute and store the unperturbed force.
       computeForce(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
-      for(int i=0 ; i<forceVector->MyLength() ; ++i)
+      for(int i=0 ; i<numDoFs*numPoints ; ++i)
         tempForce[i] = force[i];
     }
 
@@ -207,7 +225,7 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
           computeForce(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
           y[numDoFs*perturbID+dof] = oldY;
           v[numDoFs*perturbID+dof] = oldV;
-          for(int i=0 ; i<forceVector->MyLength() ; ++i)
+          for(int i=0 ; i<numDoFs*numPoints ; ++i)
             tempForce[i] = force[i];
         }
 
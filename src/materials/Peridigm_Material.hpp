@@ -67,7 +67,7 @@ namespace PeridigmNS {
   public:
 
     //! Standard constructor.
-    Material(const Teuchos::ParameterList & params) : m_finiteDifferenceProbeLength(DBL_MAX) {
+    Material(const Teuchos::ParameterList & params) : m_finiteDifferenceProbeLength(DBL_MAX), m_neighborhoodCapacity(0) {
       if(params.isParameter("Finite Difference Probe Length"))
       m_finiteDifferenceProbeLength = params.get<double>("Finite Difference Probe Length");
     }
@@ -190,6 +190,16 @@ namespace PeridigmNS {
     //! Finite-difference probe length
     double m_finiteDifferenceProbeLength;
 
+    //! @name Neighborhood workspace for the finite-difference Jacobian
+    //@{
+    //! Data manager holding the data for a single neighborhood; reused for every point, and reallocated only for a larger neighborhood.
+    mutable Teuchos::RCP<PeridigmNS::DataManager> m_neighborhoodDataManager;
+    //! Number of points the neighborhood data manager can hold.
+    mutable int m_neighborhoodCapacity;
+    //! Field ids allocated in the neighborhood data manager.
+    mutable std::vector<int> m_neighborhoodFieldIds;
+    //@}
+
   private:
 
     //! Default constructor with no arguments, private to prevent use.
@@ -57,8 +57,9 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::ViscoplasticNeedlemanCo
   : CorrespondenceMaterial(params),
     m_yieldStress(0.0), m_strainHardeningExponent(0.0), m_rateHardeningExponent(0.0), m_refStrainRate(0.0), m_refStrain0(0.0), m_refStrain1(0.0),
     m_isFlaw(false), m_flawLocationX(0.0), m_flawLocationY(0.0), m_flawLocationZ(0.0), m_flawSize(0.0), m_flawMagnitude(0.0),
+    m_returnMappingSolver(CORRESPONDENCE::RETURN_MAPPING_NEWTON),
     m_modelCoordinatesFieldId(-1), m_unrotatedRateOfDeformationFieldId(-1), m_unrotatedCauchyStressFieldId(-1), m_vonMisesStressFieldId(-1), 
-    m_equivalentPlasticStrainFieldId(-1)
+    m_equivalentPlasticStrainFieldId(-1), m_returnMappingIterationsFieldId(-1), m_returnMappingFailureFieldId(-1)
 {
   m_yieldStress = params.get<double>("Yield Stress");
   m_strainHardeningExponent = params.get<double>("Strain Hardening Exponent");
@@ -74,6 +75,13 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::ViscoplasticNeedlemanCo
     m_flawSize = params.get<double>("Flaw Size");
     m_flawMagnitude = params.get<double>("Flaw Magnitude");
   }
+  if(params.isParameter("Return Mapping Solver")){
+    string solver = params.get<string>("Return Mapping Solver");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(solver != "Newton" && solver != "Bisection",
+                                "**** Error:  Unknown Return Mapping Solver \"" + solver + "\", valid options are \"Newton\" and \"Bisection\".\n");
+    if(solver == "Bisection")
+      m_returnMappingSolver = CORRESPONDENCE::RETURN_MAPPING_BISECTION;
+  }
 
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
@@ -83,12 +91,16 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::ViscoplasticNeedlemanCo
   m_vonMisesStressFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Von_Mises_Stress");
 
   m_equivalentPlasticStrainFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Equivalent_Plastic_Strain");
+  m_returnMappingIterationsFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Iterations");
+  m_returnMappingFailureFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Return_Mapping_Failure");
 
   m_fieldIds.push_back(m_modelCoordinatesFieldId);
   m_fieldIds.push_back(m_unrotatedRateOfDeformationFieldId);
   m_fieldIds.push_back(m_unrotatedCauchyStressFieldId);
   m_fieldIds.push_back(m_vonMisesStressFieldId);
   m_fieldIds.push_back(m_equivalentPlasticStrainFieldId);
+  m_fieldIds.push_back(m_returnMappingIterationsFieldId);
+  m_fieldIds.push_back(m_returnMappingFailureFieldId);
 }
 
 PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::~ViscoplasticNeedlemanCorrespondenceMaterial()
@@ -112,6 +124,8 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::initialize(const double
   dataManager.getData(m_vonMisesStressFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
   dataManager.getData(m_equivalentPlasticStrainFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+  dataManager.getData(m_returnMappingIterationsFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_returnMappingFailureFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
 }
 
 void
@@ -136,6 +150,10 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeCauchyStress(con
   double *modelCoordinates;
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&modelCoordinates);
 
+  double *returnMappingIterations, *returnMappingFailure;
+  dataManager.getData(m_returnMappingIterationsFieldId, PeridigmField::STEP_NONE)->ExtractView(&returnMappingIterations);
+  dataManager.getData(m_returnMappingFailureFieldId, PeridigmField::STEP_NONE)->ExtractView(&returnMappingFailure);
+
   CORRESPONDENCE::updateElasticViscoplasticCauchyStress(modelCoordinates,
                                                         unrotatedRateOfDeformation,
                                                         unrotatedCauchyStressN,
@@ -158,5 +176,8 @@ PeridigmNS::ViscoplasticNeedlemanCorrespondenceMaterial::computeCauchyStress(con
                                                         m_flawLocationZ,
                                                         m_flawSize,
                                                         m_flawMagnitude,
-                                                        dt);
+                                                        dt,
+                                                        m_returnMappingSolver,
+                                                        returnMappingIterations,
+                                                        returnMappingFailure);
 }
@@ -49,6 +49,7 @@
 #define PERIDIGM_VISCOPLASTICNEEDLEMANCORRESPONDENCEMATERIAL_HPP
 
 #include "Peridigm_CorrespondenceMaterial.hpp"
+#include "viscoplastic_needleman_correspondence.h"
 
 namespace PeridigmNS {
 
@@ -96,12 +97,17 @@ namespace PeridigmNS {
     double m_flawSize;
     double m_flawMagnitude;
 
+    //! Root solver for the plastic multiplier
+    CORRESPONDENCE::ReturnMappingSolver m_returnMappingSolver;
+
     // field spec ids for all relevant data
     int m_modelCoordinatesFieldId;
     int m_unrotatedRateOfDeformationFieldId;
     int m_unrotatedCauchyStressFieldId;
     int m_vonMisesStressFieldId;
     int m_equivalentPlasticStrainFieldId;
+    int m_returnMappingIterationsFieldId;
+    int m_returnMappingFailureFieldId;
   };
 }
 
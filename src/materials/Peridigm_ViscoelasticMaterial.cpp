@@ -134,24 +134,25 @@ PeridigmNS::ViscoelasticMaterial::computeForce(const double dt,
 
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon);
-  MATERIAL_EVALUATION::computeInternalForceViscoelasticStandardLinearSolid(dt,
-                                                                           x,
-                                                                           yN,
-                                                                           yNP1,
-                                                                           weightedVolume,
-                                                                           volume,
-                                                                           dilatationN,
-                                                                           dilatationNp1,
-                                                                           bondDamage,
-                                                                           edbN,
-                                                                           edbNP1,
-                                                                           force,
-                                                                           neighborhoodList,
-                                                                           numOwnedPoints,
-                                                                           m_bulkModulus,
-                                                                           m_shearModulus,
-                                                                           m_lambda_i,
-                                                                           m_tau_b);
+  MATERIAL_EVALUATION::computeDilatationAndInternalForceViscoelasticStandardLinearSolid(dt,
+                                                                                        x,
+                                                                                        yN,
+                                                                                        yNP1,
+                                                                                        weightedVolume,
+                                                                                        volume,
+                                                                                        dilatationN,
+                                                                                        dilatationNp1,
+                                                                                        bondDamage,
+                                                                                        edbN,
+                                                                                        edbNP1,
+                                                                                        force,
+                                                                                        neighborhoodList,
+                                                                                        numOwnedPoints,
+                                                                                        m_bulkModulus,
+                                                                                        m_shearModulus,
+                                                                                        m_lambda_i,
+                                                                                        m_tau_b,
+                                                                                        m_horizon,
+                                                                                        m_bondCache);
 }
 
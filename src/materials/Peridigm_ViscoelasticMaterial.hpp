@@ -49,6 +49,7 @@
 #define PERIDIGM_VISCOELASTICMATERIAL_HPP
 
 #include "Peridigm_Material.hpp"
+#include "material_utilities.h"
 
 namespace PeridigmNS {
 
@@ -117,6 +118,9 @@ namespace PeridigmNS {
     int m_forceDensityFieldId;
     int m_bondDamageFieldId;
     int m_deviatoricBackExtensionFieldId;
+
+    //! Bond quantities cached between the dilatation and force sweeps
+    mutable MATERIAL_EVALUATION::BondCache m_bondCache;
   };
 }
 
@@ -212,6 +212,171 @@ void MatrixMultiply
   }
 }
 
+template<typename ScalarT>
+void loadTensorBatch
+(
+ const ScalarT* tensors,
+ int numPoints,
+ ScalarT* batch
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+
+  for(int l=0 ; l<numPoints ; ++l){
+    for(int c=0 ; c<9 ; ++c)
+      batch[c*B+l] = tensors[9*l+c];
+  }
+  for(int l=numPoints ; l<B ; ++l){
+    for(int c=0 ; c<9 ; ++c)
+      batch[c*B+l] = (c%4 == 0) ? 1.0 : 0.0;
+  }
+}
+
+template<typename ScalarT>
+void storeTensorBatch
+(
+ const ScalarT* batch,
+ int numPoints,
+ ScalarT* tensors
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+
+  for(int l=0 ; l<numPoints ; ++l){
+    for(int c=0 ; c<9 ; ++c)
+      tensors[9*l+c] = batch[c*B+l];
+  }
+}
+
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+  const ScalarT* m0 = matrix;     const ScalarT* m1 = matrix+B;   const ScalarT* m2 = matrix+2*B;
+  const ScalarT* m3 = matrix+3*B; const ScalarT* m4 = matrix+4*B; const ScalarT* m5 = matrix+5*B;
+  const ScalarT* m6 = matrix+6*B; const ScalarT* m7 = matrix+7*B; const ScalarT* m8 = matrix+8*B;
+
+  int numSingular(0);
+
+  for(int l=0 ; l<B ; ++l){
+
+    ScalarT minor0 =  m4[l] * m8[l] - m5[l] * m7[l];
+    ScalarT minor1 =  m3[l] * m8[l] - m5[l] * m6[l];
+    ScalarT minor2 =  m3[l] * m7[l] - m4[l] * m6[l];
+    ScalarT minor3 =  m1[l] * m8[l] - m2[l] * m7[l];
+    ScalarT minor4 =  m0[l] * m8[l] - m6[l] * m2[l];
+    ScalarT minor5 =  m0[l] * m7[l] - m1[l] * m6[l];
+    ScalarT minor6 =  m1[l] * m5[l] - m2[l] * m4[l];
+    ScalarT minor7 =  m0[l] * m5[l] - m2[l] * m3[l];
+    ScalarT minor8 =  m0[l] * m4[l] - m1[l] * m3[l];
+    ScalarT det = m0[l] * minor0 - m1[l] * minor1 + m2[l] * minor2;
+
+    // Singular lanes divide by one and are then masked to zero
+    bool singular = (det == ScalarT(0.0));
+    ScalarT safeDet = singular ? ScalarT(1.0) : det;
+    ScalarT mask = singular ? ScalarT(0.0) : ScalarT(1.0);
+    numSingular += singular ? 1 : 0;
+
+    determinant[l] = det;
+    inverse[l]     = mask * (minor0/safeDet);
+    inverse[B+l]   = mask * (-1.0*minor3/safeDet);
+    inverse[2*B+l] = mask * (minor6/safeDet);
+    inverse[3*B+l] = mask * (-1.0*minor1/safeDet);
+    inverse[4*B+l] = mask * (minor4/safeDet);
+    inverse[5*B+l] = mask * (-1.0*minor7/safeDet);
+    inverse[6*B+l] = mask * (minor2/safeDet);
+    inverse[7*B+l] = mask * (-1.0*minor5/safeDet);
+    inverse[8*B+l] = mask * (minor8/safeDet);
+  }
+
+  return numSingular > 0 ? 1 : 0;
+}
+
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ ScalarT alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result
+)
+{
+  // Same operation and summation order as MatrixMultiply(), applied lane by lane
+  const int B = TENSOR_BATCH_SIZE;
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      // a(i,k) and b(k,j) for k = 0, 1, 2
+      const ScalarT* a0 = a + B*(transA ? i : 3*i);
+      const ScalarT* a1 = a + B*(transA ? 3+i : 3*i+1);
+      const ScalarT* a2 = a + B*(transA ? 6+i : 3*i+2);
+      const ScalarT* b0 = b + B*(transB ? 3*j : j);
+      const ScalarT* b1 = b + B*(transB ? 3*j+1 : 3+j);
+      const ScalarT* b2 = b + B*(transB ? 3*j+2 : 6+j);
+      ScalarT* r = result + B*(3*i+j);
+      for(int l=0 ; l<B ; ++l)
+        r[l] = a0[l] * b0[l] + a1[l] * b1[l] + a2[l] * b2[l];
+    }
+  }
+
+  if(alpha != 1.0){
+    for(int i=0 ; i<9*B ; ++i)
+      result[i] *= alpha;
+  }
+}
+
+template<typename ScalarT>
+int computeFirstPiolaKirchhoffStressShapeTensorInverseProduct
+(
+const ScalarT* deformationGradient,
+const ScalarT* cauchyStress,
+const ScalarT* shapeTensorInverse,
+ScalarT* result,
+int numPoints
+)
+{
+  const int B = TENSOR_BATCH_SIZE;
+  int returnCode = 0;
+
+  ScalarT defGrad[9*B], stress[9*B], shapeTensorInv[9*B];
+  ScalarT defGradInv[9*B], piolaStress[9*B], product[9*B];
+  ScalarT jacobianDeterminant[B];
+
+  for(int iID=0 ; iID<numPoints ; iID+=B){
+
+    int numBatchPoints = numPoints - iID < B ? numPoints - iID : B;
+
+    loadTensorBatch(deformationGradient + 9*iID, numBatchPoints, defGrad);
+    loadTensorBatch(cauchyStress + 9*iID, numBatchPoints, stress);
+    loadTensorBatch(shapeTensorInverse + 9*iID, numBatchPoints, shapeTensorInv);
+
+    // Invert the deformation gradient and store the determinant
+    if(Invert3by3MatrixBatch(defGrad, jacobianDeterminant, defGradInv) > 0)
+      returnCode = 1;
+
+    // P = J * \sigma * F^(-T)
+    MatrixMultiplyBatch(false, true, ScalarT(1.0), stress, defGradInv, piolaStress);
+    for(int c=0 ; c<9 ; ++c){
+      for(int l=0 ; l<B ; ++l)
+        piolaStress[c*B+l] *= jacobianDeterminant[l];
+    }
+
+    // Inner product of Piola stress and the inverse of the shape tensor
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), piolaStress, shapeTensorInv, product);
+
+    storeTensorBatch(product, numBatchPoints, result + 9*iID);
+  }
+
+  return returnCode;
+}
+
 template<typename ScalarT>
 int computeShapeTensorInverseAndApproximateDeformationGradient
 (
@@ -320,24 +485,15 @@ int numPoints
   return returnCode;
 }
 
-//Performs kinematic computations following Flanagan and Taylor (1987), returns
-//unrotated rate-of-deformation and rotation tensors
 template<typename ScalarT>
-int computeUnrotatedRateOfDeformationAndRotationTensor(
+int computeShapeTensorInverse
+(
 const double* volume,
 const double* horizon,
 const double* modelCoordinates,
-const ScalarT* velocities,
-const ScalarT* deformationGradient,
-const ScalarT* shapeTensorInverse,
-const ScalarT* leftStretchTensorN,
-const ScalarT* rotationTensorN,
-ScalarT* leftStretchTensorNP1,
-ScalarT* rotationTensorNP1,
-ScalarT* unrotatedRateOfDeformation,
+ScalarT* shapeTensorInverse,
 const int* neighborhoodList,
-int numPoints,
-double dt
+int numPoints
 )
 {
   int returnCode = 0;
@@ -345,64 +501,114 @@ double dt
   const double* delta = horizon;
   const double* modelCoord = modelCoordinates;
   const double* neighborModelCoord;
-  const ScalarT* vel = velocities;
-  const ScalarT* neighborVel;
-  const ScalarT* defGrad = deformationGradient;
-  const ScalarT* shapeTensorInv = shapeTensorInverse;
-  const ScalarT* leftStretchN = leftStretchTensorN;
-  const ScalarT* rotTensorN = rotationTensorN;
-
-  ScalarT* leftStretchNP1 = leftStretchTensorNP1;
-  ScalarT* rotTensorNP1 = rotationTensorNP1;
-  ScalarT* unrotRateOfDef = unrotatedRateOfDeformation;
-
-  std::vector<ScalarT> FdotFirstTermVector(9) ; ScalarT* FdotFirstTerm = &FdotFirstTermVector[0];
-  std::vector<ScalarT> FdotVector(9) ; ScalarT* Fdot = &FdotVector[0];
-  std::vector<ScalarT> FinverseVector(9) ; ScalarT* Finverse = &FinverseVector[0];
-  std::vector<ScalarT> eulerianVelGradVector(9) ; ScalarT* eulerianVelGrad = &eulerianVelGradVector[0];
-  std::vector<ScalarT> rateOfDefVector(9) ; ScalarT* rateOfDef = &rateOfDefVector[0];
-  std::vector<ScalarT> spinVector(9) ; ScalarT* spin = &spinVector[0];
-  std::vector<ScalarT> tempVector(9) ; ScalarT* temp = &tempVector[0];
-  std::vector<ScalarT> tempInvVector(9) ; ScalarT* tempInv = &tempInvVector[0];
-  std::vector<ScalarT> OmegaTensorVector(9) ; ScalarT* OmegaTensor = &OmegaTensorVector[0];
-  std::vector<ScalarT> QMatrixVector(9) ; ScalarT* QMatrix = &QMatrixVector[0];
-  std::vector<ScalarT> OmegaTensorSqVector(9) ; ScalarT* OmegaTensorSq = &OmegaTensorSqVector[0];
-  std::vector<ScalarT> tempAVector(9) ; ScalarT* tempA = &tempAVector[0];
-  std::vector<ScalarT> tempBVector(9) ; ScalarT* tempB = &tempBVector[0];
-  std::vector<ScalarT> rateOfStretchVector(9) ; ScalarT* rateOfStretch = &rateOfStretchVector[0];
-
-  ScalarT determinant;
-  ScalarT omegaX, omegaY, omegaZ;
-  ScalarT zX, zY, zZ;
-  ScalarT wX, wY, wZ;
-  ScalarT velStateX, velStateY, velStateZ;
-  ScalarT traceV, Omega, OmegaSq, scaleFactor1, scaleFactor2;
+  ScalarT* shapeTensorInv = shapeTensorInverse;
+
   double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  double neighborVolume, omega, scalarTemp; 
+  double neighborVolume, omega, temp;
+
+  std::vector<ScalarT> shapeTensorVector(9);
+  ScalarT* shapeTensor = &shapeTensorVector[0];
+  ScalarT shapeTensorDeterminant;
+
+  // placeholder for bond damage
+  double bondDamage = 0.0;
+
   int inversionReturnCode(0);
 
+  int neighborIndex, numNeighbors;
+  const int *neighborListPtr = neighborhoodList;
+  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, shapeTensorInv+=9){
+
+    // Zero out data
+    *(shapeTensor)   = 0.0 ; *(shapeTensor+1) = 0.0 ; *(shapeTensor+2) = 0.0 ;
+    *(shapeTensor+3) = 0.0 ; *(shapeTensor+4) = 0.0 ; *(shapeTensor+5) = 0.0 ;
+    *(shapeTensor+6) = 0.0 ; *(shapeTensor+7) = 0.0 ; *(shapeTensor+8) = 0.0 ;
+
+    numNeighbors = *neighborListPtr; neighborListPtr++;
+    for(int n=0; n<numNeighbors; n++, neighborListPtr++){
+
+      neighborIndex = *neighborListPtr;
+      neighborVolume = volume[neighborIndex];
+      neighborModelCoord = modelCoordinates + 3*neighborIndex;
+
+      undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
+      undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
+      undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
+      undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
+                                  undeformedBondY*undeformedBondY +
+                                  undeformedBondZ*undeformedBondZ);
+
+      omega = MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
+
+      temp = (1.0 - bondDamage) * omega * neighborVolume;
+
+      *(shapeTensor)   += temp * undeformedBondX * undeformedBondX;
+      *(shapeTensor+1) += temp * undeformedBondX * undeformedBondY;
+      *(shapeTensor+2) += temp * undeformedBondX * undeformedBondZ;
+      *(shapeTensor+3) += temp * undeformedBondY * undeformedBondX;
+      *(shapeTensor+4) += temp * undeformedBondY * undeformedBondY;
+      *(shapeTensor+5) += temp * undeformedBondY * undeformedBondZ;
+      *(shapeTensor+6) += temp * undeformedBondZ * undeformedBondX;
+      *(shapeTensor+7) += temp * undeformedBondZ * undeformedBondY;
+      *(shapeTensor+8) += temp * undeformedBondZ * undeformedBondZ;
+    }
+
+    inversionReturnCode = Invert3by3Matrix(shapeTensor, shapeTensorDeterminant, shapeTensorInv);
+    if(inversionReturnCode > 0)
+      returnCode = inversionReturnCode;
+  }
+
+  return returnCode;
+}
+
+template<typename ScalarT>
+void computeApproximateDeformationGradient
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
+const int* neighborhoodList,
+int numPoints
+)
+{
+  const double* delta = horizon;
+  const double* modelCoord = modelCoordinates;
+  const double* neighborModelCoord;
+  const ScalarT* coord = coordinates;
+  const ScalarT* neighborCoord;
+  const ScalarT* shapeTensorInv = shapeTensorInverse;
+  ScalarT* defGrad = deformationGradient;
+
+  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
+  ScalarT deformedBondX, deformedBondY, deformedBondZ;
+  double neighborVolume, omega, temp;
+
+  std::vector<ScalarT> defGradFirstTermVector(9);
+  ScalarT* defGradFirstTerm = &defGradFirstTermVector[0];
+
   // placeholder for bond damage
   double bondDamage = 0.0;
 
   int neighborIndex, numNeighbors;
   const int *neighborListPtr = neighborhoodList;
-  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, vel+=3,
-        shapeTensorInv+=9, rotTensorN+=9, rotTensorNP1+=9, leftStretchNP1+=9, leftStretchN+=9,
-        unrotRateOfDef+=9, defGrad+=9){
+  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, coord+=3,
+        shapeTensorInv+=9, defGrad+=9){
+
+    // Zero out data
+    *(defGradFirstTerm)   = 0.0 ; *(defGradFirstTerm+1) = 0.0 ; *(defGradFirstTerm+2) = 0.0 ;
+    *(defGradFirstTerm+3) = 0.0 ; *(defGradFirstTerm+4) = 0.0 ; *(defGradFirstTerm+5) = 0.0 ;
+    *(defGradFirstTerm+6) = 0.0 ; *(defGradFirstTerm+7) = 0.0 ; *(defGradFirstTerm+8) = 0.0 ;
 
-    // Initialize data
-    *(FdotFirstTerm)   = 0.0 ; *(FdotFirstTerm+1) = 0.0 ;  *(FdotFirstTerm+2) = 0.0;
-    *(FdotFirstTerm+3) = 0.0 ; *(FdotFirstTerm+4) = 0.0 ;  *(FdotFirstTerm+5) = 0.0;
-    *(FdotFirstTerm+6) = 0.0 ; *(FdotFirstTerm+7) = 0.0 ;  *(FdotFirstTerm+8) = 0.0;
-    
-    //Compute Fdot
     numNeighbors = *neighborListPtr; neighborListPtr++;
     for(int n=0; n<numNeighbors; n++, neighborListPtr++){
 
       neighborIndex = *neighborListPtr;
       neighborVolume = volume[neighborIndex];
       neighborModelCoord = modelCoordinates + 3*neighborIndex;
-      neighborVel = velocities + 3*neighborIndex;
+      neighborCoord = coordinates + 3*neighborIndex;
 
       undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
       undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
@@ -411,60 +617,184 @@ double dt
                                   undeformedBondY*undeformedBondY +
                                   undeformedBondZ*undeformedBondZ);
 
-      // The velState is the relative difference in velocities of the nodes at
-      // each end of a bond. i.e., v_j - v_i
-      velStateX = *(neighborVel)   - *(vel);
-      velStateY = *(neighborVel+1) - *(vel+1);
-      velStateZ = *(neighborVel+2) - *(vel+2);
+      deformedBondX = *(neighborCoord)   - *(coord);
+      deformedBondY = *(neighborCoord+1) - *(coord+1);
+      deformedBondZ = *(neighborCoord+2) - *(coord+2);
 
       omega = MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
 
-      scalarTemp = (1.0 - bondDamage) * omega * neighborVolume;
-
-      *(FdotFirstTerm)   += scalarTemp * velStateX * undeformedBondX;
-      *(FdotFirstTerm+1) += scalarTemp * velStateX * undeformedBondY;
-      *(FdotFirstTerm+2) += scalarTemp * velStateX * undeformedBondZ;
-      *(FdotFirstTerm+3) += scalarTemp * velStateY * undeformedBondX;
-      *(FdotFirstTerm+4) += scalarTemp * velStateY * undeformedBondY;
-      *(FdotFirstTerm+5) += scalarTemp * velStateY * undeformedBondZ;
-      *(FdotFirstTerm+6) += scalarTemp * velStateZ * undeformedBondX;
-      *(FdotFirstTerm+7) += scalarTemp * velStateZ * undeformedBondY;
-      *(FdotFirstTerm+8) += scalarTemp * velStateZ * undeformedBondZ;
+      temp = (1.0 - bondDamage) * omega * neighborVolume;
+
+      *(defGradFirstTerm)   += temp * deformedBondX * undeformedBondX;
+      *(defGradFirstTerm+1) += temp * deformedBondX * undeformedBondY;
+      *(defGradFirstTerm+2) += temp * deformedBondX * undeformedBondZ;
+      *(defGradFirstTerm+3) += temp * deformedBondY * undeformedBondX;
+      *(defGradFirstTerm+4) += temp * deformedBondY * undeformedBondY;
+      *(defGradFirstTerm+5) += temp * deformedBondY * undeformedBondZ;
+      *(defGradFirstTerm+6) += temp * deformedBondZ * undeformedBondX;
+      *(defGradFirstTerm+7) += temp * deformedBondZ * undeformedBondY;
+      *(defGradFirstTerm+8) += temp * deformedBondZ * undeformedBondZ;
+    }
+
+    // Matrix multiply the first term and the shape tensor inverse to compute
+    // the deformation gradient
+    MatrixMultiply(false, false, 1.0, defGradFirstTerm, shapeTensorInv, defGrad);
+  }
+}
+
+//Performs kinematic computations following Flanagan and Taylor (1987), returns
+//unrotated rate-of-deformation and rotation tensors
+//
+//Points are processed in batches of TENSOR_BATCH_SIZE: the bond sums are accumulated
+//point by point, and the tensor algebra that follows is done on the whole batch.
+template<typename ScalarT>
+int computeUnrotatedRateOfDeformationAndRotationTensor(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* velocities,
+const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+const int* neighborhoodList,
+int numPoints,
+double dt
+)
+{
+  int returnCode = 0;
+
+  const int B = TENSOR_BATCH_SIZE;
+
+  const double* delta;
+  const double* modelCoord;
+  const double* neighborModelCoord;
+  const ScalarT* vel;
+  const ScalarT* neighborVel;
+
+  // Batched tensors, see loadTensorBatch()
+  ScalarT defGrad[9*B], shapeTensorInv[9*B], leftStretchN[9*B], rotTensorN[9*B];
+  ScalarT leftStretchNP1[9*B], rotTensorNP1[9*B], unrotRateOfDef[9*B];
+  ScalarT FdotFirstTerm[9*B], Fdot[9*B], Finverse[9*B], eulerianVelGrad[9*B];
+  ScalarT rateOfDef[9*B], spin[9*B], temp[9*B], tempInv[9*B];
+  ScalarT OmegaTensor[9*B], QMatrix[9*B], OmegaTensorSq[9*B];
+  ScalarT tempA[9*B], tempB[9*B];
+
+  // Batched scalars
+  ScalarT determinant[B];
+  ScalarT zX[B], zY[B], zZ[B];
+  ScalarT wX[B], wY[B], wZ[B];
+  ScalarT OmegaSq[B], scaleFactor1[B], scaleFactor2[B];
+
+  ScalarT omegaX, omegaY, omegaZ;
+  ScalarT traceV, Omega;
+  ScalarT velStateX, velStateY, velStateZ;
+  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
+  double neighborVolume, omega, scalarTemp; 
+  int inversionReturnCode(0);
+
+  // placeholder for bond damage
+  double bondDamage = 0.0;
+
+  int neighborIndex, numNeighbors;
+  const int *neighborListPtr = neighborhoodList;
+  for(int firstID=0 ; firstID<numPoints ; firstID+=B){
+
+    int numBatchPoints = numPoints - firstID < B ? numPoints - firstID : B;
+
+    // Initialize data
+    for(int i=0 ; i<9*B ; ++i)
+      FdotFirstTerm[i] = 0.0;
+
+    //Compute Fdot
+    for(int l=0 ; l<numBatchPoints ; ++l){
+
+      int iID = firstID + l;
+      delta = horizon + iID;
+      modelCoord = modelCoordinates + 3*iID;
+      vel = velocities + 3*iID;
+
+      numNeighbors = *neighborListPtr; neighborListPtr++;
+      for(int n=0; n<numNeighbors; n++, neighborListPtr++){
+
+        neighborIndex = *neighborListPtr;
+        neighborVolume = volume[neighborIndex];
+        neighborModelCoord = modelCoordinates + 3*neighborIndex;
+        neighborVel = velocities + 3*neighborIndex;
+
+        undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
+        undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
+        undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
+        undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
+                                    undeformedBondY*undeformedBondY +
+                                    undeformedBondZ*undeformedBondZ);
+
+        // The velState is the relative difference in velocities of the nodes at
+        // each end of a bond. i.e., v_j - v_i
+        velStateX = *(neighborVel)   - *(vel);
+        velStateY = *(neighborVel+1) - *(vel+1);
+        velStateZ = *(neighborVel+2) - *(vel+2);
+
+        omega = MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
+
+        scalarTemp = (1.0 - bondDamage) * omega * neighborVolume;
+
+        FdotFirstTerm[l]     += scalarTemp * velStateX * undeformedBondX;
+        FdotFirstTerm[B+l]   += scalarTemp * velStateX * undeformedBondY;
+        FdotFirstTerm[2*B+l] += scalarTemp * velStateX * undeformedBondZ;
+        FdotFirstTerm[3*B+l] += scalarTemp * velStateY * undeformedBondX;
+        FdotFirstTerm[4*B+l] += scalarTemp * velStateY * undeformedBondY;
+        FdotFirstTerm[5*B+l] += scalarTemp * velStateY * undeformedBondZ;
+        FdotFirstTerm[6*B+l] += scalarTemp * velStateZ * undeformedBondX;
+        FdotFirstTerm[7*B+l] += scalarTemp * velStateZ * undeformedBondY;
+        FdotFirstTerm[8*B+l] += scalarTemp * velStateZ * undeformedBondZ;
+      }
     }
 
+    loadTensorBatch(deformationGradient + 9*firstID, numBatchPoints, defGrad);
+    loadTensorBatch(shapeTensorInverse + 9*firstID, numBatchPoints, shapeTensorInv);
+    loadTensorBatch(leftStretchTensorN + 9*firstID, numBatchPoints, leftStretchN);
+    loadTensorBatch(rotationTensorN + 9*firstID, numBatchPoints, rotTensorN);
+
     // Compute Fdot
-    MatrixMultiply(false, false, 1.0, FdotFirstTerm, shapeTensorInv, Fdot);
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), FdotFirstTerm, shapeTensorInv, Fdot);
 
     // Compute the inverse of the deformation gradient, Finverse
-    inversionReturnCode = Invert3by3Matrix(defGrad, determinant, Finverse);
+    inversionReturnCode = Invert3by3MatrixBatch(defGrad, determinant, Finverse);
     if(inversionReturnCode > 0)
       returnCode = inversionReturnCode;
 
     // Compute the Eulerian velocity gradient L = Fdot * Finv
-    MatrixMultiply(false, false, 1.0, Fdot, Finverse, eulerianVelGrad);
-
-    // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
-    *(rateOfDef)   = *(eulerianVelGrad);
-    *(rateOfDef+1) = 0.5 * ( *(eulerianVelGrad+1) + *(eulerianVelGrad+3) );
-    *(rateOfDef+2) = 0.5 * ( *(eulerianVelGrad+2) + *(eulerianVelGrad+6) );
-    *(rateOfDef+3) = *(rateOfDef+1);
-    *(rateOfDef+4) = *(eulerianVelGrad+4);
-    *(rateOfDef+5) = 0.5 * ( *(eulerianVelGrad+5) + *(eulerianVelGrad+7) );
-    *(rateOfDef+6) = *(rateOfDef+2);
-    *(rateOfDef+7) = *(rateOfDef+5);
-    *(rateOfDef+8) = *(eulerianVelGrad+8);
-
-    // Compute spin tensor, W = 1/2 * (L - Lt)
-    *(spin)   = 0.0;
-    *(spin+1) = 0.5 * ( *(eulerianVelGrad+1) - *(eulerianVelGrad+3) );
-    *(spin+2) = 0.5 * ( *(eulerianVelGrad+2) - *(eulerianVelGrad+6) );
-    *(spin+3) = -1.0 * *(spin+1);
-    *(spin+4) = 0.0;
-    *(spin+5) = 0.5 * ( *(eulerianVelGrad+5) - *(eulerianVelGrad+7) );
-    *(spin+6) = -1.0 * *(spin+2);
-    *(spin+7) = -1.0 * *(spin+5);
-    *(spin+8) = 0.0;
-   
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), Fdot, Finverse, eulerianVelGrad);
+
+    for(int l=0 ; l<B ; ++l){
+
+      // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
+      rateOfDef[l]     = eulerianVelGrad[l];
+      rateOfDef[B+l]   = 0.5 * ( eulerianVelGrad[B+l] + eulerianVelGrad[3*B+l] );
+      rateOfDef[2*B+l] = 0.5 * ( eulerianVelGrad[2*B+l] + eulerianVelGrad[6*B+l] );
+      rateOfDef[3*B+l] = rateOfDef[B+l];
+      rateOfDef[4*B+l] = eulerianVelGrad[4*B+l];
+      rateOfDef[5*B+l] = 0.5 * ( eulerianVelGrad[5*B+l] + eulerianVelGrad[7*B+l] );
+      rateOfDef[6*B+l] = rateOfDef[2*B+l];
+      rateOfDef[7*B+l] = rateOfDef[5*B+l];
+      rateOfDef[8*B+l] = eulerianVelGrad[8*B+l];
+
+      // Compute spin tensor, W = 1/2 * (L - Lt)
+      spin[l]     = 0.0;
+      spin[B+l]   = 0.5 * ( eulerianVelGrad[B+l] - eulerianVelGrad[3*B+l] );
+      spin[2*B+l] = 0.5 * ( eulerianVelGrad[2*B+l] - eulerianVelGrad[6*B+l] );
+      spin[3*B+l] = -1.0 * spin[B+l];
+      spin[4*B+l] = 0.0;
+      spin[5*B+l] = 0.5 * ( eulerianVelGrad[5*B+l] - eulerianVelGrad[7*B+l] );
+      spin[6*B+l] = -1.0 * spin[2*B+l];
+      spin[7*B+l] = -1.0 * spin[5*B+l];
+      spin[8*B+l] = 0.0;
+    }
+
     //Following Flanagan & Taylor (T&F) 
     //
     //Find the vector z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
@@ -473,57 +803,64 @@ double dt
     //
     //Components below copied from computer algebra solution to the expansion
     //above
-    
-    
-    zX = - *(leftStretchN+2) *  *(rateOfDef+3) -  *(leftStretchN+5) *  *(rateOfDef+4) - 
-           *(leftStretchN+8) *  *(rateOfDef+5) +  *(leftStretchN+1) *  *(rateOfDef+6) + 
-           *(leftStretchN+4) *  *(rateOfDef+7) +  *(leftStretchN+7) *  *(rateOfDef+8);
-    zY =   *(leftStretchN+2) *  *(rateOfDef)   +  *(leftStretchN+5) *  *(rateOfDef+1) + 
-           *(leftStretchN+8) *  *(rateOfDef+2) -  *(leftStretchN)   *  *(rateOfDef+6) - 
-           *(leftStretchN+3) *  *(rateOfDef+7) -  *(leftStretchN+6) *  *(rateOfDef+8);
-    zZ = - *(leftStretchN+1) *  *(rateOfDef)   -  *(leftStretchN+4) *  *(rateOfDef+1) - 
-           *(leftStretchN+7) *  *(rateOfDef+2) +  *(leftStretchN)   *  *(rateOfDef+3) + 
-           *(leftStretchN+3) *  *(rateOfDef+4) +  *(leftStretchN+6) *  *(rateOfDef+5);
-
-    //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
-    wX = 0.5 * ( *(spin+7) - *(spin+5) );
-    wY = 0.5 * ( *(spin+2) - *(spin+6) );
-    wZ = 0.5 * ( *(spin+3) - *(spin+1) );
-
-    //Find trace(V)
-    traceV = *(leftStretchN) + *(leftStretchN+4) + *(leftStretchN+8);
-
-    // Compute (trace(V) * I - V) store in temp
-    *(temp)   = traceV - *(leftStretchN);
-    *(temp+1) = - *(leftStretchN+1);
-    *(temp+2) = - *(leftStretchN+2);
-    *(temp+3) = - *(leftStretchN+3);
-    *(temp+4) = traceV - *(leftStretchN+4);
-    *(temp+5) = - *(leftStretchN+5);
-    *(temp+6) = - *(leftStretchN+6);
-    *(temp+7) = - *(leftStretchN+7);
-    *(temp+8) = traceV - *(leftStretchN+8);
+    for(int l=0 ; l<B ; ++l){
+
+      zX[l] = - leftStretchN[2*B+l] * rateOfDef[3*B+l] - leftStretchN[5*B+l] * rateOfDef[4*B+l] - 
+                leftStretchN[8*B+l] * rateOfDef[5*B+l] + leftStretchN[B+l]   * rateOfDef[6*B+l] + 
+                leftStretchN[4*B+l] * rateOfDef[7*B+l] + leftStretchN[7*B+l] * rateOfDef[8*B+l];
+      zY[l] =   leftStretchN[2*B+l] * rateOfDef[l]     + leftStretchN[5*B+l] * rateOfDef[B+l] + 
+                leftStretchN[8*B+l] * rateOfDef[2*B+l] - leftStretchN[l]     * rateOfDef[6*B+l] - 
+                leftStretchN[3*B+l] * rateOfDef[7*B+l] - leftStretchN[6*B+l] * rateOfDef[8*B+l];
+      zZ[l] = - leftStretchN[B+l]   * rateOfDef[l]     - leftStretchN[4*B+l] * rateOfDef[B+l] - 
+                leftStretchN[7*B+l] * rateOfDef[2*B+l] + leftStretchN[l]     * rateOfDef[3*B+l] + 
+                leftStretchN[3*B+l] * rateOfDef[4*B+l] + leftStretchN[6*B+l] * rateOfDef[5*B+l];
+
+      //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
+      wX[l] = 0.5 * ( spin[7*B+l] - spin[5*B+l] );
+      wY[l] = 0.5 * ( spin[2*B+l] - spin[6*B+l] );
+      wZ[l] = 0.5 * ( spin[3*B+l] - spin[B+l] );
+
+      //Find trace(V)
+      traceV = leftStretchN[l] + leftStretchN[4*B+l] + leftStretchN[8*B+l];
+
+      // Compute (trace(V) * I - V) store in temp
+      temp[l]     = traceV - leftStretchN[l];
+      temp[B+l]   = - leftStretchN[B+l];
+      temp[2*B+l] = - leftStretchN[2*B+l];
+      temp[3*B+l] = - leftStretchN[3*B+l];
+      temp[4*B+l] = traceV - leftStretchN[4*B+l];
+      temp[5*B+l] = - leftStretchN[5*B+l];
+      temp[6*B+l] = - leftStretchN[6*B+l];
+      temp[7*B+l] = - leftStretchN[7*B+l];
+      temp[8*B+l] = traceV - leftStretchN[8*B+l];
+    }
 
     // Compute the inverse of the temp matrix
-    Invert3by3Matrix(temp, determinant, tempInv);
+    Invert3by3MatrixBatch(temp, determinant, tempInv);
     if(inversionReturnCode > 0)
       returnCode = inversionReturnCode;
 
-    //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
-    omegaX =  wX + *(tempInv)   * zX + *(tempInv+1) * zY + *(tempInv+2) * zZ;
-    omegaY =  wY + *(tempInv+3) * zX + *(tempInv+4) * zY + *(tempInv+5) * zZ;
-    omegaZ =  wZ + *(tempInv+6) * zX + *(tempInv+7) * zY + *(tempInv+8) * zZ;
-
-    //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
-    *(OmegaTensor) = 0.0;
-    *(OmegaTensor+1) = -omegaZ;
-    *(OmegaTensor+2) = omegaY;
-    *(OmegaTensor+3) = omegaZ;
-    *(OmegaTensor+4) = 0.0;
-    *(OmegaTensor+5) = -omegaX;
-    *(OmegaTensor+6) = -omegaY;
-    *(OmegaTensor+7) = omegaX;
-    *(OmegaTensor+8) = 0.0;
+    for(int l=0 ; l<B ; ++l){
+
+      //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
+      omegaX =  wX[l] + tempInv[l]     * zX[l] + tempInv[B+l]   * zY[l] + tempInv[2*B+l] * zZ[l];
+      omegaY =  wY[l] + tempInv[3*B+l] * zX[l] + tempInv[4*B+l] * zY[l] + tempInv[5*B+l] * zZ[l];
+      omegaZ =  wZ[l] + tempInv[6*B+l] * zX[l] + tempInv[7*B+l] * zY[l] + tempInv[8*B+l] * zZ[l];
+
+      //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
+      OmegaTensor[l]     = 0.0;
+      OmegaTensor[B+l]   = -omegaZ;
+      OmegaTensor[2*B+l] = omegaY;
+      OmegaTensor[3*B+l] = omegaZ;
+      OmegaTensor[4*B+l] = 0.0;
+      OmegaTensor[5*B+l] = -omegaX;
+      OmegaTensor[6*B+l] = -omegaY;
+      OmegaTensor[7*B+l] = omegaX;
+      OmegaTensor[8*B+l] = 0.0;
+
+      // Omega^2 = w_i * w_i (T&F Eq. 42)
+      OmegaSq[l] = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
+    }
 
     //Increment R with (T&F Eq. 36 and 44) as opposed to solving (T&F 39) this
     //is desirable for accuracy in implicit solves and has no effect on
@@ -531,58 +868,55 @@ double dt
     //
     // Compute Q with (T&F Eq. 44)
     //
-    // Omega^2 = w_i * w_i (T&F Eq. 42)
-    OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
-    // Omega = \sqrt{OmegaSq}
-    Omega = sqrt(OmegaSq);
-
-    // Avoid a potential divide-by-zero
-    if ( OmegaSq > 1.e-30){
-
-      // Compute Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
-      //           = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
-      scaleFactor1 = sin(dt*Omega) / Omega;
-      scaleFactor2 = -(1.0 - cos(dt*Omega)) / OmegaSq;
-      MatrixMultiply(false, false, 1.0, OmegaTensor, OmegaTensor, OmegaTensorSq);
-      *(QMatrix)   = 1.0 + scaleFactor1 * *(OmegaTensor)   + scaleFactor2 * *(OmegaTensorSq)   ;
-      *(QMatrix+1) =       scaleFactor1 * *(OmegaTensor+1) + scaleFactor2 * *(OmegaTensorSq+1) ;
-      *(QMatrix+2) =       scaleFactor1 * *(OmegaTensor+2) + scaleFactor2 * *(OmegaTensorSq+2) ;
-      *(QMatrix+3) =       scaleFactor1 * *(OmegaTensor+3) + scaleFactor2 * *(OmegaTensorSq+3) ;
-      *(QMatrix+4) = 1.0 + scaleFactor1 * *(OmegaTensor+4) + scaleFactor2 * *(OmegaTensorSq+4) ;
-      *(QMatrix+5) =       scaleFactor1 * *(OmegaTensor+5) + scaleFactor2 * *(OmegaTensorSq+5) ;
-      *(QMatrix+6) =       scaleFactor1 * *(OmegaTensor+6) + scaleFactor2 * *(OmegaTensorSq+6) ;
-      *(QMatrix+7) =       scaleFactor1 * *(OmegaTensor+7) + scaleFactor2 * *(OmegaTensorSq+7) ;
-      *(QMatrix+8) = 1.0 + scaleFactor1 * *(OmegaTensor+8) + scaleFactor2 * *(OmegaTensorSq+8) ;
-
-    } else {
-      *(QMatrix)   = 1.0 ; *(QMatrix+1) = 0.0 ; *(QMatrix+2) = 0.0 ;
-      *(QMatrix+3) = 0.0 ; *(QMatrix+4) = 1.0 ; *(QMatrix+5) = 0.0 ;
-      *(QMatrix+6) = 0.0 ; *(QMatrix+7) = 0.0 ; *(QMatrix+8) = 1.0 ;
-    };
+    // Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
+    //   = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
+    //
+    // Lanes with a vanishing Omega (potential divide-by-zero) are masked to Q = I.
+    for(int l=0 ; l<B ; ++l){
+      if(OmegaSq[l] > 1.e-30){
+        Omega = sqrt(OmegaSq[l]);
+        scaleFactor1[l] = sin(dt*Omega) / Omega;
+        scaleFactor2[l] = -(1.0 - cos(dt*Omega)) / OmegaSq[l];
+      }
+      else{
+        scaleFactor1[l] = 0.0;
+        scaleFactor2[l] = 0.0;
+      }
+    }
+
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), OmegaTensor, OmegaTensor, OmegaTensorSq);
+
+    for(int c=0 ; c<9 ; ++c){
+      double identity = (c%4 == 0) ? 1.0 : 0.0;
+      for(int l=0 ; l<B ; ++l){
+        ScalarT q = identity + scaleFactor1[l] * OmegaTensor[c*B+l] + scaleFactor2[l] * OmegaTensorSq[c*B+l];
+        QMatrix[c*B+l] = (OmegaSq[l] > 1.e-30) ? q : ScalarT(identity);
+      }
+    }
 
     // Compute R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
-    MatrixMultiply(false, false, 1.0, QMatrix, rotTensorN, rotTensorNP1);
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), QMatrix, rotTensorN, rotTensorNP1);
 
     // Compute rate of stretch, Vdot = L*V - V*Omega
     // First tempA = L*V, 
-    MatrixMultiply(false, false, 1.0, eulerianVelGrad, leftStretchN, tempA);
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), eulerianVelGrad, leftStretchN, tempA);
 
     // tempB = V*Omega
-    MatrixMultiply(false, false, 1.0, leftStretchN, OmegaTensor, tempB);
-
-    //Vdot = tempA - tempB
-    for(int i=0 ; i<9 ; ++i)
-      *(rateOfStretch+i) = *(tempA+i) - *(tempB+i);
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), leftStretchN, OmegaTensor, tempB);
 
-    //V_STEP_NP1 = V_STEP_N + dt*Vdot
-    for(int i=0 ; i<9 ; ++i)
-      *(leftStretchNP1+i) = *(leftStretchN+i) + dt * *(rateOfStretch+i);
+    //V_STEP_NP1 = V_STEP_N + dt*Vdot, where Vdot = tempA - tempB
+    for(int i=0 ; i<9*B ; ++i)
+      leftStretchNP1[i] = leftStretchN[i] + dt * (tempA[i] - tempB[i]);
 
     // Compute the unrotated rate-of-deformation, d, i.e., temp = D * R
-    MatrixMultiply(false, false, 1.0, rateOfDef, rotTensorNP1, temp);
+    MatrixMultiplyBatch(false, false, ScalarT(1.0), rateOfDef, rotTensorNP1, temp);
 
     // d = Rt * temp
-    MatrixMultiply(true, false, 1.0, rotTensorNP1, temp, unrotRateOfDef);
+    MatrixMultiplyBatch(true, false, ScalarT(1.0), rotTensorNP1, temp, unrotRateOfDef);
+
+    storeTensorBatch(leftStretchNP1, numBatchPoints, leftStretchTensorNP1 + 9*firstID);
+    storeTensorBatch(rotTensorNP1, numBatchPoints, rotationTensorNP1 + 9*firstID);
+    storeTensorBatch(unrotRateOfDef, numBatchPoints, unrotatedRateOfDeformation + 9*firstID);
   }
 
   return returnCode;
@@ -764,18 +1098,23 @@ void rotateCauchyStress
  int numPoints
 )
 {
-  const ScalarT* rotTensor = rotationTensor;
-  const ScalarT* unrotatedStress = unrotatedCauchyStress;
-  ScalarT* rotatedStress = rotatedCauchyStress;
-  ScalarT temp[9];
+  const int B = TENSOR_BATCH_SIZE;
 
-  for(int iID=0 ; iID<numPoints ; ++iID, 
-        rotTensor+=9, unrotatedStress+=9, rotatedStress+=9){ 
+  ScalarT rotTensor[9*B], unrotatedStress[9*B], rotatedStress[9*B], temp[9*B];
+
+  for(int iID=0 ; iID<numPoints ; iID+=B){
+
+      int numBatchPoints = numPoints - iID < B ? numPoints - iID : B;
+
+      loadTensorBatch(rotationTensor + 9*iID, numBatchPoints, rotTensor);
+      loadTensorBatch(unrotatedCauchyStress + 9*iID, numBatchPoints, unrotatedStress);
 
       // temp = \sigma_unrot * Rt
-      CORRESPONDENCE::MatrixMultiply(false, true, 1.0, unrotatedStress, rotTensor, temp);
+      MatrixMultiplyBatch(false, true, ScalarT(1.0), unrotatedStress, rotTensor, temp);
       // \sigma_rot = R * temp
-      CORRESPONDENCE::MatrixMultiply(false, false, 1.0, rotTensor, temp, rotatedStress);
+      MatrixMultiplyBatch(false, false, ScalarT(1.0), rotTensor, temp, rotatedStress);
+
+      storeTensorBatch(rotatedStress, numBatchPoints, rotatedCauchyStress + 9*iID);
   }
 }
 
@@ -798,6 +1137,46 @@ template void MatrixMultiply<double>
  double* result
 );
 
+template void loadTensorBatch<double>
+(
+ const double* tensors,
+ int numPoints,
+ double* batch
+);
+
+template void storeTensorBatch<double>
+(
+ const double* batch,
+ int numPoints,
+ double* tensors
+);
+
+template int Invert3by3MatrixBatch<double>
+(
+ const double* matrix,
+ double* determinant,
+ double* inverse
+);
+
+template void MatrixMultiplyBatch<double>
+(
+ bool transA,
+ bool transB,
+ double alpha,
+ const double* a,
+ const double* b,
+ double* result
+);
+
+template int computeFirstPiolaKirchhoffStressShapeTensorInverseProduct<double>
+(
+const double* deformationGradient,
+const double* cauchyStress,
+const double* shapeTensorInverse,
+double* result,
+int numPoints
+);
+
 template void rotateCauchyStress<double>
 (
  const double* rotationTensor,
@@ -825,6 +1204,28 @@ const int* neighborhoodList,
 int numPoints
 );
 
+template int computeShapeTensorInverse<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+double* shapeTensorInverse,
+const int* neighborhoodList,
+int numPoints
+);
+
+template void computeApproximateDeformationGradient<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const double* coordinates,
+const double* shapeTensorInverse,
+double* deformationGradient,
+const int* neighborhoodList,
+int numPoints
+);
+
 template int computeUnrotatedRateOfDeformationAndRotationTensor<double>
 (
 const double* volume,
@@ -79,6 +79,58 @@ void MatrixMultiply
  ScalarT* result
 );
 
+//! Number of material points processed together by the batched tensor kernels.
+const int TENSOR_BATCH_SIZE = 8;
+
+//! @name Batched 3-by-3 tensor kernels.
+//!
+//! A batch holds TENSOR_BATCH_SIZE tensors in structure-of-arrays order: component c of
+//! the tensor in lane l is stored at batch[c*TENSOR_BATCH_SIZE + l].  The lane loops are
+//! written so that the compiler can vectorize them; singular cases are handled with
+//! per-lane selects rather than branches.
+//@{
+
+//! Gather numPoints (at most TENSOR_BATCH_SIZE) row-major tensors into a batch; unused lanes are set to the identity.
+template<typename ScalarT>
+void loadTensorBatch
+(
+ const ScalarT* tensors,
+ int numPoints,
+ ScalarT* batch
+);
+
+//! Scatter the first numPoints lanes of a batch into row-major tensors.
+template<typename ScalarT>
+void storeTensorBatch
+(
+ const ScalarT* batch,
+ int numPoints,
+ ScalarT* tensors
+);
+
+//! Batched Invert3by3Matrix(); singular lanes receive a zero inverse.  Returns one if any lane is singular.
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse
+);
+
+//! Batched MatrixMultiply(); the result may not alias a or b.
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ ScalarT alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result
+);
+
+//@}
+
 template<typename ScalarT>
 void rotateCauchyStress
 (
@@ -101,6 +153,44 @@ const int* neighborhoodList,
 int numPoints
 );
 
+//! Compute the inverse of the shape tensor, which depends only on the reference configuration.
+template<typename ScalarT>
+int computeShapeTensorInverse
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+ScalarT* shapeTensorInverse,
+const int* neighborhoodList,
+int numPoints
+);
+
+//! Compute the approximate deformation gradient from a previously computed shape tensor inverse.
+template<typename ScalarT>
+void computeApproximateDeformationGradient
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
+const int* neighborhoodList,
+int numPoints
+);
+
+//! Compute J * sigma * F^(-T) * K^(-1) for each point, the product of the first Piola-Kirchhoff stress
+//! and the shape tensor inverse; returns one if any deformation gradient is singular.
+template<typename ScalarT>
+int computeFirstPiolaKirchhoffStressShapeTensorInverseProduct
+(
+const ScalarT* deformationGradient,
+const ScalarT* cauchyStress,
+const ScalarT* shapeTensorInverse,
+ScalarT* result,
+int numPoints
+);
+
 // Calculation of stretch rates following Flanagan & Taylor
 template<typename ScalarT>
 int computeUnrotatedRateOfDeformationAndRotationTensor(
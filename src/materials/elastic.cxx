@@ -47,6 +47,7 @@
 
 #include <cmath>
 #include <Sacado.hpp>
+#include "neighborhood_fad.h"
 #include "elastic.h"
 #include "material_utilities.h"
 
@@ -145,6 +146,190 @@ void computeInternalForceLinearElastic
 	}
 }
 
+void computeDilatationAndInternalForceLinearElastic
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA,
+		double thermalExpansionCoefficient,
+		const double* deltaTemperature
+)
+{
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+
+	const double *xOwned = xOverlap;
+	const double *yOwned = yOverlap;
+	const double *m = mOwned;
+	const double *v = volumeOverlap;
+	double *theta = dilatationOwned;
+	double *fOwned = fInternalOverlap;
+
+	const int *neighPtr = localNeighborList;
+	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++){
+
+		int numNeigh = *neighPtr;
+
+		/*
+		 * First sweep: dilatation, caching the bond quantities
+		 */
+		*theta = computeDilatationAndCacheBonds(neighPtr,xOwned,yOwned,xOverlap,yOverlap,v,bondDamage,*m,horizon,bonds,OMEGA,
+		                                        thermalExpansionCoefficient,deltaTemperature ? deltaTemperature+p : 0);
+		neighPtr++;
+		bondDamage += numNeigh;
+
+		/*
+		 * Second sweep: force state, from the cached bond quantities
+		 */
+		const double *zeta = &bonds.zeta[0];
+		const double *e = &bonds.extension[0];
+		const double *dY = &bonds.dY[0];
+		const double *Y_dx = &bonds.dx_Y[0];
+		const double *Y_dy = &bonds.dy_Y[0];
+		const double *Y_dz = &bonds.dz_Y[0];
+		const double *omega = &bonds.omega[0];
+		const double *cellVolume = &bonds.volume[0];
+		const double *intact = &bonds.intact[0];
+		double alpha = 15.0*MU/(*m);
+		double selfCellVolume = v[p];
+		for(int n=0;n<numNeigh;n++,neighPtr++){
+			int localId = *neighPtr;
+			double c1 = omega[n]*(*theta)*(3.0*K/(*m)-alpha/3.0);
+			double t = intact[n]*(c1 * zeta[n] + intact[n] * omega[n] * alpha * e[n]);
+			double fx = t * Y_dx[n] / dY[n];
+			double fy = t * Y_dy[n] / dY[n];
+			double fz = t * Y_dz[n] / dY[n];
+
+			*(fOwned+0) += fx*cellVolume[n];
+			*(fOwned+1) += fy*cellVolume[n];
+			*(fOwned+2) += fz*cellVolume[n];
+			fInternalOverlap[3*localId+0] -= fx*selfCellVolume;
+			fInternalOverlap[3*localId+1] -= fy*selfCellVolume;
+			fInternalOverlap[3*localId+2] -= fz*selfCellVolume;
+		}
+	}
+}
+
+void computeTangentStiffnessLinearElastic
+(
+		int p,
+		const int* neighPtr,
+		const double* xOverlap,
+		const double* yOverlap,
+		double weightedVolume,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double** tangent,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA,
+		double thermalExpansionCoefficient,
+		const double* deltaTemperature
+)
+{
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+	int numNeigh = *neighPtr;
+	int numDof = 3*(numNeigh+1);
+
+	double theta = computeDilatationAndCacheBonds(neighPtr,&xOverlap[3*p],&yOverlap[3*p],xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,OMEGA,
+	                                              thermalExpansionCoefficient,deltaTemperature ? deltaTemperature+p : 0);
+
+	const double *zeta = &bonds.zeta[0];
+	const double *e = &bonds.extension[0];
+	const double *dY = &bonds.dY[0];
+	const double *Y_dx = &bonds.dx_Y[0];
+	const double *Y_dy = &bonds.dy_Y[0];
+	const double *Y_dz = &bonds.dz_Y[0];
+	const double *omega = &bonds.omega[0];
+	const double *cellVolume = &bonds.volume[0];
+	const double *intact = &bonds.intact[0];
+	double alpha = 15.0*MU/weightedVolume;
+	double kappa = 3.0*K/weightedVolume-alpha/3.0;
+	double selfCellVolume = volumeOverlap[p];
+
+	for(int row=0 ; row<numDof ; ++row)
+		for(int col=0 ; col<numDof ; ++col)
+			tangent[row][col] = 0.0;
+
+	/*
+	 * With u_j the deformed bond vector, M_j = u_j/|u_j|, and t_j the scalar force state,
+	 * the bond force t_j*M_j varies with the deformed bonds as
+	 *   d(t_j M_j)/du_k = a_j b_k^T + delta_jk D_j
+	 * where the rank-one term comes from the dilatation,
+	 *   a_j = d_j omega_j zeta_j kappa M_j,   b_k = 3 d_k omega_k zeta_k V_k M_k / m,
+	 * and D_j = d_j^2 omega_j alpha M_j M_j^T + (t_j/|u_j|)(I - M_j M_j^T) is the bond's own stiffness.
+	 *
+	 * First pass: the bond blocks D_j, and the sums of the rank-one factors
+	 */
+	double Sa[3] = {0.0, 0.0, 0.0}, Sb[3] = {0.0, 0.0, 0.0};
+	for(int n=0;n<numNeigh;n++){
+		int N = 3*(n+1);
+		double M[3] = {Y_dx[n]/dY[n], Y_dy[n]/dY[n], Y_dz[n]/dY[n]};
+		double d = intact[n];
+		double c1 = omega[n]*theta*kappa;
+		double t = d*(c1 * zeta[n] + d * omega[n] * alpha * e[n]);
+		double A = d*omega[n]*zeta[n]*kappa;
+		double g = 3.0*omega[n]*d*zeta[n]*cellVolume[n]/weightedVolume;
+		double axial = d*d*omega[n]*alpha;
+		double transverse = t/dY[n];
+		double H = selfCellVolume*cellVolume[n];
+		for(int i=0 ; i<3 ; ++i){
+			Sa[i] += cellVolume[n]*A*M[i];
+			Sb[i] += g*M[i];
+			for(int j=0 ; j<3 ; ++j){
+				double D = (axial-transverse)*M[i]*M[j] + (i==j ? transverse : 0.0);
+				tangent[i][j]     -= H*D;
+				tangent[i][N+j]   += H*D;
+				tangent[N+i][j]   += H*D;
+				tangent[N+i][N+j] -= H*D;
+			}
+		}
+	}
+
+	/*
+	 * Second pass: the dilatation coupling between every pair of bonds
+	 */
+	for(int n=0;n<numNeigh;n++){
+		int N = 3*(n+1);
+		double A = intact[n]*omega[n]*zeta[n]*kappa/dY[n];
+		double a[3] = {A*Y_dx[n], A*Y_dy[n], A*Y_dz[n]};
+		double g = 3.0*omega[n]*intact[n]*zeta[n]*cellVolume[n]/(weightedVolume*dY[n]);
+		double b[3] = {g*Y_dx[n], g*Y_dy[n], g*Y_dz[n]};
+		double H = selfCellVolume*cellVolume[n];
+		for(int k=0;k<numNeigh;k++){
+			int L = 3*(k+1);
+			double gk = 3.0*omega[k]*intact[k]*zeta[k]*cellVolume[k]/(weightedVolume*dY[k]);
+			double bk[3] = {gk*Y_dx[k], gk*Y_dy[k], gk*Y_dz[k]};
+			for(int i=0 ; i<3 ; ++i)
+				for(int j=0 ; j<3 ; ++j)
+					tangent[N+i][L+j] -= H*a[i]*bk[j];
+		}
+		for(int i=0 ; i<3 ; ++i){
+			for(int j=0 ; j<3 ; ++j){
+				tangent[N+i][j] += H*a[i]*Sb[j];
+				tangent[i][N+j] += selfCellVolume*Sa[i]*b[j];
+			}
+		}
+	}
+	for(int i=0 ; i<3 ; ++i)
+		for(int j=0 ; j<3 ; ++j)
+			tangent[i][j] -= selfCellVolume*Sa[i]*Sb[j];
+}
+
 /** Explicit template instantiation for double. */
 template void computeInternalForceLinearElastic<double>
 (
@@ -185,4 +370,30 @@ template void computeInternalForceLinearElastic<Sacado::Fad::DFad<double> >
         const double* deltaTemperature
 );
 
+/** Explicit template instantiations for the statically sized AD types of neighborhood_fad.h. */
+#define INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC(ScalarT) \
+template void computeInternalForceLinearElastic<ScalarT > \
+( \
+		const double* xOverlap, \
+		const ScalarT* yOverlap, \
+		const double* mOwned, \
+		const double* volumeOverlap, \
+		const ScalarT* dilatationOwned, \
+		const double* bondDamage, \
+		ScalarT* fInternalOverlap, \
+		ScalarT* partialStressOverlap, \
+		const int*  localNeighborList, \
+		int numOwnedPoints, \
+		double BULK_MODULUS, \
+		double SHEAR_MODULUS, \
+        double horizon, \
+        double thermalExpansionCoefficient, \
+        const double* deltaTemperature \
+);
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC(NeighborhoodFad<32>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC(NeighborhoodFad<64>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC(NeighborhoodFad<128>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC(NeighborhoodFad<256>::type)
+#undef INSTANTIATE_COMPUTE_INTERNAL_FORCE_LINEAR_ELASTIC
+
 }
@@ -47,6 +47,8 @@
 #ifndef ELASTIC_H
 #define ELASTIC_H
 
+#include "material_utilities.h"
+
 namespace MATERIAL_EVALUATION {
 
 //! Computes contributions to the internal force resulting from owned points.
@@ -71,6 +73,61 @@ void computeInternalForceLinearElastic
 
 );
 
+/**
+ * Computes the dilatation of each owned point and its contributions to the internal force
+ * in a single sweep over its bonds.  The bond quantities computed for the dilatation are
+ * cached in 'bonds' and reused by the force loop, rather than recomputed from the coordinates,
+ * volumes, and bond damage as in computeDilatation() followed by computeInternalForceLinearElastic().
+ */
+void computeDilatationAndInternalForceLinearElastic
+(
+		const double* xOverlapPtr,
+		const double* yOverlapPtr,
+		const double* mOwned,
+		const double* volumeOverlapPtr,
+		const double* bondDamage,
+		double* dilatationOwned,
+		double* fInternalOverlapPtr,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+		double thermalExpansionCoefficient = 0,
+		const double* deltaTemperature = 0
+);
+
+/**
+ * Computes the tangent stiffness of the internal force due to the bonds of the owned point 'p',
+ * with respect to the current coordinates of 'p' and its neighbors.  The dilatation couples every
+ * pair of bonds, so the tangent is dense over the neighborhood.
+ * NOTE: neighPtr should point to 'numNeigh' for 'p'
+ * NOTE: bondDamage should point to the first bond of 'p'
+ * OUTPUT: tangent, the 3*(numNeigh+1) square matrix given by its row pointers, with rows and
+ * columns ordered as 'p' followed by its neighbors; each row is multiplied by the volume of its
+ * point, converting force density to force.  'bonds' is used as scratch space.
+ */
+void computeTangentStiffnessLinearElastic
+(
+		int p,
+		const int* neighPtr,
+		const double* xOverlapPtr,
+		const double* yOverlapPtr,
+		double weightedVolume,
+		const double* volumeOverlapPtr,
+		const double* bondDamage,
+		double** tangent,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+		double thermalExpansionCoefficient = 0,
+		const double* deltaTemperature = 0
+);
+
 }
 
 #endif // ELASTIC_H
@@ -117,6 +117,105 @@ void computeInternalForceElasticBondBased
   }
 }
 
+template<typename ScalarT>
+void computeInternalForceElasticBondBasedHalfNeighborList
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		ScalarT* fInternalOverlap,
+		const int* halfNeighborList,
+		int numHalfBonds,
+		double BULK_MODULUS,
+        double horizon
+)
+{
+  double initialBondLength, intactFraction;
+  ScalarT currentBondLength, stretch, t, fx, fy, fz;
+  int p, neighborId, bondIndex, reverseBondIndex;
+
+  const double pi = PeridigmNS::value_of_pi();
+  double constant = 18.0*BULK_MODULUS/(pi*horizon*horizon*horizon*horizon);
+
+  const int* bond = halfNeighborList;
+  for(int b=0 ; b<numHalfBonds ; b++, bond+=4){
+
+    p = bond[0];
+    neighborId = bond[1];
+    bondIndex = bond[2];
+    reverseBondIndex = bond[3];
+
+    const double* X = &xOverlap[p*3];
+    const double* neighborX = &xOverlap[neighborId*3];
+    const ScalarT* Y = &yOverlap[p*3];
+    const ScalarT* neighborY = &yOverlap[neighborId*3];
+
+    initialBondLength = std::sqrt( (neighborX[0]-X[0])*(neighborX[0]-X[0]) + (neighborX[1]-X[1])*(neighborX[1]-X[1]) + (neighborX[2]-X[2])*(neighborX[2]-X[2]) );
+    currentBondLength = std::sqrt( (neighborY[0]-Y[0])*(neighborY[0]-Y[0]) + (neighborY[1]-Y[1])*(neighborY[1]-Y[1]) + (neighborY[2]-Y[2])*(neighborY[2]-Y[2]) );
+    stretch = (currentBondLength - initialBondLength)/initialBondLength;
+
+    // The paired bond carries both halves, each with the damage of its own direction
+    intactFraction = 1.0 - bondDamage[bondIndex];
+    if(reverseBondIndex >= 0)
+      intactFraction += 1.0 - bondDamage[reverseBondIndex];
+
+    t = 0.5*intactFraction*stretch*constant;
+
+    fx = t * (neighborY[0] - Y[0]) / currentBondLength;
+    fy = t * (neighborY[1] - Y[1]) / currentBondLength;
+    fz = t * (neighborY[2] - Y[2]) / currentBondLength;
+
+    fInternalOverlap[3*p+0] += fx*volumeOverlap[neighborId];
+    fInternalOverlap[3*p+1] += fy*volumeOverlap[neighborId];
+    fInternalOverlap[3*p+2] += fz*volumeOverlap[neighborId];
+    fInternalOverlap[3*neighborId+0] -= fx*volumeOverlap[p];
+    fInternalOverlap[3*neighborId+1] -= fy*volumeOverlap[p];
+    fInternalOverlap[3*neighborId+2] -= fz*volumeOverlap[p];
+  }
+}
+
+void computeBondTangentStiffnessElasticBondBased
+(
+		const double* X,
+		const double* XP,
+		const double* Y,
+		const double* YP,
+		double volume,
+		double neighborVolume,
+		double bondDamage,
+		double** tangent,
+		double BULK_MODULUS,
+		double horizon
+)
+{
+  const double pi = PeridigmNS::value_of_pi();
+  double constant = 18.0*BULK_MODULUS/(pi*horizon*horizon*horizon*horizon);
+
+  double initialBondLength = std::sqrt( (XP[0]-X[0])*(XP[0]-X[0]) + (XP[1]-X[1])*(XP[1]-X[1]) + (XP[2]-X[2])*(XP[2]-X[2]) );
+  double currentBondLength = std::sqrt( (YP[0]-Y[0])*(YP[0]-Y[0]) + (YP[1]-Y[1])*(YP[1]-Y[1]) + (YP[2]-Y[2])*(YP[2]-Y[2]) );
+  double stretch = (currentBondLength - initialBondLength)/initialBondLength;
+  double t = 0.5*(1.0 - bondDamage)*stretch*constant;
+
+  // d(t M)/dY = dt/dY M M^T + (t/|Y|)(I - M M^T), with M the deformed bond direction
+  double M[3];
+  for(int i=0 ; i<3 ; ++i)
+    M[i] = (YP[i] - Y[i])/currentBondLength;
+  double axial = 0.5*(1.0 - bondDamage)*constant/initialBondLength;
+  double transverse = t/currentBondLength;
+  double H = volume*neighborVolume;
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      double D = H*((axial-transverse)*M[i]*M[j] + (i==j ? transverse : 0.0));
+      tangent[i][j]     = -D;
+      tangent[i][3+j]   =  D;
+      tangent[3+i][j]   =  D;
+      tangent[3+i][3+j] = -D;
+    }
+  }
+}
+
 /** Explicit template instantiation for double. */
 template void computeInternalForceElasticBondBased<double>
 (
@@ -145,4 +244,32 @@ template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double> >
         double horizon
 );
 
+/** Explicit template instantiation for double. */
+template void computeInternalForceElasticBondBasedHalfNeighborList<double>
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* fInternalOverlap,
+		const int* halfNeighborList,
+		int numHalfBonds,
+		double BULK_MODULUS,
+        double horizon
+);
+
+/** Explicit template instantiation for Sacado::Fad::DFad<double>. */
+template void computeInternalForceElasticBondBasedHalfNeighborList<Sacado::Fad::DFad<double> >
+(
+		const double* xOverlap,
+		const Sacado::Fad::DFad<double>* yOverlap,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		Sacado::Fad::DFad<double>* fInternalOverlap,
+		const int* halfNeighborList,
+		int numHalfBonds,
+		double BULK_MODULUS,
+        double horizon
+);
+
 }
@@ -64,6 +64,49 @@ void computeInternalForceElasticBondBased
         double horizon
 );
 
+/** \brief Computes the internal force from a half neighbor list.
+ *
+ *  Each entry of the half neighbor list is a bond (point, neighbor, bond index,
+ *  reverse bond index).  A bond whose reverse bond index is non-negative carries the
+ *  contributions of both directions, with the damage of each; otherwise only the
+ *  contribution of the owned point is applied, as in the full list.
+ */
+template<typename ScalarT>
+void computeInternalForceElasticBondBasedHalfNeighborList
+(
+		const double* xOverlapPtr,
+		const ScalarT* yOverlapPtr,
+		const double* volumeOverlapPtr,
+		const double* bondDamage,
+		ScalarT* fInternalOverlapPtr,
+		const int* halfNeighborList,
+		int numHalfBonds,
+		double BULK_MODULUS,
+        double horizon
+);
+
+/**
+ * Computes the tangent stiffness of the internal force carried by the bond from point 'X' to its
+ * neighbor 'XP', with respect to the current coordinates of both points.
+ * OUTPUT: tangent, the 6x6 matrix given by its row pointers, with rows and columns ordered as 'X'
+ * followed by 'XP'; each row is multiplied by the volume of its point, converting force density
+ * to force.  The bond contributes to these four 3x3 blocks only, so the tangent of a neighborhood
+ * is the sum of the tangents of its bonds.
+ */
+void computeBondTangentStiffnessElasticBondBased
+(
+		const double* X,
+		const double* XP,
+		const double* Y,
+		const double* YP,
+		double volume,
+		double neighborVolume,
+		double bondDamage,
+		double** tangent,
+		double BULK_MODULUS,
+		double horizon
+);
+
 }
 
 #endif // ELASTIC_BOND_BASED_H
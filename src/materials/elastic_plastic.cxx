@@ -46,6 +46,7 @@
 //@HEADER
 #include <cmath>
 #include <Sacado.hpp>
+#include "neighborhood_fad.h"
 #include "elastic_plastic.h"
 #include "Peridigm_Constants.hpp"
 
@@ -279,6 +280,279 @@ void computeInternalForceIsotropicElasticPlastic
 	}
 }
 
+double computeDeviatoricForceStateNorm
+(
+		int numNeigh,
+		double theta,
+		const BondCache& bonds,
+		const double *deviatoricPlasticExtensionState,
+		double alpha,
+		double OMEGA
+)
+{
+	const double *zeta = &bonds.zeta[0];
+	const double *e = &bonds.extension[0];
+	const double *cellVolume = &bonds.volume[0];
+	const double *intact = &bonds.intact[0];
+	double norm=0.0;
+	for(int n=0;n<numNeigh;n++){
+		double ed = e[n]-theta*zeta[n]/3;
+		double tdTrial = intact[n] * alpha * OMEGA * (ed - deviatoricPlasticExtensionState[n]);
+		norm += tdTrial * tdTrial * cellVolume[n];
+	}
+	return sqrt(norm);
+}
+
+void assembleElasticForceState
+(
+		int numNeigh,
+		const int *neighPtr,
+		double theta,
+		double c,
+		double alpha,
+		double OMEGA,
+		double selfCellVolume,
+		const BondCache& bonds,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		double *fOwned,
+		double *fInternalOverlap
+)
+{
+	const double *zeta = &bonds.zeta[0];
+	const double *e = &bonds.extension[0];
+	const double *dY = &bonds.dY[0];
+	const double *dx_Y = &bonds.dx_Y[0];
+	const double *dy_Y = &bonds.dy_Y[0];
+	const double *dz_Y = &bonds.dz_Y[0];
+	const double *cellVolume = &bonds.volume[0];
+	const double *intact = &bonds.intact[0];
+	for(int n=0;n<numNeigh;n++){
+		int localId = neighPtr[n];
+
+		/*
+		 * Trial deviatoric force state; edpNp1 = edpN
+		 */
+		double edpN = deviatoricPlasticExtensionStateN[n];
+		double td = alpha * OMEGA * (e[n] - theta*zeta[n]/3 - edpN);
+		deviatoricPlasticExtensionStateNp1[n] = edpN;
+
+		/*
+		 * Force state (with damage)
+		 */
+		double ti = c * zeta[n];
+		double d = intact[n];
+		double t = d*(ti + d*td);
+
+		/*
+		 * Assemble pair wise force function
+		 */
+		double fx = t * dx_Y[n] / dY[n];
+		double fy = t * dy_Y[n] / dY[n];
+		double fz = t * dz_Y[n] / dY[n];
+
+		*(fOwned+0) += fx*cellVolume[n];
+		*(fOwned+1) += fy*cellVolume[n];
+		*(fOwned+2) += fz*cellVolume[n];
+		fInternalOverlap[3*localId+0] -= fx*selfCellVolume;
+		fInternalOverlap[3*localId+1] -= fy*selfCellVolume;
+		fInternalOverlap[3*localId+2] -= fz*selfCellVolume;
+	}
+}
+
+void computeReturnMappingForceState
+(
+		const YieldingPoints& yielding,
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		const double* dilatationOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		double* fInternalOverlap,
+		const int* localNeighborList,
+		double BULK_MODULUS,
+		double HORIZON,
+		double OMEGA,
+		BondCache& bonds
+)
+{
+	double K = BULK_MODULUS;
+	const double *v = volumeOverlap;
+
+	for(int i=0;i<yielding.size();i++){
+
+		int p = yielding.point[i];
+		const int *neighPtr = &localNeighborList[yielding.neighborhood[i]];
+		int numNeigh = *neighPtr;
+		int firstBond = yielding.bond[i];
+		double weightedVol = mOwned[p];
+		double theta = dilatationOwned[p];
+		double alpha = yielding.alpha[i];
+		double deltaLambda = yielding.deltaLambda[i];
+		double scale = yielding.scale[i];
+		double selfCellVolume = v[p];
+		double c = 3 * K * theta * OMEGA / weightedVol;
+		double *fOwned = &fInternalOverlap[3*p];
+
+		/*
+		 * Bond quantities of the yielding point; the dilatation was stored by the yield pass
+		 */
+		computeDilatationAndCacheBonds(neighPtr,&xOverlap[3*p],&yNP1Overlap[3*p],xOverlap,yNP1Overlap,v,&bondDamage[firstBond],weightedVol,HORIZON,bonds);
+		neighPtr++;
+
+		const double *zeta = &bonds.zeta[0];
+		const double *e = &bonds.extension[0];
+		const double *dY = &bonds.dY[0];
+		const double *dx_Y = &bonds.dx_Y[0];
+		const double *dy_Y = &bonds.dy_Y[0];
+		const double *dz_Y = &bonds.dz_Y[0];
+		const double *cellVolume = &bonds.volume[0];
+		const double *intact = &bonds.intact[0];
+		const double *edpN = &deviatoricPlasticExtensionStateN[firstBond];
+		double *edpNp1 = &deviatoricPlasticExtensionStateNp1[firstBond];
+		for(int n=0;n<numNeigh;n++){
+			int localId = neighPtr[n];
+
+			/*
+			 * Return the trial deviatoric force state to the yield surface and
+			 * update the deviatoric plastic deformation state
+			 */
+			double tdTrial = alpha * OMEGA * (e[n] - theta*zeta[n]/3 - edpN[n]);
+			double td = scale * tdTrial;
+			edpNp1[n] = edpN[n] + td * deltaLambda;
+
+			/*
+			 * Force state (with damage)
+			 */
+			double ti = c * zeta[n];
+			double d = intact[n];
+			double t = d*(ti + d*td);
+
+			/*
+			 * Assemble pair wise force function
+			 */
+			double fx = t * dx_Y[n] / dY[n];
+			double fy = t * dy_Y[n] / dY[n];
+			double fz = t * dz_Y[n] / dY[n];
+
+			*(fOwned+0) += fx*cellVolume[n];
+			*(fOwned+1) += fy*cellVolume[n];
+			*(fOwned+2) += fz*cellVolume[n];
+			fInternalOverlap[3*localId+0] -= fx*selfCellVolume;
+			fInternalOverlap[3*localId+1] -= fy*selfCellVolume;
+			fInternalOverlap[3*localId+2] -= fz*selfCellVolume;
+		}
+	}
+}
+
+void computeDilatationAndInternalForceIsotropicElasticPlastic
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		BondCache& bonds,
+		YieldingPoints& yielding
+)
+{
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+	double OMEGA=1.0;
+	double DELTA=HORIZON;
+	double THICKNESS=thickness;
+	/*
+	 * 2d or 3d variety of yield value (uniaxial stress)
+	 */
+    double yieldValue = 25.0 * yieldStress * yieldStress / 8 / PeridigmNS::value_of_pi() / pow(DELTA,5);
+	if(isPlanarProblem)
+    	yieldValue = 225.0 / 3. * yieldStress * yieldStress / 8 / PeridigmNS::value_of_pi() / THICKNESS / pow(DELTA,4);
+
+	const double *xOwned = xOverlap;
+	const double *yOwned = yNP1Overlap;
+	const double *m = mOwned;
+	const double *v = volumeOverlap;
+	double *theta = dilatationOwned;
+	double *fOwned = fInternalOverlap;
+
+	/*
+	 * Yield pass: elastic points are assembled here, yielding points are collected
+	 */
+	yielding.clear();
+	const int *neighPtr = localNeighborList;
+	int bondIndex = 0;
+	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++){
+
+		int numNeigh = *neighPtr;
+		int neighborhoodIndex = neighPtr - localNeighborList;
+		double weightedVol = *m;
+
+		/*
+		 * Dilatation, caching the bond quantities
+		 */
+		*theta = computeDilatationAndCacheBonds(neighPtr,xOwned,yOwned,xOverlap,yNP1Overlap,v,&bondDamage[bondIndex],weightedVol,HORIZON,bonds);
+		neighPtr++;
+
+		double alpha = 15.0*MU/weightedVol;
+
+		/*
+		 * Compute norm of trial stress
+		 */
+		double tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,bonds,&deviatoricPlasticExtensionStateN[bondIndex],alpha,OMEGA);
+
+		/*
+		 * Evaluate yield function
+		 */
+		double pointWiseYieldValue =  yieldValue;
+		double f = tdNorm * tdNorm / 2 - pointWiseYieldValue;
+
+		if(f>0){
+			/*
+			 * This step is incrementally plastic
+			 */
+			double deltaLambda=( tdNorm / sqrt(2.0*pointWiseYieldValue) - 1.0 ) / alpha;
+			*lambdaNP1 = *lambdaN + deltaLambda;
+			yielding.add(p, neighborhoodIndex, bondIndex, alpha, deltaLambda, sqrt(2.0*pointWiseYieldValue) / tdNorm);
+		} else {
+			/*
+			 * Elastic case
+			 */
+			*lambdaNP1 = *lambdaN;
+			double c = 3 * K * (*theta) * OMEGA / weightedVol;
+			assembleElasticForceState(numNeigh,neighPtr,*theta,c,alpha,OMEGA,v[p],bonds,
+			                          &deviatoricPlasticExtensionStateN[bondIndex],&deviatoricPlasticExtensionStateNp1[bondIndex],
+			                          fOwned,fInternalOverlap);
+		}
+
+		neighPtr += numNeigh;
+		bondIndex += numNeigh;
+	}
+
+	/*
+	 * Return mapping pass over the yielding points
+	 */
+	computeReturnMappingForceState(yielding,xOverlap,yNP1Overlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,
+	                               deviatoricPlasticExtensionStateN,deviatoricPlasticExtensionStateNp1,fInternalOverlap,
+	                               localNeighborList,BULK_MODULUS,HORIZON,OMEGA,bonds);
+}
+
 /** Explicit template instantiation for double. */
 template double computeDeviatoricForceStateNorm<double>
 (
@@ -361,5 +635,35 @@ template void computeInternalForceIsotropicElasticPlastic<Sacado::Fad::DFad<doub
 		double thickness
 );
 
+/** Explicit template instantiations for the statically sized AD types of neighborhood_fad.h. */
+#define INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC(ScalarT) \
+template void computeInternalForceIsotropicElasticPlastic<ScalarT > \
+( \
+		const double* xOverlap, \
+		const ScalarT* yNP1Overlap, \
+		const double* mOwned, \
+		const double* volumeOverlap, \
+		const ScalarT* dilatationOwned, \
+		const double* bondDamage, \
+		const double* deviatoricPlasticExtensionStateN, \
+		ScalarT* deviatoricPlasticExtensionStateNp1, \
+		const double* lambdaN, \
+		ScalarT* lambdaNP1, \
+		ScalarT* fInternalOverlap, \
+		const int*  localNeighborList, \
+		int numOwnedPoints, \
+		double BULK_MODULUS, \
+		double SHEAR_MODULUS, \
+		double HORIZON, \
+		double yieldStress, \
+		bool isPlanarProblem, \
+		double thickness \
+);
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC(NeighborhoodFad<32>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC(NeighborhoodFad<64>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC(NeighborhoodFad<128>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC(NeighborhoodFad<256>::type)
+#undef INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_ELASTIC_PLASTIC
+
 }
 
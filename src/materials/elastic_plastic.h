@@ -48,6 +48,8 @@
 #ifndef ELASTIC_PLASTIC_H
 #define ELASTIC_PLASTIC_H
 
+#include "material_utilities.h"
+
 namespace MATERIAL_EVALUATION {
 
 /**
@@ -105,6 +107,148 @@ void computeInternalForceIsotropicElasticPlastic
 		double thickness
 );
 
+/**
+ * Computes norm of deviatoric force state at a particular point from the bond
+ * quantities cached by computeDilatationAndCacheBonds()
+ * @param numNeigh -- number of neighbors at point
+ * @param theta    -- dilatation at point
+ * @param bonds    -- cached reference lengths, extensions, volumes, and (1 - bond damage) of the bonds at point
+ * @param alpha    -- material property (alpha = 15 mu / m
+ * @param OMEGA    -- weight function at point
+ */
+double computeDeviatoricForceStateNorm
+(
+		int numNeigh,
+		double theta,
+		const BondCache& bonds,
+		const double *deviatoricPlasticExtensionState,
+		double alpha,
+		double OMEGA
+);
+
+/**
+ * Points that yield in a step, collected by the yield pass of the plasticity kernels so that
+ * the return mapping runs over a compacted list of yielding points only.  Storage grows to
+ * the largest number of yielding points seen and is reused from step to step.
+ */
+struct YieldingPoints {
+
+  //! Empties the list, keeping its storage.
+  void clear(){
+    point.clear();
+    neighborhood.clear();
+    bond.clear();
+    alpha.clear();
+    deltaLambda.clear();
+    scale.clear();
+  }
+
+  //! Appends a yielding point.
+  void add(int p, int neighborhoodIndex, int bondIndex, double pointAlpha, double pointDeltaLambda, double pointScale){
+    point.push_back(p);
+    neighborhood.push_back(neighborhoodIndex);
+    bond.push_back(bondIndex);
+    alpha.push_back(pointAlpha);
+    deltaLambda.push_back(pointDeltaLambda);
+    scale.push_back(pointScale);
+  }
+
+  int size() const { return static_cast<int>(point.size()); }
+
+  //! Owned point index
+  std::vector<int> point;
+  //! Index of the point's entry ('numNeigh') in the neighborhood list
+  std::vector<int> neighborhood;
+  //! Index of the point's first bond in the bond data
+  std::vector<int> bond;
+  //! Material property alpha = 15 mu / m at the point
+  std::vector<double> alpha;
+  //! Increment of the plastic multiplier
+  std::vector<double> deltaLambda;
+  //! Ratio of the deviatoric force state on the yield surface to the trial state
+  std::vector<double> scale;
+};
+
+/**
+ * Assembles the internal force contributions of the bonds at an elastic point from the bond
+ * quantities cached by computeDilatationAndCacheBonds(); the trial deviatoric force state
+ * stands and the deviatoric plastic extension state is carried over unchanged
+ * NOTE: neighPtr should point to the first neighbor (not to 'numNeigh'), and the
+ * deviatoric plastic extension states to the first bond of the point
+ */
+void assembleElasticForceState
+(
+		int numNeigh,
+		const int *neighPtr,
+		double theta,
+		double c,
+		double alpha,
+		double OMEGA,
+		double selfCellVolume,
+		const BondCache& bonds,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		double *fOwned,
+		double *fInternalOverlap
+);
+
+/**
+ * Runs the return mapping over the compacted list of yielding points and assembles their
+ * internal force contributions.  The bond quantities of each yielding point are recomputed
+ * with computeDilatationAndCacheBonds(), so the trial deviatoric force state is formed
+ * again for yielding points only rather than stored for every bond.
+ */
+void computeReturnMappingForceState
+(
+		const YieldingPoints& yielding,
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		const double* dilatationOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		double* fInternalOverlap,
+		const int* localNeighborList,
+		double BULK_MODULUS,
+		double HORIZON,
+		double OMEGA,
+		BondCache& bonds
+);
+
+/**
+ * Computes the dilatation of each owned point and its contributions to the internal force.
+ * A first pass over the points computes the dilatation and the trial deviatoric force norm
+ * from the bond quantities cached while computing the dilatation, and evaluates the yield
+ * function; elastic points are assembled directly and yielding points are appended to
+ * 'yielding'.  The return mapping then runs over the yielding points only.
+ */
+void computeDilatationAndInternalForceIsotropicElasticPlastic
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		BondCache& bonds,
+		YieldingPoints& yielding
+);
+
 }
 
 #endif // ELASTIC_PLASTIC_H
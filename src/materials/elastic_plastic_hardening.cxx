@@ -46,6 +46,7 @@
 //@HEADER
 #include <cmath>
 #include <Sacado.hpp>
+#include "neighborhood_fad.h"
 #include <float.h>
 #include "elastic_plastic.h"
 #include "elastic_plastic_hardening.h"
@@ -326,6 +327,114 @@ ScalarT updateDeltaLambda
 
 }
 
+void computeDilatationAndInternalForceIsotropicHardeningPlastic
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		BondCache& bonds,
+		YieldingPoints& yielding
+)
+{
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+	double OMEGA=1.0;
+	double DELTA=HORIZON;
+	double H=HARD_MODULUS;
+	/*
+	 * 3d variety of yield value
+	 */
+	double yieldValue = 25.0 * yieldStress * yieldStress / 8 / PeridigmNS::value_of_pi() / pow(DELTA,5);
+
+	const double *xOwned = xOverlap;
+	const double *yOwned = yNP1Overlap;
+	const double *m = mOwned;
+	const double *v = volumeOverlap;
+	double *theta = dilatationOwned;
+	double *fOwned = fInternalOverlap;
+
+	/*
+	 * Yield pass: elastic points are assembled here, yielding points are collected
+	 */
+	yielding.clear();
+	const int *neighPtr = localNeighborList;
+	int bondIndex = 0;
+	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++, scfOwned++){
+
+		int numNeigh = *neighPtr;
+		int neighborhoodIndex = neighPtr - localNeighborList;
+		double weightedVol = *m;
+
+		/*
+		 * Dilatation, caching the bond quantities
+		 */
+		*theta = computeDilatationAndCacheBonds(neighPtr,xOwned,yOwned,xOverlap,yNP1Overlap,v,&bondDamage[bondIndex],weightedVol,HORIZON,bonds);
+		neighPtr++;
+
+		double alpha = *scfOwned * 15.0*MU/weightedVol;
+		double deltaLambda=0.0;
+
+		/*
+		 * Compute norm of trial stress
+		 */
+		double tdNorm = computeDeviatoricForceStateNorm(numNeigh,*theta,bonds,&deviatoricPlasticExtensionStateN[bondIndex],alpha,OMEGA);
+
+		/*
+		 * Compute lambdaNP1 using a backward Euler implicit scheme
+		 */
+		double pointWiseYieldValue = *scfOwned * (*scfOwned) * yieldValue;
+		if (tdNorm * tdNorm / 2 - pointWiseYieldValue > 0){
+			deltaLambda = updateDeltaLambda(tdNorm, *lambdaN, pointWiseYieldValue, alpha, H);
+			if (deltaLambda < 0.0 ){
+				deltaLambda = 0.0;
+			}
+		}
+
+		if(deltaLambda>0){
+			/*
+			 * This step is incrementally plastic
+			 */
+			*lambdaNP1 = *lambdaN + deltaLambda;
+			yielding.add(p, neighborhoodIndex, bondIndex, alpha, deltaLambda, 1.0/(1+alpha*deltaLambda));
+		} else {
+			/*
+			 * Elastic case
+			 */
+			*lambdaNP1 = *lambdaN;
+			double c = 3 * K * (*theta) * OMEGA / weightedVol;
+			assembleElasticForceState(numNeigh,neighPtr,*theta,c,alpha,OMEGA,v[p],bonds,
+			                          &deviatoricPlasticExtensionStateN[bondIndex],&deviatoricPlasticExtensionStateNp1[bondIndex],
+			                          fOwned,fInternalOverlap);
+		}
+
+		neighPtr += numNeigh;
+		bondIndex += numNeigh;
+	}
+
+	/*
+	 * Return mapping pass over the yielding points
+	 */
+	computeReturnMappingForceState(yielding,xOverlap,yNP1Overlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,
+	                               deviatoricPlasticExtensionStateN,deviatoricPlasticExtensionStateNp1,fInternalOverlap,
+	                               localNeighborList,BULK_MODULUS,HORIZON,OMEGA,bonds);
+}
+
 /** Explicit template instantiation for double. */
 template void computeInternalForceIsotropicHardeningPlastic<double>
 (
@@ -374,6 +483,36 @@ template void computeInternalForceIsotropicHardeningPlastic<Sacado::Fad::DFad<do
 		double HARD_MODULUS
 );
 
+/** Explicit template instantiations for the statically sized AD types of neighborhood_fad.h. */
+#define INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC(ScalarT) \
+template void computeInternalForceIsotropicHardeningPlastic<ScalarT > \
+( \
+		const double* xOverlap, \
+		const ScalarT* yNP1Overlap, \
+		const double* mOwned, \
+		const double* volumeOverlap, \
+		const ScalarT* dilatationOwned, \
+		const double* bondDamage, \
+		const double* scfOwned, \
+		const double* deviatoricPlasticExtensionStateN, \
+		ScalarT* deviatoricPlasticExtensionStateNp1, \
+		const double* lambdaN, \
+		ScalarT* lambdaNP1, \
+		ScalarT* fInternalOverlap, \
+		const int*  localNeighborList, \
+		int numOwnedPoints, \
+		double BULK_MODULUS, \
+		double SHEAR_MODULUS, \
+		double HORIZON, \
+		double yieldStress, \
+		double HARD_MODULUS \
+);
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC(NeighborhoodFad<32>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC(NeighborhoodFad<64>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC(NeighborhoodFad<128>::type)
+INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC(NeighborhoodFad<256>::type)
+#undef INSTANTIATE_COMPUTE_INTERNAL_FORCE_ISOTROPIC_HARDENING_PLASTIC
+
 /** Explicit template instantiation for int. */
 template double sign<double> 
 (
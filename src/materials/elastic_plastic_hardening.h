@@ -48,6 +48,9 @@
 #ifndef ELASTIC_PLASTIC_HARDENING_H
 #define ELASTIC_PLASTIC_HARDENING_H
 
+#include "material_utilities.h"
+#include "elastic_plastic.h"
+
 namespace MATERIAL_EVALUATION {
 
 //! Simple sign function.
@@ -91,6 +94,37 @@ void computeInternalForceIsotropicHardeningPlastic
 		double HARD_MODULUS
 );
 
+/**
+ * Computes the dilatation of each owned point and its contributions to the internal force.
+ * As in computeDilatationAndInternalForceIsotropicElasticPlastic(), elastic points are
+ * assembled in the yield pass and the return mapping runs over the compacted list of
+ * yielding points only.
+ */
+void computeDilatationAndInternalForceIsotropicHardeningPlastic
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const double* scfOwned,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		double HARD_MODULUS,
+		BondCache& bonds,
+		YieldingPoints& yielding
+);
+
 }
 
 #endif // ELASTIC_PLASTIC_HARDENING_H
@@ -49,6 +49,7 @@
 #include <cmath>
 #include <vector>
 #include <Sacado.hpp>
+#include "neighborhood_fad.h"
 
 namespace MATERIAL_EVALUATION {
 
@@ -232,8 +233,12 @@ void computeDeviatoricDilatation
 	}
 }
 
-template<typename ScalarT>
-void computeDilatation
+/**
+ * Dilatation of the owned points, specialized on the influence function
+ * so that built-in and tabulated influence functions are inlined.
+ */
+template<typename ScalarT, class InfluenceFunctionT>
+void computeDilatationWithInfluenceFunction
 (
 		const double* xOverlap,
 		const ScalarT* yOverlap,
@@ -244,7 +249,7 @@ void computeDilatation
 		const int* localNeighborList,
 		int numOwnedPoints,
         double horizon,
-		const FunctionPointer OMEGA,
+		const InfluenceFunctionT& OMEGA,
         double thermalExpansionCoefficient,
         const double* deltaTemperature
 )
@@ -287,6 +292,46 @@ void computeDilatation
 	}
 }
 
+template<typename ScalarT>
+void computeDilatation
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		ScalarT* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const FunctionPointer OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature
+)
+{
+	using namespace PeridigmNS::PeridigmInfluenceFunction;
+	switch(PeridigmNS::InfluenceFunction::getType(OMEGA)){
+	case PeridigmNS::InfluenceFunction::ONE:
+		computeDilatationWithInfluenceFunction(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,One(),thermalExpansionCoefficient,deltaTemperature);
+		return;
+	case PeridigmNS::InfluenceFunction::PARABOLIC_DECAY:
+		computeDilatationWithInfluenceFunction(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,ParabolicDecay(),thermalExpansionCoefficient,deltaTemperature);
+		return;
+	case PeridigmNS::InfluenceFunction::GAUSSIAN:
+		computeDilatationWithInfluenceFunction(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,Gaussian(),thermalExpansionCoefficient,deltaTemperature);
+		return;
+	case PeridigmNS::InfluenceFunction::TABULATED:
+		if(const PeridigmNS::InfluenceFunctionTable* table = PeridigmNS::InfluenceFunction::self().getTable(horizon)){
+			computeDilatationWithInfluenceFunction(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,Tabulated(*table),thermalExpansionCoefficient,deltaTemperature);
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+	computeDilatationWithInfluenceFunction(xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,numOwnedPoints,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature);
+}
+
 /** Explicit template instantiation for double. */
 template
 void computeDilatation<double>
@@ -324,6 +369,29 @@ void computeDilatation<Sacado::Fad::DFad<double> >
         const double* deltaTemperature
  );
 
+/** Explicit template instantiations for the statically sized AD types of neighborhood_fad.h. */
+#define INSTANTIATE_COMPUTE_DILATATION(ScalarT) \
+template void computeDilatation<ScalarT > \
+( \
+		const double* xOverlap, \
+		const ScalarT* yOverlap, \
+		const double *mOwned, \
+		const double* volumeOverlap, \
+		const double* bondDamage, \
+		ScalarT* dilatationOwned, \
+		const int* localNeighborList, \
+		int numOwnedPoints, \
+        double horizon, \
+		const FunctionPointer OMEGA, \
+        double thermalExpansionCoefficient, \
+        const double* deltaTemperature \
+);
+INSTANTIATE_COMPUTE_DILATATION(NeighborhoodFad<32>::type)
+INSTANTIATE_COMPUTE_DILATATION(NeighborhoodFad<64>::type)
+INSTANTIATE_COMPUTE_DILATATION(NeighborhoodFad<128>::type)
+INSTANTIATE_COMPUTE_DILATATION(NeighborhoodFad<256>::type)
+#undef INSTANTIATE_COMPUTE_DILATATION
+
 /**
  * Call this function on a single point 'X'
  * NOTE: neighPtr to should point to 'numNeigh' for 'X'
@@ -520,6 +588,104 @@ void computeWeightedVolume
 }
 
 
+template<class InfluenceFunctionT>
+double computeDilatationAndCacheBondsWithInfluenceFunction
+(
+		const int *neighPtr,
+		const double *X,
+		const double *Y,
+		const double *xOverlap,
+		const double *yOverlap,
+		const double *volumeOverlap,
+		const double *bondDamage,
+		double weightedVolume,
+		double horizon,
+		BondCache& bonds,
+		const InfluenceFunctionT& OMEGA,
+		double thermalExpansionCoefficient,
+		const double *deltaTemperature
+)
+{
+	int numNeigh = *neighPtr; neighPtr++;
+	bonds.reserve(numNeigh);
+	double *zeta = &bonds.zeta[0];
+	double *extension = &bonds.extension[0];
+	double *dY = &bonds.dY[0];
+	double *dx_Y = &bonds.dx_Y[0];
+	double *dy_Y = &bonds.dy_Y[0];
+	double *dz_Y = &bonds.dz_Y[0];
+	double *omega = &bonds.omega[0];
+	double *volume = &bonds.volume[0];
+	double *intact = &bonds.intact[0];
+
+	double theta = 0.0;
+	for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++){
+		int localId = *neighPtr;
+		const double *XP = &xOverlap[3*localId];
+		const double *YP = &yOverlap[3*localId];
+		double X_dx = XP[0]-X[0];
+		double X_dy = XP[1]-X[1];
+		double X_dz = XP[2]-X[2];
+		double d = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+		double Y_dx = YP[0]-Y[0];
+		double Y_dy = YP[1]-Y[1];
+		double Y_dz = YP[2]-Y[2];
+		double y = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz);
+		double e = y - d;
+		if(deltaTemperature)
+		  e -= thermalExpansionCoefficient*(*deltaTemperature)*d;
+		double w = OMEGA(d,horizon);
+		double cellVolume = volumeOverlap[localId];
+		theta += 3.0*w*(1.0-*bondDamage)*d*e*cellVolume/weightedVolume;
+
+		zeta[n] = d;
+		extension[n] = e;
+		dY[n] = y;
+		dx_Y[n] = Y_dx;
+		dy_Y[n] = Y_dy;
+		dz_Y[n] = Y_dz;
+		omega[n] = w;
+		volume[n] = cellVolume;
+		intact[n] = 1.0-*bondDamage;
+	}
+	return theta;
+}
+
+double computeDilatationAndCacheBonds
+(
+		const int *neighPtr,
+		const double *X,
+		const double *Y,
+		const double *xOverlap,
+		const double *yOverlap,
+		const double *volumeOverlap,
+		const double *bondDamage,
+		double weightedVolume,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA,
+		double thermalExpansionCoefficient,
+		const double *deltaTemperature
+)
+{
+	using namespace PeridigmNS::PeridigmInfluenceFunction;
+	switch(PeridigmNS::InfluenceFunction::getType(OMEGA)){
+	case PeridigmNS::InfluenceFunction::ONE:
+		return computeDilatationAndCacheBondsWithInfluenceFunction(neighPtr,X,Y,xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,One(),thermalExpansionCoefficient,deltaTemperature);
+	case PeridigmNS::InfluenceFunction::PARABOLIC_DECAY:
+		return computeDilatationAndCacheBondsWithInfluenceFunction(neighPtr,X,Y,xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,ParabolicDecay(),thermalExpansionCoefficient,deltaTemperature);
+	case PeridigmNS::InfluenceFunction::GAUSSIAN:
+		return computeDilatationAndCacheBondsWithInfluenceFunction(neighPtr,X,Y,xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,Gaussian(),thermalExpansionCoefficient,deltaTemperature);
+	case PeridigmNS::InfluenceFunction::TABULATED:
+		if(const PeridigmNS::InfluenceFunctionTable* table = PeridigmNS::InfluenceFunction::self().getTable(horizon))
+			return computeDilatationAndCacheBondsWithInfluenceFunction(neighPtr,X,Y,xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,Tabulated(*table),thermalExpansionCoefficient,deltaTemperature);
+		break;
+	default:
+		break;
+	}
+	return computeDilatationAndCacheBondsWithInfluenceFunction(neighPtr,X,Y,xOverlap,yOverlap,volumeOverlap,bondDamage,weightedVolume,horizon,bonds,OMEGA,thermalExpansionCoefficient,deltaTemperature);
+}
+
 namespace WITH_BOND_VOLUME {
 
 /**
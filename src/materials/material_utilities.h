@@ -49,6 +49,7 @@
 #define MATERIAL_UTILITIES_H
 
 #include <cstdlib>
+#include <vector>
 
 #include "Peridigm_Constants.hpp"
 #include "Peridigm_InfluenceFunction.hpp"
@@ -210,6 +211,70 @@ void computeDilatation
         const double* deltaTemperature = 0
  );
 
+/**
+ * Per-bond quantities of a single point, cached by computeDilatationAndCacheBonds()
+ * so that the force state can be evaluated without revisiting the neighbor data.
+ * Storage grows to the largest neighborhood seen and is reused from point to point,
+ * so that it remains in cache between the dilatation and force loops.
+ */
+struct BondCache {
+
+  //! Ensures room for numNeigh bonds.
+  void reserve(int numNeigh){
+    if(static_cast<int>(zeta.size()) < numNeigh){
+      zeta.resize(numNeigh);
+      extension.resize(numNeigh);
+      dY.resize(numNeigh);
+      dx_Y.resize(numNeigh);
+      dy_Y.resize(numNeigh);
+      dz_Y.resize(numNeigh);
+      omega.resize(numNeigh);
+      volume.resize(numNeigh);
+      intact.resize(numNeigh);
+    }
+  }
+
+  //! Reference bond length
+  std::vector<double> zeta;
+  //! Bond extension, less thermal expansion
+  std::vector<double> extension;
+  //! Current bond length
+  std::vector<double> dY;
+  //! Current bond vector
+  std::vector<double> dx_Y, dy_Y, dz_Y;
+  //! Influence function
+  std::vector<double> omega;
+  //! Neighbor volume
+  std::vector<double> volume;
+  //! One minus bond damage
+  std::vector<double> intact;
+};
+
+/**
+ * Call this function on a single point 'X'
+ * NOTE: neighPtr to should point to 'numNeigh' for 'X'
+ * and thus describe the neighborhood list as usual
+ * NOTE: bondDamage should point to the first bond of 'X'
+ * OUTPUT: returns the dilatation at 'X', and fills 'bonds'
+ * with the quantities for each of the bonds of 'X'
+ */
+double computeDilatationAndCacheBonds
+(
+		const int *neighPtr,
+		const double *X,
+		const double *Y,
+		const double *xOverlap,
+		const double *yOverlap,
+		const double *volumeOverlap,
+		const double *bondDamage,
+		double weightedVolume,
+		double horizon,
+		BondCache& bonds,
+		const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+		double thermalExpansionCoefficient = 0,
+		const double *deltaTemperature = 0
+);
+
 namespace WITH_BOND_VOLUME {
 
 /**
@@ -0,0 +1,192 @@
+/*! \file utPeridigm_ElasticBondBasedMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticBondBasedMaterial.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_Field.hpp"
+#include "utPeridigm_TangentStiffnessMatrix.hpp"
+#include "elastic_bond_based.h"
+#include <Sacado.hpp>
+#include <Epetra_SerialComm.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Compares the analytic tangent with the tangent obtained by automatic differentiation of the internal force.
+
+TEUCHOS_UNIT_TEST(ElasticBondBasedMaterial, eightPointAnalyticTangentStiffnessMatrix) {
+
+  // instantiate the material model
+  double bulkModulus = 130.0e9;
+  double horizon = 10.0;
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", bulkModulus);
+  params.set("Horizon", horizon);
+  ElasticBondBasedMaterial mat(params);
+
+  double dt = 1.0;
+  EightPointCube cube;
+  cube.initialize(mat, dt);
+
+  // compute the analytic tangent
+  Teuchos::RCP<Epetra_FECrsMatrix> tangent = createZeroTangent(cube.tangentMap);
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangent);
+  mat.computeJacobian(dt, cube.numOwnedPoints, &cube.ownedIDs[0], &cube.neighborhoodList[0], cube.dataManager, tangentSerialMatrix);
+
+  // differentiate the internal force with respect to the current coordinates
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  Epetra_Vector& x = *cube.dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *cube.dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+  Epetra_Vector& cellVolume = *cube.dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  Epetra_Vector& bondDamage = *cube.dataManager.getData(fieldManager.getFieldId("Bond_Damage"), PeridigmField::STEP_NP1);
+  typedef Sacado::Fad::DFad<double> Fad;
+  vector<Fad> y_AD(24), force_AD(24);
+  for(int i=0 ; i<24 ; ++i){
+    y_AD[i] = Fad(24, i, y[i]);
+    force_AD[i] = Fad(24, 0.0);
+  }
+  double *xPtr, *cellVolumePtr, *bondDamagePtr;
+  x.ExtractView(&xPtr);
+  cellVolume.ExtractView(&cellVolumePtr);
+  bondDamage.ExtractView(&bondDamagePtr);
+  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(xPtr, &y_AD[0], cellVolumePtr, bondDamagePtr, &force_AD[0],
+                                                            &cube.neighborhoodList[0], cube.numOwnedPoints, bulkModulus, horizon);
+
+  // the tangent is in terms of force rather than force density
+  Teuchos::RCP<Epetra_FECrsMatrix> automaticDifferentiationTangent = createZeroTangent(cube.tangentMap);
+  vector<double> values(24);
+  vector<int> indices(24);
+  for(int j=0 ; j<24 ; ++j)
+    indices[j] = j;
+  for(int i=0 ; i<24 ; ++i){
+    for(int j=0 ; j<24 ; ++j)
+      values[j] = force_AD[i].dx(j)*cellVolume[i/3];
+    automaticDifferentiationTangent->ReplaceGlobalValues(i, 24, &values[0], &indices[0]);
+  }
+
+  // compare the entries, relative to the largest entry
+  double maxEntry, maxDifference;
+  TEST_ASSERT(compareTangents(*tangent, *automaticDifferentiationTangent, maxEntry, maxDifference));
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-12*maxEntry);
+}
+
+//! Compares the internal force from the half neighbor list with the force from the full list, with nonuniform bond damage.
+
+TEUCHOS_UNIT_TEST(ElasticBondBasedMaterial, halfNeighborListInternalForce) {
+
+  double bulkModulus = 130.0e9;
+  double horizon = 1.5;
+
+  // a 3x3x3 lattice with unit spacing; the top layer of nine points are ghosts, which have no neighborhoods
+  int numPoints = 27;
+  int numOwnedPoints = 18;
+  vector<double> x(3*numPoints), y(3*numPoints), cellVolume(numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    x[3*i]   = i%3;
+    x[3*i+1] = (i/3)%3;
+    x[3*i+2] = i/9;
+    y[3*i]   = x[3*i]   + 1.0e-3*(i%4);
+    y[3*i+1] = x[3*i+1] - 2.0e-3*(i%3);
+    y[3*i+2] = x[3*i+2] + 1.5e-3*(i%5);
+    cellVolume[i] = 1.0 + 0.1*(i%2);
+  }
+
+  // owned-owned bonds appear from both ends, except the bond from point 4 to point 0, which
+  // point 0 does not have in its neighborhood
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    int listIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      double dx = x[3*j]-x[3*i], dy = x[3*j+1]-x[3*i+1], dz = x[3*j+2]-x[3*i+2];
+      if(j != i && sqrt(dx*dx+dy*dy+dz*dz) < horizon && !(i == 0 && j == 4)){
+        neighborhoodList.push_back(j);
+        neighborhoodList[listIndex] += 1;
+      }
+    }
+  }
+  int numBonds = neighborhoodList.size() - numOwnedPoints;
+
+  // the damage of a bond differs from the damage of its reverse bond
+  vector<double> bondDamage(numBonds);
+  for(int b=0 ; b<numBonds ; ++b)
+    bondDamage[b] = 0.1*(b%7);
+
+  HalfNeighborList halfNeighborList(numOwnedPoints, &neighborhoodList[0]);
+  TEST_COMPARE(halfNeighborList.NumPairedBonds(), >, 0);
+  TEST_COMPARE(halfNeighborList.NumBonds(), <, numBonds);
+
+  vector<double> force(3*numPoints, 0.0), halfListForce(3*numPoints, 0.0);
+  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(&x[0], &y[0], &cellVolume[0], &bondDamage[0], &force[0],
+                                                            &neighborhoodList[0], numOwnedPoints, bulkModulus, horizon);
+  MATERIAL_EVALUATION::computeInternalForceElasticBondBasedHalfNeighborList(&x[0], &y[0], &cellVolume[0], &bondDamage[0], &halfListForce[0],
+                                                                            halfNeighborList.Bonds(), halfNeighborList.NumBonds(), bulkModulus, horizon);
+
+  // compare the force on every owned and ghost point, relative to the largest entry
+  double maxEntry(0.0), maxDifference(0.0);
+  for(int i=0 ; i<3*numPoints ; ++i){
+    maxEntry = std::max(maxEntry, std::abs(force[i]));
+    maxDifference = std::max(maxDifference, std::abs(halfListForce[i] - force[i]));
+  }
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-13*maxEntry);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -51,8 +51,11 @@
 #include "Peridigm_ElasticMaterial.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_Field.hpp"
+#include "utPeridigm_TangentStiffnessMatrix.hpp"
 #include <Epetra_SerialComm.h>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 
 
 using namespace std;
@@ -662,6 +665,154 @@ TEUCHOS_UNIT_TEST(ElasticMaterial, testThreePts) {
   delete[] neighborhoodList;
 }
 
+//! Compares the analytic tangent with the automatic differentiation tangent for an eight-point system.
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, eightPointAnalyticTangentStiffnessMatrix) {
+
+  // instantiate the material models, one for each way of computing the tangent
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  ElasticMaterial analyticMat(params);
+  params.set("Apply Analytic Jacobian", false);
+  ElasticMaterial automaticDifferentiationMat(params);
+
+  double dt = 1.0;
+  EightPointCube cube;
+  cube.initialize(analyticMat, dt);
+
+  // compute the tangent both ways
+  Teuchos::RCP<Epetra_FECrsMatrix> tangent[2];
+  for(int k=0 ; k<2 ; ++k){
+    tangent[k] = createZeroTangent(cube.tangentMap);
+    PeridigmNS::SerialMatrix tangentSerialMatrix(tangent[k]);
+    const ElasticMaterial& mat = (k == 0 ? analyticMat : automaticDifferentiationMat);
+    mat.computeJacobian(dt, cube.numOwnedPoints, &cube.ownedIDs[0], &cube.neighborhoodList[0], cube.dataManager, tangentSerialMatrix);
+  }
+
+  // compare the entries, relative to the largest entry
+  double maxEntry, maxDifference;
+  TEST_ASSERT(compareTangents(*tangent[0], *tangent[1], maxEntry, maxDifference));
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-12*maxEntry);
+}
+
+//! Checks that an explicit request for the automatic differentiation Jacobian is not overridden by the analytic default.
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, jacobianOptionPrecedence) {
+
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  params.set("Apply Automatic Differentiation Jacobian", true);
+  TEST_NOTHROW(ElasticMaterial mat(params));
+
+  params.set("Apply Analytic Jacobian", true);
+  TEST_THROW(ElasticMaterial mat(params), std::logic_error);
+}
+
+//! Compares the finite-difference tangent with the analytic tangent for a row of points with neighborhoods of different sizes.
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, finiteDifferenceTangentStiffnessMatrix) {
+
+  // instantiate the material models, one for each way of computing the tangent
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 2.5);
+  params.set("Finite Difference Probe Length", 1.0e-6);
+  ElasticMaterial analyticMat(params);
+  params.set("Apply Analytic Jacobian", false);
+  params.set("Apply Automatic Differentiation Jacobian", false);
+  ElasticMaterial finiteDifferenceMat(params);
+
+  // a row of five points, each bonded to the points within two spacings;
+  // the neighborhoods have 2, 3, 4, 3, and 2 neighbors, so the neighborhood workspace is reused with stale entries
+  int numPoints = 5;
+  int numOwnedPoints = numPoints;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  vector<int> elementSizes(numPoints), myGlobalElements(numPoints);
+  for(int i=0 ; i<numOwnedPoints; ++i){
+    ownedIDs[i] = i;
+    myGlobalElements[i] = i;
+    int listIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    for(int j=0 ; j<numPoints ; ++j){
+      if(j != i && std::abs(j-i) <= 2){
+        neighborhoodList.push_back(j);
+        neighborhoodList[listIndex] += 1;
+      }
+    }
+    elementSizes[i] = neighborhoodList[listIndex];
+  }
+
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap(numPoints, 1, 0, comm);
+  Epetra_BlockMap vectorPointMap(numPoints, 3, 0, comm);
+  Epetra_BlockMap bondMap(numPoints, numPoints, &myGlobalElements[0], &elementSizes[0], 0, comm);
+  Epetra_Map tangentMap(3*numPoints, 0, comm);
+
+  // the finite-difference Jacobian perturbs the velocity along with the coordinates
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  vector<int> fieldIds = analyticMat.FieldIds();
+  fieldIds.push_back(fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Velocity"));
+
+  // create the data manager
+  // in serial, the overlap and non-overlap maps are the same
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&scalarPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&vectorPointMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(fieldIds);
+
+  Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+  Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+  for(int i=0 ; i<numPoints ; ++i){
+    x[3*i] = i;
+    x[3*i+1] = 0.0;
+    x[3*i+2] = 0.0;
+    y[3*i] = 1.01*i;
+    y[3*i+1] = 0.01*(i%2);
+    y[3*i+2] = -0.005*i;
+    cellVolume[i] = 1.0;
+  }
+
+  double dt = 1.0;
+  analyticMat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+  // compute the tangent both ways
+  Teuchos::RCP<Epetra_FECrsMatrix> tangent[2];
+  for(int k=0 ; k<2 ; ++k){
+    tangent[k] = createZeroTangent(tangentMap);
+    PeridigmNS::SerialMatrix tangentSerialMatrix(tangent[k]);
+    const ElasticMaterial& mat = (k == 0 ? analyticMat : finiteDifferenceMat);
+    mat.computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+  }
+
+  // compare the entries, relative to the largest entry
+  double maxEntry, maxDifference;
+  TEST_ASSERT(compareTangents(*tangent[1], *tangent[0], maxEntry, maxDifference));
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-6*maxEntry);
+
+  // evaluating again reuses the neighborhood workspace
+  tangent[1]->PutScalar(0.0);
+  PeridigmNS::SerialMatrix tangentSerialMatrix(tangent[1]);
+  finiteDifferenceMat.computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+  double maxRepeatEntry, maxRepeatDifference;
+  TEST_ASSERT(compareTangents(*tangent[1], *tangent[0], maxRepeatEntry, maxRepeatDifference));
+  TEST_EQUALITY(maxRepeatDifference, maxDifference);
+}
+
 //! Tests the finite-difference Jacobian for a two-point system.
 TEUCHOS_UNIT_TEST(ElasticMaterial, twoPointTangentStiffnessMatrix) {
 
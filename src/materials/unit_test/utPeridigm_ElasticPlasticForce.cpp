@@ -0,0 +1,219 @@
+/*! \file utPeridigm_ElasticPlasticForce.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "elastic_plastic.h"
+#include "elastic_plastic_hardening.h"
+#include "material_utilities.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace Teuchos;
+
+const double bulkModulus = 130.0e9;
+const double shearModulus = 78.0e9;
+const double horizon = 1.75;
+
+//! A 4x4x4 lattice with unit spacing, sheared more strongly towards the top so that only some points yield.
+class ShearedLattice {
+
+public:
+
+  ShearedLattice() : numPoints(64)
+  {
+    x.resize(3*numPoints);
+    y.resize(3*numPoints);
+    volume.resize(numPoints, 1.0);
+    for(int i=0 ; i<numPoints ; ++i){
+      x[3*i]   = i%4;
+      x[3*i+1] = (i/4)%4;
+      x[3*i+2] = i/16;
+      double z = x[3*i+2];
+      y[3*i]   = x[3*i] + 0.004*z*z*x[3*i+1] + 1.0e-4*x[3*i];
+      y[3*i+1] = x[3*i+1] - 1.0e-4*(i%3);
+      y[3*i+2] = x[3*i+2] + 2.0e-4*(i%5);
+    }
+
+    for(int i=0 ; i<numPoints ; ++i){
+      int listIndex = neighborhoodList.size();
+      neighborhoodList.push_back(0);
+      for(int j=0 ; j<numPoints ; ++j){
+        double dx = x[3*j]-x[3*i], dy = x[3*j+1]-x[3*i+1], dz = x[3*j+2]-x[3*i+2];
+        if(j != i && sqrt(dx*dx+dy*dy+dz*dz) < horizon){
+          neighborhoodList.push_back(j);
+          neighborhoodList[listIndex] += 1;
+        }
+      }
+    }
+    numBonds = neighborhoodList.size() - numPoints;
+
+    weightedVolume.resize(numPoints);
+    MATERIAL_EVALUATION::computeWeightedVolume(&x[0], &volume[0], &weightedVolume[0], numPoints, &neighborhoodList[0], horizon);
+
+    // nonuniform damage and plastic history
+    bondDamage.resize(numBonds);
+    deviatoricPlasticExtensionN.resize(numBonds);
+    for(int b=0 ; b<numBonds ; ++b){
+      bondDamage[b] = 0.1*(b%4);
+      deviatoricPlasticExtensionN[b] = 1.0e-5*((b%7) - 3);
+    }
+    lambdaN.resize(numPoints);
+    for(int i=0 ; i<numPoints ; ++i)
+      lambdaN[i] = 1.0e-3*(i%3);
+  }
+
+  int numPoints;
+  int numBonds;
+  vector<double> x, y, volume, weightedVolume, bondDamage, deviatoricPlasticExtensionN, lambdaN;
+  vector<int> neighborhoodList;
+};
+
+//! Returns the largest difference between two arrays, relative to the largest entry of the reference array.
+double maxRelativeDifference(const vector<double>& values, const vector<double>& referenceValues)
+{
+  double maxEntry(0.0), maxDifference(0.0);
+  for(unsigned int i=0 ; i<values.size() ; ++i){
+    maxEntry = std::max(maxEntry, std::abs(referenceValues[i]));
+    maxDifference = std::max(maxDifference, std::abs(values[i] - referenceValues[i]));
+  }
+  return maxEntry > 0.0 ? maxDifference/maxEntry : maxDifference;
+}
+
+//! Compares the compacted elastic-plastic kernel with the fused bond loop for a mix of elastic and yielding points.
+
+TEUCHOS_UNIT_TEST(ElasticPlasticForce, compactedReturnMappingMatchesFusedLoop) {
+
+  ShearedLattice lattice;
+  int numPoints = lattice.numPoints;
+  int numBonds = lattice.numBonds;
+  double yieldStress = 3.0e9;
+
+  // fused bond loop
+  vector<double> dilatation(numPoints), edpNP1(numBonds), lambdaNP1(numPoints), force(3*numPoints, 0.0);
+  MATERIAL_EVALUATION::computeDilatation(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0], &lattice.bondDamage[0],
+                                         &dilatation[0], &lattice.neighborhoodList[0], numPoints, horizon);
+  MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0],
+                                                                   &dilatation[0], &lattice.bondDamage[0], &lattice.deviatoricPlasticExtensionN[0],
+                                                                   &edpNP1[0], &lattice.lambdaN[0], &lambdaNP1[0], &force[0],
+                                                                   &lattice.neighborhoodList[0], numPoints, bulkModulus, shearModulus,
+                                                                   horizon, yieldStress, false, 1.0);
+
+  // yield pass and return mapping over the compacted list of yielding points
+  vector<double> compactedDilatation(numPoints), compactedEdpNP1(numBonds), compactedLambdaNP1(numPoints), compactedForce(3*numPoints, 0.0);
+  MATERIAL_EVALUATION::BondCache bonds;
+  MATERIAL_EVALUATION::YieldingPoints yielding;
+  MATERIAL_EVALUATION::computeDilatationAndInternalForceIsotropicElasticPlastic(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0],
+                                                                                &lattice.bondDamage[0], &compactedDilatation[0],
+                                                                                &lattice.deviatoricPlasticExtensionN[0], &compactedEdpNP1[0],
+                                                                                &lattice.lambdaN[0], &compactedLambdaNP1[0], &compactedForce[0],
+                                                                                &lattice.neighborhoodList[0], numPoints, bulkModulus, shearModulus,
+                                                                                horizon, yieldStress, false, 1.0, bonds, yielding);
+
+  TEST_COMPARE(yielding.size(), >, 0);
+  TEST_COMPARE(yielding.size(), <, numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    TEST_EQUALITY(compactedLambdaNP1[i] > lattice.lambdaN[i], std::find(yielding.point.begin(), yielding.point.end(), i) != yielding.point.end());
+
+  TEST_COMPARE(maxRelativeDifference(compactedDilatation, dilatation), <=, 1.0e-14);
+  TEST_COMPARE(maxRelativeDifference(compactedLambdaNP1, lambdaNP1), <=, 1.0e-14);
+  TEST_COMPARE(maxRelativeDifference(compactedEdpNP1, edpNP1), <=, 1.0e-12);
+  TEST_COMPARE(maxRelativeDifference(compactedForce, force), <=, 1.0e-12);
+}
+
+//! Compares the compacted hardening kernel with the fused bond loop for a mix of elastic and yielding points.
+
+TEUCHOS_UNIT_TEST(ElasticPlasticForce, compactedHardeningReturnMappingMatchesFusedLoop) {
+
+  ShearedLattice lattice;
+  int numPoints = lattice.numPoints;
+  int numBonds = lattice.numBonds;
+  double yieldStress = 3.0e9;
+  double hardeningModulus = 1.0e9;
+  vector<double> surfaceCorrectionFactor(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    surfaceCorrectionFactor[i] = 1.0 + 0.01*(i%5);
+
+  // fused bond loop
+  vector<double> dilatation(numPoints), edpNP1(numBonds), lambdaNP1(numPoints), force(3*numPoints, 0.0);
+  MATERIAL_EVALUATION::computeDilatation(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0], &lattice.bondDamage[0],
+                                         &dilatation[0], &lattice.neighborhoodList[0], numPoints, horizon);
+  MATERIAL_EVALUATION::computeInternalForceIsotropicHardeningPlastic(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0],
+                                                                     &dilatation[0], &lattice.bondDamage[0], &surfaceCorrectionFactor[0],
+                                                                     &lattice.deviatoricPlasticExtensionN[0], &edpNP1[0], &lattice.lambdaN[0],
+                                                                     &lambdaNP1[0], &force[0], &lattice.neighborhoodList[0], numPoints,
+                                                                     bulkModulus, shearModulus, horizon, yieldStress, hardeningModulus);
+
+  // yield pass and return mapping over the compacted list of yielding points
+  vector<double> compactedDilatation(numPoints), compactedEdpNP1(numBonds), compactedLambdaNP1(numPoints), compactedForce(3*numPoints, 0.0);
+  MATERIAL_EVALUATION::BondCache bonds;
+  MATERIAL_EVALUATION::YieldingPoints yielding;
+  MATERIAL_EVALUATION::computeDilatationAndInternalForceIsotropicHardeningPlastic(&lattice.x[0], &lattice.y[0], &lattice.weightedVolume[0], &lattice.volume[0],
+                                                                                  &lattice.bondDamage[0], &compactedDilatation[0], &surfaceCorrectionFactor[0],
+                                                                                  &lattice.deviatoricPlasticExtensionN[0], &compactedEdpNP1[0],
+                                                                                  &lattice.lambdaN[0], &compactedLambdaNP1[0], &compactedForce[0],
+                                                                                  &lattice.neighborhoodList[0], numPoints, bulkModulus, shearModulus,
+                                                                                  horizon, yieldStress, hardeningModulus, bonds, yielding);
+
+  TEST_COMPARE(yielding.size(), >, 0);
+  TEST_COMPARE(yielding.size(), <, numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    TEST_EQUALITY(compactedLambdaNP1[i] > lattice.lambdaN[i], std::find(yielding.point.begin(), yielding.point.end(), i) != yielding.point.end());
+
+  TEST_COMPARE(maxRelativeDifference(compactedDilatation, dilatation), <=, 1.0e-14);
+  TEST_COMPARE(maxRelativeDifference(compactedLambdaNP1, lambdaNP1), <=, 1.0e-14);
+  TEST_COMPARE(maxRelativeDifference(compactedEdpNP1, edpNP1), <=, 1.0e-12);
+  TEST_COMPARE(maxRelativeDifference(compactedForce, force), <=, 1.0e-12);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,175 @@
+/*! \file utPeridigm_TangentStiffnessMatrix.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef UTPERIDIGM_TANGENTSTIFFNESSMATRIX_HPP
+#define UTPERIDIGM_TANGENTSTIFFNESSMATRIX_HPP
+
+#include <Teuchos_RCP.hpp>
+#include "Peridigm_Material.hpp"
+#include "Peridigm_DataManager.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <Epetra_BlockMap.h>
+#include <Epetra_Map.h>
+#include <Epetra_FECrsMatrix.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+//! Eight points at the corners of a unit cube, each bonded to all of the others, shared by the tangent stiffness matrix tests.
+class EightPointCube {
+
+public:
+
+  EightPointCube()
+    : scalarPointMap(8, 1, 0, comm), vectorPointMap(8, 3, 0, comm), bondMap(8, 7, 0, comm), tangentMap(24, 0, comm),
+      numOwnedPoints(8), ownedIDs(8)
+  {
+    for(int i=0 ; i<numOwnedPoints; ++i)
+      ownedIDs[i] = i;
+
+    // all cells are neighbors of each other
+    for(int i=0 ; i<numOwnedPoints; ++i){
+      neighborhoodList.push_back(7);
+      for(int j=0 ; j<8 ; ++j){
+        if(i != j)
+          neighborhoodList.push_back(j);
+      }
+    }
+
+    // in serial, the overlap and non-overlap maps are the same
+    dataManager.setMaps(Teuchos::rcp(&scalarPointMap, false),
+                        Teuchos::rcp(&scalarPointMap, false),
+                        Teuchos::rcp(&vectorPointMap, false),
+                        Teuchos::rcp(&vectorPointMap, false),
+                        Teuchos::rcp(&bondMap, false));
+  }
+
+  //! Allocates the fields of the material, deforms the cube, initializes the material, and partially damages a few bonds.
+  void initialize(PeridigmNS::Material& mat, double dt)
+  {
+    dataManager.allocateData(mat.FieldIds());
+
+    PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+    Epetra_Vector& x = *dataManager.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *dataManager.getData(fieldManager.getFieldId("Bond_Damage"), PeridigmField::STEP_NP1);
+
+    // the corners of a unit cube, sheared and stretched so that every bond rotates
+    for(int i=0 ; i<8 ; ++i){
+      x[3*i]   = (i/4)%2;
+      x[3*i+1] = (i/2)%2;
+      x[3*i+2] = i%2;
+      y[3*i]   = x[3*i] + 0.02*x[3*i+1] + 0.001*i;
+      y[3*i+1] = 1.01*x[3*i+1] - 0.003*(i%3);
+      y[3*i+2] = 0.98*x[3*i+2] + 0.002*(i%5);
+      cellVolume[i] = 1.0 + 0.1*i;
+    }
+
+    mat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+    bondDamage[3] = 0.5;
+    bondDamage[20] = 1.0;
+    bondDamage[41] = 0.25;
+  }
+
+  Epetra_SerialComm comm;
+  Epetra_BlockMap scalarPointMap;
+  Epetra_BlockMap vectorPointMap;
+  Epetra_BlockMap bondMap;
+  Epetra_Map tangentMap;
+  int numOwnedPoints;
+  std::vector<int> ownedIDs;
+  std::vector<int> neighborhoodList;
+  PeridigmNS::DataManager dataManager;
+};
+
+//! Creates a tangent stiffness matrix in which every entry is allocated and set to zero.
+inline Teuchos::RCP<Epetra_FECrsMatrix> createZeroTangent(const Epetra_Map& tangentMap)
+{
+  int numRows = tangentMap.NumGlobalElements();
+  Teuchos::RCP<Epetra_FECrsMatrix> tangent = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, tangentMap, 0, false));
+  std::vector<double> zeros(numRows);
+  std::vector<int> indices(numRows);
+  for(int i=0 ; i<numRows ; ++i)
+    indices[i] = i;
+  for(int i=0 ; i<numRows ; ++i)
+    tangent->InsertGlobalValues(i, numRows, &zeros[0], &indices[0]);
+  tangent->GlobalAssemble();
+  return tangent;
+}
+
+//! Compares the entries of two tangents; returns false if their sparsity patterns differ, otherwise sets the largest entry of the reference tangent and the largest difference.
+inline bool compareTangents(const Epetra_FECrsMatrix& tangent,
+                            const Epetra_FECrsMatrix& referenceTangent,
+                            double& maxEntry,
+                            double& maxDifference)
+{
+  int numRows = referenceTangent.NumGlobalRows();
+  int length = referenceTangent.MaxNumEntries();
+  std::vector<double> values(length), referenceValues(length);
+  std::vector<int> indices(length), referenceIndices(length);
+  maxEntry = 0.0;
+  maxDifference = 0.0;
+  for(int i=0 ; i<numRows ; ++i){
+    int numEntries, numReferenceEntries;
+    tangent.ExtractGlobalRowCopy(i, length, numEntries, &values[0], &indices[0]);
+    referenceTangent.ExtractGlobalRowCopy(i, length, numReferenceEntries, &referenceValues[0], &referenceIndices[0]);
+    if(numEntries != numReferenceEntries)
+      return false;
+    for(int j=0 ; j<numEntries ; ++j){
+      if(indices[j] != referenceIndices[j])
+        return false;
+      maxEntry = std::max(maxEntry, std::abs(referenceValues[j]));
+      maxDifference = std::max(maxDifference, std::abs(values[j] - referenceValues[j]));
+    }
+  }
+  return true;
+}
+
+#endif // UTPERIDIGM_TANGENTSTIFFNESSMATRIX_HPP
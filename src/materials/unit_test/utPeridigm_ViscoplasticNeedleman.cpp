@@ -0,0 +1,138 @@
+/*! \file utPeridigm_ElasticBondBasedMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "viscoplastic_needleman_correspondence.h"
+#include <cmath>
+
+using namespace std;
+using namespace Teuchos;
+
+// Material parameters of the ViscoplasticNeedlemanFullyPrescribedTension verification tests
+const double shearModulus = 105.5e9;
+const double yieldStress = 460.0e6;
+const double strainHardExp = 0.1;
+const double rateHardExp = 0.01;
+const double refStrainRate = 0.001;
+const double refStrain0 = 0.00218;
+const double refStrain1 = 0.436;
+const double dt = 1.0e-6;
+
+//! Residual of the return mapping, the same expression used by the bisection method in updateElasticViscoplasticCauchyStress().
+double residual(double deltaLambda, double eqpsN, double scalarDeviatoricStrainInc, double deviatoricStressMagnitudeN)
+{
+  double yf = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda, eqpsN + deltaLambda, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+  return scalarDeviatoricStrainInc - deltaLambda - 1.0 / 2.0 / shearModulus * (sqrt(2.0/3.0) * yf - deviatoricStressMagnitudeN);
+}
+
+//! Compares the analytic derivative of the yield function with a central finite difference.
+
+TEUCHOS_UNIT_TEST(ViscoplasticNeedleman, YieldFunctionDerivative) {
+
+  double eqpsN[3] = {0.0, 0.01, 0.5};
+  double deltaLambda[3] = {1.0e-6, 1.0e-4, 1.0e-2};
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      double h = 1.0e-4*deltaLambda[j];
+      double yfPlus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda[j] + h, eqpsN[i] + deltaLambda[j] + h, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      double yfMinus = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunction(deltaLambda[j] - h, eqpsN[i] + deltaLambda[j] - h, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      double finiteDifference = (yfPlus - yfMinus)/(2.0*h);
+      double derivative = CORRESPONDENCE::ViscoplasticNeedlemanYieldFunctionDerivative(deltaLambda[j], eqpsN[i] + deltaLambda[j], yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+      TEST_FLOATING_EQUALITY(derivative, finiteDifference, 1.0e-6);
+    }
+  }
+}
+
+//! Checks that the plastic multiplier is a root of the return mapping residual by evaluating the residual on either side of it.
+
+TEUCHOS_UNIT_TEST(ViscoplasticNeedleman, SolvePlasticMultiplier) {
+
+  double eqpsN[3] = {0.0, 0.01, 0.5};
+  double scalarDeviatoricStrainInc[3] = {1.0e-6, 1.0e-4, 1.0e-2};
+  double deviatoricStressMagnitudeN = sqrt(2.0/3.0) * yieldStress;
+
+  for(int i=0 ; i<3 ; ++i){
+    for(int j=0 ; j<3 ; ++j){
+      int numIterations;
+      bool converged;
+      double deltaLambda = CORRESPONDENCE::ViscoplasticNeedlemanSolvePlasticMultiplier(eqpsN[i], scalarDeviatoricStrainInc[j], deviatoricStressMagnitudeN,
+                                                                                       yieldStress, shearModulus, strainHardExp, rateHardExp,
+                                                                                       refStrainRate, refStrain0, refStrain1, dt,
+                                                                                       numIterations, converged);
+      TEST_ASSERT(converged);
+      TEST_ASSERT(numIterations > 0);
+      TEST_ASSERT(deltaLambda > 0.0 && deltaLambda < 1.0);
+      // The residual decreases with deltaLambda, so it must change sign across the root
+      double h = 1.0e-8*deltaLambda;
+      TEST_ASSERT(residual(deltaLambda - h, eqpsN[i], scalarDeviatoricStrainInc[j], deviatoricStressMagnitudeN) > 0.0);
+      TEST_ASSERT(residual(deltaLambda + h, eqpsN[i], scalarDeviatoricStrainInc[j], deviatoricStressMagnitudeN) < 0.0);
+    }
+  }
+}
+
+//! Checks that a root that is not bracketed by [0,1] is reported as a failure and gives a zero plastic multiplier, as with the bisection method.
+
+TEUCHOS_UNIT_TEST(ViscoplasticNeedleman, SolvePlasticMultiplierNotBracketed) {
+
+  int numIterations;
+  bool converged;
+  double deltaLambda = CORRESPONDENCE::ViscoplasticNeedlemanSolvePlasticMultiplier(0.01, -1.0e-2, 0.0,
+                                                                                   yieldStress, shearModulus, strainHardExp, rateHardExp,
+                                                                                   refStrainRate, refStrain0, refStrain1, dt,
+                                                                                   numIterations, converged);
+  TEST_ASSERT(!converged);
+  TEST_EQUALITY(numIterations, 0);
+  TEST_EQUALITY(deltaLambda, 0.0);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -199,5 +199,142 @@ void computeInternalForceViscoelasticStandardLinearSolid
 	}
 }
 
+void computeDilatationAndInternalForceViscoelasticStandardLinearSolid
+  (
+   double delta_t,
+   const double *xOverlap,
+   const double *yNOverlap,
+   const double *yNP1Overlap,
+   const double *mOwned,
+   const double* volumeOverlap,
+   const double* dilatationOwnedN,
+   double* dilatationOwnedNp1,
+   const double* bondDamage,
+   const double *edbN,
+   double *edbNP1,
+   double *fInternalOverlap,
+   const int*  localNeighborList,
+   int numOwnedPoints,
+   double BULK_MODULUS,
+   double SHEAR_MODULUS,
+   double m_lambda_i,
+   double m_tau_b_i,
+   double horizon,
+   BondCache& bonds
+)
+{
+
+	double c1 = m_tau_b_i / delta_t;
+	double decay = exp(-1.0/c1);
+	double beta_i=1.-c1*(1.-decay);
+
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+	double OMEGA=1.0;
+
+	const double *xOwned = xOverlap;
+	const double *yNOwned = yNOverlap;
+	const double *yNP1Owned = yNP1Overlap;
+	const double *m = mOwned;
+	const double *v = volumeOverlap;
+	const double *thetaN = dilatationOwnedN;
+	double *thetaNp1 = dilatationOwnedNp1;
+	double *fOwned = fInternalOverlap;
+
+	const int *neighPtr = localNeighborList;
+	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yNOwned +=3, yNP1Owned +=3, fOwned+=3, m++, thetaN++, thetaNp1++){
+
+		int numNeigh = *neighPtr;
+		double weightedVolume = *m;
+
+		/*
+		 * Dilatation at the end of the step, caching the bond quantities
+		 */
+		*thetaNp1 = computeDilatationAndCacheBonds(neighPtr,xOwned,yNP1Owned,xOverlap,yNP1Overlap,v,bondDamage,weightedVolume,horizon,bonds);
+		neighPtr++;
+
+		const double *YN = yNOwned;
+		double dilatationN   = *thetaN;
+		double dilatationNp1 = *thetaNp1;
+		double alpha = 15.0*MU/weightedVolume;
+		double selfCellVolume = v[p];
+		double c = 3.0 * K * dilatationNp1 / weightedVolume;
+
+		const double *zeta = &bonds.zeta[0];
+		const double *e = &bonds.extension[0];
+		const double *dYNp1 = &bonds.dY[0];
+		const double *dx_Y = &bonds.dx_Y[0];
+		const double *dy_Y = &bonds.dy_Y[0];
+		const double *dz_Y = &bonds.dz_Y[0];
+		const double *cellVolume = &bonds.volume[0];
+		const double *intact = &bonds.intact[0];
+		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++,edbN++,edbNP1++){
+			int localId = *neighPtr;
+			const double *YPN = &yNOverlap[3*localId];
+
+			/*
+			 * Damage is applied as in computeInternalForceViscoelasticStandardLinearSolid(),
+			 * with the damage on step N taken to be the same as on step NP1
+			 */
+			double damageN = intact[n];
+			double damageNp1 = intact[n];
+
+			/*
+			 * volumetric scalar state
+			 */
+			double eiN   = dilatationN * zeta[n] / 3.0;
+			double eiNp1 = dilatationNp1 * zeta[n] / 3.0;
+
+			/*
+			 * COMPUTE edN
+			 */
+			double dx = YPN[0]-YN[0];
+			double dy = YPN[1]-YN[1];
+			double dz = YPN[2]-YN[2];
+			double dYN = sqrt(dx*dx+dy*dy+dz*dz);
+			double edN = damageN * (dYN - zeta[n]) - eiN;
+
+			/*
+			 * COMPUTE edNp1
+			 */
+			double edNp1 = damageNp1 * e[n] - eiNp1;
+
+			/*
+			 * Increment to deviatoric extension state
+			 */
+			double delta_ed = edNp1-edN;
+			/*
+			 * Integrate back extension state forward in time
+			 */
+			*edbNP1 = edN * (1-decay) + (*edbN)*decay  + beta_i * delta_ed;
+
+			/*
+			 * Compute deviatoric force state
+			 */
+			double td = (1.0-m_lambda_i) * alpha * OMEGA * edNp1 + m_lambda_i * alpha * OMEGA * ( edNp1 - *edbNP1 );
+
+			/*
+			 * Compute volumetric force state
+			 */
+			double ti = c * OMEGA * zeta[n];
+
+			/*
+			 * Note that damage has already been applied once to 'td' (through ed) above.
+			 */
+			double t = damageNp1 * (ti + td);
+			double fx = t * dx_Y[n] / dYNp1[n];
+			double fy = t * dy_Y[n] / dYNp1[n];
+			double fz = t * dz_Y[n] / dYNp1[n];
+
+			*(fOwned+0) += fx*cellVolume[n];
+			*(fOwned+1) += fy*cellVolume[n];
+			*(fOwned+2) += fz*cellVolume[n];
+			fInternalOverlap[3*localId+0] -= fx*selfCellVolume;
+			fInternalOverlap[3*localId+1] -= fy*selfCellVolume;
+			fInternalOverlap[3*localId+2] -= fz*selfCellVolume;
+		}
+	}
+}
+
 }
 
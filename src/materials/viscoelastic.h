@@ -48,6 +48,8 @@
 #ifndef VISCOELASTIC_H
 #define VISCOELASTIC_H
 
+#include "material_utilities.h"
+
 namespace MATERIAL_EVALUATION {
 
 /**
@@ -78,6 +80,38 @@ void computeInternalForceViscoelasticStandardLinearSolid
    double m_tau_b_i
    );
 
+/**
+ * Computes the dilatation at the end of the step for each owned point and its contributions
+ * to the internal force in a single sweep over its bonds; the force loop reuses the bond
+ * quantities cached while computing the dilatation.
+ * Output:
+ *   * dilatationOwnedNp1
+ *   * force
+ *   * edbNP1 -- deviatoric back strain at end of step
+ */
+void computeDilatationAndInternalForceViscoelasticStandardLinearSolid
+  (double delta_t,
+   const double *xOverlap,
+   const double *yNOverlap,
+   const double *yNP1Overlap,
+   const double *mOwned,
+   const double* volumeOverlap,
+   const double* dilatationOwnedN,
+   double* dilatationOwnedNp1,
+   const double* bondDamage,
+   const double *edbN,
+   double *edbNP1,
+   double *fInternalOverlap,
+   const int*  localNeighborList,
+   int numOwnedPoints,
+   double m_bulkModulus,
+   double m_shearModulus,
+   double m_lambda_i,
+   double m_tau_b_i,
+   double horizon,
+   BondCache& bonds
+   );
+
 }
 
 #endif // VISCOELASTIC_H
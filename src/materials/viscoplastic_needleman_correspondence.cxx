@@ -78,7 +78,10 @@ const double flawLocationY,
 const double flawLocationZ,
 const double flawSize,
 const double flawMagnitude,
-const double dt
+const double dt,
+const ReturnMappingSolver solver,
+double* returnMappingIterations,
+double* returnMappingFailures
 )
 {
   
@@ -122,12 +125,19 @@ const double dt
 
   double reducedYieldStress;
   const double* modelCoord = modelCoordinates;
+  double* iterations = returnMappingIterations;
+  double* failures = returnMappingFailures;
+  int numIterations;
+  bool converged;
 
 
   for(int iID=0 ; iID<numPoints ; ++iID, modelCoord+=3, 
         rateOfDef+=9, stressN+=9, stressNP1+=9,
         ++vmStress,++eqpsN,++eqpsNP1){
 
+      numIterations = 0;
+      converged = true;
+
       //strainInc = dt * rateOfDef
       for (int i = 0; i < 9; i++) {
           strainInc[i] = *(rateOfDef+i)*dt;
@@ -231,48 +241,65 @@ const double dt
 
           deviatoricStressMagnitudeN = sqrt(tempScalar);
 
-          //Verbose bi-section method to solve for deltaLambda
-          //TODO: Implement a ``smarter'' faster root solve here, i.e. Brent's
-          //method
-          deltaLambda = 1.0;
-          deltaLambdaOld = 0.0;
-          a = 0.0;
-          b = 1.0;
-          c = (a+b)/2.0;
-
-          //Bisection loop
-          for(int iter = 0; iter < 100000; iter++){
-
-              *eqpsNP1 = *eqpsN + b;
-              yfb = ViscoplasticNeedlemanYieldFunction(b, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
-              *eqpsNP1 = *eqpsN + c;
-              yfc = ViscoplasticNeedlemanYieldFunction(c, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
+          if(solver == RETURN_MAPPING_NEWTON){
+              deltaLambda = ViscoplasticNeedlemanSolvePlasticMultiplier(*eqpsN,
+                                                                        scalarDeviatoricStrainInc,
+                                                                        deviatoricStressMagnitudeN,
+                                                                        reducedYieldStress,
+                                                                        shearMod,
+                                                                        strainHardExp,
+                                                                        rateHardExp,
+                                                                        refStrainRate,
+                                                                        refStrain0,
+                                                                        refStrain1,
+                                                                        dt,
+                                                                        numIterations,
+                                                                        converged);
+          }
+          else{
+
+              //Verbose bi-section method to solve for deltaLambda
+              deltaLambda = 1.0;
+              deltaLambdaOld = 0.0;
+              a = 0.0;
+              b = 1.0;
+              c = (a+b)/2.0;
+
+              //Bisection loop
+              for(int iter = 0; iter < 100000; iter++){
+
+                  numIterations = iter + 1;
+
+                  *eqpsNP1 = *eqpsN + b;
+                  yfb = ViscoplasticNeedlemanYieldFunction(b, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
+                  *eqpsNP1 = *eqpsN + c;
+                  yfc = ViscoplasticNeedlemanYieldFunction(c, *eqpsNP1, reducedYieldStress, strainHardExp, rateHardExp, refStrainRate,refStrain0, refStrain1, dt);
        
-              fb = scalarDeviatoricStrainInc - b - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfb - deviatoricStressMagnitudeN);
-              fc = scalarDeviatoricStrainInc - c - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfc - deviatoricStressMagnitudeN);
+                  fb = scalarDeviatoricStrainInc - b - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfb - deviatoricStressMagnitudeN);
+                  fc = scalarDeviatoricStrainInc - c - 1.0 / 2.0 / shearMod * (sqrt(2.0/3.0) * yfc - deviatoricStressMagnitudeN);
               
-              if(fb > 0.0 && fc > 0.0) {
-                  b = c;
-              } 
-              else if(fb < 0.0 && fc < 0.0){
-                  b = c;
-              }
-              else{
-                  a = c;
-              }
+                  if(fb > 0.0 && fc > 0.0) {
+                      b = c;
+                  } 
+                  else if(fb < 0.0 && fc < 0.0){
+                      b = c;
+                  }
+                  else{
+                      a = c;
+                  }
 
-              deltaLambdaOld = c;
-              c = (a+b)/2.0;
-              deltaLambda = c;
+                  deltaLambdaOld = c;
+                  c = (a+b)/2.0;
+                  deltaLambda = c;
 
-              if(fabs(deltaLambda - deltaLambdaOld)/fabs(deltaLambda) < 1.0e-6){
-                  //We're converged, stop
-                  break;
-              }
-              else if (iter == 99999){
-                  //Error message here!
-                  std::cout << "Bisection method failed to converge in 1e6 iterations" << std::endl;
-                  break;
+                  if(fabs(deltaLambda - deltaLambdaOld)/fabs(deltaLambda) < 1.0e-6){
+                      //We're converged, stop
+                      break;
+                  }
+                  else if (iter == 99999){
+                      converged = false;
+                      break;
+                  }
               }
           }
 
@@ -381,6 +408,11 @@ const double dt
               *eqpsNP1 = *eqpsN;
           }
       }
+
+      if(iterations != 0)
+          iterations[iID] = numIterations;
+      if(failures != 0)
+          failures[iID] = converged ? 0.0 : 1.0;
   }
 }
 
@@ -405,6 +437,144 @@ ScalarT ViscoplasticNeedlemanYieldFunction
   return (hardTerm * rateTerm);
 }
 
+// Derivative of the Needleman yield function with respect to deltaLambda,
+// with eqps = eqps_N + deltaLambda as in the return mapping residual
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanYieldFunctionDerivative
+(
+ const ScalarT deltaLambda,
+ const ScalarT eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt
+)
+{
+  ScalarT strainTerm = 1.0 + eqps/refStrain0;
+  ScalarT softeningTerm = 1.0 + pow(eqps/refStrain1,2.0);
+  ScalarT hardTerm = yieldStress * pow(strainTerm, strainHardExp) / softeningTerm;
+  ScalarT rateTerm = pow(sqrt(2.0/3.0) * deltaLambda / dt / refStrainRate, rateHardExp);
+
+  // d(hardTerm)/d(eqps)
+  ScalarT hardTermDerivative = yieldStress * ( strainHardExp / refStrain0 * pow(strainTerm, strainHardExp - 1.0) / softeningTerm
+                                               - pow(strainTerm, strainHardExp) * 2.0 * eqps / (refStrain1*refStrain1) / (softeningTerm*softeningTerm) );
+
+  // d(rateTerm)/d(deltaLambda) = rateHardExp * rateTerm / deltaLambda
+  ScalarT rateTermDerivative = rateHardExp * rateTerm / deltaLambda;
+
+  return (hardTermDerivative * rateTerm + hardTerm * rateTermDerivative);
+}
+
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanSolvePlasticMultiplier
+(
+ const ScalarT eqpsN,
+ const ScalarT scalarDeviatoricStrainInc,
+ const ScalarT deviatoricStressMagnitudeN,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations,
+ bool& converged
+)
+//    Finds the root of the return mapping residual
+//
+//      f(deltaLambda) = scalarDeviatoricStrainInc - deltaLambda
+//                       - 1/(2 shearMod) * ( sqrt(2/3) * Y(deltaLambda, eqpsN + deltaLambda) - deviatoricStressMagnitudeN )
+//
+//    on [0,1], the interval searched by the bisection method.  Newton steps use the
+//    analytic derivative of f and are taken only while they stay inside the current
+//    bracket and at least halve the residual; otherwise the bracket is bisected.
+//    This is the safeguarded Newton method rtsafe of Press et al., Numerical Recipes.
+{
+  const int maxIterations = 100;
+  const double tolerance = 1.0e-12;
+  const double c = 1.0/2.0/shearMod;
+
+  ScalarT lo = 0.0;
+  ScalarT hi = 1.0;
+  ScalarT yf, dyf, f, df, fLo, fHi;
+
+  numIterations = 0;
+  converged = true;
+
+  yf = ViscoplasticNeedlemanYieldFunction(lo, eqpsN + lo, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+  fLo = scalarDeviatoricStrainInc - lo - c * (sqrt(2.0/3.0) * yf - deviatoricStressMagnitudeN);
+  yf = ViscoplasticNeedlemanYieldFunction(hi, eqpsN + hi, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+  fHi = scalarDeviatoricStrainInc - hi - c * (sqrt(2.0/3.0) * yf - deviatoricStressMagnitudeN);
+
+  if(fLo == 0.0)
+    return lo;
+  if(fHi == 0.0)
+    return hi;
+  // Without a sign change the bisection method collapses its bracket onto zero, do the same here
+  if( (fLo > 0.0 && fHi > 0.0) || (fLo < 0.0 && fHi < 0.0) ){
+    converged = false;
+    return lo;
+  }
+
+  // Orient the bracket so that f(lo) > 0 > f(hi)
+  if(fLo < 0.0){
+    ScalarT temp = lo;
+    lo = hi;
+    hi = temp;
+  }
+
+  ScalarT deltaLambda = 0.5*(lo + hi);
+  ScalarT dx = fabs(hi - lo);
+  ScalarT dxOld = dx;
+
+  for(int iter = 0; iter < maxIterations; iter++){
+
+    numIterations = iter + 1;
+
+    yf = ViscoplasticNeedlemanYieldFunction(deltaLambda, eqpsN + deltaLambda, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+    dyf = ViscoplasticNeedlemanYieldFunctionDerivative(deltaLambda, eqpsN + deltaLambda, yieldStress, strainHardExp, rateHardExp, refStrainRate, refStrain0, refStrain1, dt);
+    f = scalarDeviatoricStrainInc - deltaLambda - c * (sqrt(2.0/3.0) * yf - deviatoricStressMagnitudeN);
+    df = -1.0 - c * sqrt(2.0/3.0) * dyf;
+
+    if(f == 0.0)
+      return deltaLambda;
+
+    // Shrink the bracket
+    if(f > 0.0)
+      lo = deltaLambda;
+    else
+      hi = deltaLambda;
+
+    // Bisect if the Newton step would leave the bracket, if it is not reducing the
+    // residual fast enough, or if the derivative is unusable
+    bool bisect = !(df < 0.0 || df > 0.0) ||
+                  ((deltaLambda - hi)*df - f) * ((deltaLambda - lo)*df - f) > 0.0 ||
+                  fabs(2.0*f) > fabs(dxOld*df);
+
+    dxOld = dx;
+    if(bisect){
+      dx = 0.5*(hi - lo);
+      deltaLambda = lo + dx;
+    }
+    else{
+      dx = f/df;
+      deltaLambda -= dx;
+    }
+
+    if(fabs(dx) <= tolerance*fabs(deltaLambda))
+      return deltaLambda;
+  }
+
+  converged = false;
+
+  return deltaLambda;
+}
+
 
 template <typename ScalarT>
 ScalarT ViscoplasticNeedlemanFindRoot
@@ -602,7 +772,10 @@ const double m_flawLocationY,
 const double m_flawLocationZ,
 const double m_flawSize,
 const double m_flawMagnitude,
-const double dt
+const double dt,
+const ReturnMappingSolver solver,
+double* returnMappingIterations,
+double* returnMappingFailures
 );
 
 template double ViscoplasticNeedlemanYieldFunction<double>
@@ -618,6 +791,36 @@ template double ViscoplasticNeedlemanYieldFunction<double>
  const double dt
 );
 
+template double ViscoplasticNeedlemanYieldFunctionDerivative<double>
+(
+ const double deltaLambda,
+ const double eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt
+);
+
+template double ViscoplasticNeedlemanSolvePlasticMultiplier<double>
+(
+ const double eqpsN,
+ const double scalarDeviatoricStrainInc,
+ const double deviatoricStressMagnitudeN,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations,
+ bool& converged
+);
+
 template double ViscoplasticNeedlemanFindRoot<double>
 (
  const double eqps,
@@ -662,6 +865,36 @@ template Sacado::Fad::DFad<double> ViscoplasticNeedlemanYieldFunction<Sacado::Fa
  const double dt
 );
 
+template Sacado::Fad::DFad<double> ViscoplasticNeedlemanYieldFunctionDerivative<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double> deltaLambda,
+ const Sacado::Fad::DFad<double> eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt
+);
+
+template Sacado::Fad::DFad<double> ViscoplasticNeedlemanSolvePlasticMultiplier<Sacado::Fad::DFad<double> >
+(
+ const Sacado::Fad::DFad<double> eqpsN,
+ const Sacado::Fad::DFad<double> scalarDeviatoricStrainInc,
+ const Sacado::Fad::DFad<double> deviatoricStressMagnitudeN,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations,
+ bool& converged
+);
+
 template void updateElasticViscoplasticCauchyStress<Sacado::Fad::DFad<double> >
 (
 const double* modelCoordinates,
@@ -686,7 +919,10 @@ const double m_flawLocationY,
 const double m_flawLocationZ,
 const double m_flawSize,
 const double m_flawMagnitude,
-const double dt
+const double dt,
+const ReturnMappingSolver solver,
+double* returnMappingIterations,
+double* returnMappingFailures
 );
 
 }
@@ -49,6 +49,15 @@
 
 namespace CORRESPONDENCE {
 
+//! Root solvers for the plastic multiplier in the viscoplastic return mapping.
+enum ReturnMappingSolver {
+  //! Newton's method with an analytic derivative, safeguarded by bisection.
+  RETURN_MAPPING_NEWTON,
+  //! Plain bisection.
+  RETURN_MAPPING_BISECTION
+};
+
+//! Update the Cauchy stress; if returnMappingIterations is not null, the number of root solver iterations at each point is stored there (zero for elastic steps), and if returnMappingFailures is not null, it is set to one at points where the root solver failed and zero elsewhere.
 template<typename ScalarT>
 void updateElasticViscoplasticCauchyStress
 (
@@ -74,7 +83,29 @@ const double m_flawLocationY,
 const double m_flawLocationZ,
 const double m_flawSize,
 const double m_flawMagnitude,
-const double dt
+const double dt,
+const ReturnMappingSolver solver,
+double* returnMappingIterations,
+double* returnMappingFailures
+);
+
+//! Solve for the plastic multiplier with Newton's method, falling back to bisection whenever a Newton step leaves the bracket [0,1] or converges slowly; converged is set to false if the root is not bracketed by [0,1], in which case zero is returned, or if the iteration limit is reached.
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanSolvePlasticMultiplier
+(
+ const ScalarT eqpsN,
+ const ScalarT scalarDeviatoricStrainInc,
+ const ScalarT deviatoricStressMagnitudeN,
+ const double yieldStress,
+ const double shearMod,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt,
+ int& numIterations,
+ bool& converged
 );
 
 template <typename ScalarT>
@@ -107,6 +138,21 @@ ScalarT ViscoplasticNeedlemanYieldFunction
  const double dt
 );
 
+//! Derivative of ViscoplasticNeedlemanYieldFunction() with respect to deltaLambda, where eqps also increases with deltaLambda.
+template <typename ScalarT>
+ScalarT ViscoplasticNeedlemanYieldFunctionDerivative
+(
+ const ScalarT deltaLambda,
+ const ScalarT eqps,
+ const double yieldStress,
+ const double strainHardExp,
+ const double rateHardExp, 
+ const double refStrainRate,
+ const double refStrain0,
+ const double refStrain1,
+ const double dt
+);
+
 }
 
 #endif // VISCO_PLASTIC_NEEDLEMAN_CORRESPONDENCE_H